@@ -65,11 +65,28 @@
 /** @defgroup FONTS_Exported_Types
   * @{
   */ 
+typedef struct _tGlyph
+{
+  uint16_t Offset;          /* first byte of the rows in the table */
+  uint8_t X;                /* bounding box of the pixels from the pen position */
+  uint8_t Y;
+  uint8_t Width;
+  uint8_t Height;
+  uint8_t Advance;          /* pixels from the pen position to the next character */
+} sGLYPH;
+
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+
+  /* Packed fonts only, see tools/pack_font.py. The table holds the rows of the
+     glyphs, cropped to their bounding box and padded to whole bytes */
+  const sGLYPH *glyphs;
+  const uint8_t *codes;     /* characters of the font in ascending order */
+  const uint8_t *index;     /* glyph of every character */
+  uint16_t count;           /* number of characters */
   
 } sFONT;
 
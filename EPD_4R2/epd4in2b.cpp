@@ -47,6 +47,60 @@
 
 #include "epd4in2b.h"
 
+#include <string.h>
+
+/* Fast refresh waveforms, the pixels are driven to the new color in one phase */
+static const unsigned char lut_vcom0_quick[] = {
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+};
+
+static const unsigned char lut_ww_quick[] = {
+    0xA0, 0x0E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char lut_bw_quick[] = {
+    0xA0, 0x0E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char lut_wb_quick[] = {
+    0x50, 0x0E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char lut_bb_quick[] = {
+    0x50, 0x0E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 Epd::Epd(PinName mosi,
          PinName miso,
          PinName sclk,
@@ -59,6 +113,17 @@ Epd::Epd(PinName mosi,
 {
     width = EPD_WIDTH;
     height = EPD_HEIGHT;
+    shadow = NULL;
+    shadow_valid = false;
+    last_refresh_ms = 0;
+    last_busy_ms = 0;
+    refresh_mode = EPD_REFRESH_FULL;
+    lut_mode = EPD_REFRESH_FULL;
+    full_refresh_interval = EPD_FULL_REFRESH_INTERVAL;
+    fast_refresh_count = 0;
+    stream_x = 0;
+    stream_y = 0;
+    stream_w = 0;
 };
 
 int Epd::Init(void)
@@ -74,13 +139,77 @@ int Epd::Init(void)
     SendData(0x17);
     SendData(0x17);     //07 0f 17 1f 27 2F 37 2f
     SendCommand(POWER_ON);
-    WaitUntilIdle();
+    if (WaitUntilIdle() != 0) {
+        return -1;
+    }
     SendCommand(PANEL_SETTING);
     SendData(0x0F);     // LUT from OTP
+    lut_mode = EPD_REFRESH_FULL;
+    if (refresh_mode == EPD_REFRESH_FAST) {
+        SetLut(EPD_REFRESH_FAST);
+    }
     /* EPD hardware init end */
     return 0;
 }
 
+/**
+ *  @brief: load the waveforms for a refresh mode,
+ *          EPD_REFRESH_FULL selects the LUT from OTP again
+ */
+void Epd::SetLut(int mode)
+{
+    if (mode == EPD_REFRESH_FULL) {
+        SendCommand(PANEL_SETTING);
+        SendData(0x0F);     // LUT from OTP
+        lut_mode = EPD_REFRESH_FULL;
+        return;
+    }
+
+    SendCommand(PANEL_SETTING);
+    SendData(0xBF);     // LUT from register, black / white mode
+    SendCommand(PLL_CONTROL);
+    SendData(0x3C);     // 50Hz frame rate
+    SendCommand(RESOLUTION_SETTING);
+    SendData(EPD_WIDTH >> 8);
+    SendData(EPD_WIDTH & 0xff);
+    SendData(300 >> 8);     // the panel has 300 visible lines
+    SendData(300 & 0xff);
+
+    SendCommand(LUT_FOR_VCOM);
+    SendDataBlock(lut_vcom0_quick, sizeof(lut_vcom0_quick));
+    SendCommand(LUT_WHITE_TO_WHITE);
+    SendDataBlock(lut_ww_quick, sizeof(lut_ww_quick));
+    SendCommand(LUT_BLACK_TO_WHITE);
+    SendDataBlock(lut_bw_quick, sizeof(lut_bw_quick));
+    SendCommand(LUT_WHITE_TO_BLACK);
+    SendDataBlock(lut_wb_quick, sizeof(lut_wb_quick));
+    SendCommand(LUT_BLACK_TO_BLACK);
+    SendDataBlock(lut_bb_quick, sizeof(lut_bb_quick));
+    lut_mode = EPD_REFRESH_FAST;
+}
+
+/**
+ *  @brief: select EPD_REFRESH_FULL or EPD_REFRESH_FAST for the next refreshes
+ */
+void Epd::SetRefreshMode(int mode)
+{
+    refresh_mode = mode;
+}
+
+int Epd::GetRefreshMode(void)
+{
+    return refresh_mode;
+}
+
+/**
+ *  @brief: in fast refresh mode every interval-th refresh is a full refresh
+ *          to clear the ghosting. 0 disables the full refreshes.
+ */
+void Epd::SetFullRefreshInterval(int interval)
+{
+    full_refresh_interval = interval;
+}
+
 /**
  *  @brief: basic function for sending commands
  */
@@ -100,13 +229,35 @@ void Epd::SendData(unsigned char data)
 }
 
 /**
- *  @brief: Wait until the busy_pin goes HIGH
+ *  @brief: send a block of data with DC and CS held for the whole block
  */
-void Epd::WaitUntilIdle(void)
+void Epd::SendDataBlock(const unsigned char* data, size_t length)
 {
-    while(DigitalRead(m_busy) == 0) {      //0: busy, 1: idle
-        DelayMs(100);
-    }
+    DigitalWrite(m_dc, HIGH);
+    SpiTransferBlock(data, length);
+}
+
+/**
+ *  @brief: start sending a block of data in the background, see EpdIf::SpiTransferBlockAsync.
+ *          no other command or data may be sent until done was called.
+ */
+int Epd::SendDataBlockAsync(const unsigned char* data, size_t length, Callback<void()> done)
+{
+    DigitalWrite(m_dc, HIGH);
+    return SpiTransferBlockAsync(data, length, done);
+}
+
+/**
+ *  @brief: Wait until the busy_pin goes HIGH, the calling thread sleeps meanwhile.
+ *          the duration is taken from the kernel clock, so deep sleep stays unlocked.
+ *          returns -1 if the controller is still busy after EPD_BUSY_TIMEOUT_MS.
+ */
+int Epd::WaitUntilIdle(void)
+{
+    Kernel::Clock::time_point start = Kernel::Clock::now();
+    int ret = BusyWait(EPD_BUSY_TIMEOUT_MS);
+    last_busy_ms = std::chrono::duration_cast<std::chrono::milliseconds>(Kernel::Clock::now() - start).count();
+    return ret;
 }
 
 /**
@@ -131,8 +282,8 @@ void Epd::SetPartialWindow(const unsigned char* buffer_black, const unsigned cha
     SendCommand(PARTIAL_WINDOW);
     SendData(x >> 8);
     SendData(x & 0xf8);     // x should be the multiple of 8, the last 3 bit will always be ignored
-    SendData(((x & 0xf8) + w  - 1) >> 8);
-    SendData(((x & 0xf8) + w  - 1) | 0x07);
+    SendData(((x & ~0x07) + w  - 1) >> 8);
+    SendData(((x & ~0x07) + w  - 1) | 0x07);
     SendData(y >> 8);
     SendData(y & 0xff);
     SendData((y + l - 1) >> 8);
@@ -141,16 +292,12 @@ void Epd::SetPartialWindow(const unsigned char* buffer_black, const unsigned cha
     DelayMs(2);
     SendCommand(DATA_START_TRANSMISSION_1);
     if (buffer_black != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_black[i]);
-        }
+        SendDataBlock(buffer_black, w / 8 * l);
     }
     DelayMs(2);
     SendCommand(DATA_START_TRANSMISSION_2);
     if (buffer_red != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_red[i]);
-        }
+        SendDataBlock(buffer_red, w / 8 * l);
     }
     DelayMs(2);
     SendCommand(PARTIAL_OUT);
@@ -165,8 +312,8 @@ void Epd::SetPartialWindowBlack(const unsigned char* buffer_black, int x, int y,
     SendCommand(PARTIAL_WINDOW);
     SendData(x >> 8);
     SendData(x & 0xf8);     // x should be the multiple of 8, the last 3 bit will always be ignored
-    SendData(((x & 0xf8) + w  - 1) >> 8);
-    SendData(((x & 0xf8) + w  - 1) | 0x07);
+    SendData(((x & ~0x07) + w  - 1) >> 8);
+    SendData(((x & ~0x07) + w  - 1) | 0x07);
     SendData(y >> 8);
     SendData(y & 0xff);
     SendData((y + l - 1) >> 8);
@@ -181,12 +328,122 @@ void Epd::SetPartialWindowBlack(const unsigned char* buffer_black, int x, int y,
 #endif
 
     if (buffer_black != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_black[i]);
+        SendDataBlock(buffer_black, w / 8 * l);
+        UpdateShadow(buffer_black, w / 8, x, y, w, l);
+    }
+    DelayMs(2);
+    SendCommand(PARTIAL_OUT);
+}
+
+/**
+ *  @brief: transmit a region of a full frame buffer to the black part of SRAM.
+ *          frame_width is the width of the frame buffer in pixels,
+ *          x and w should be multiples of 8.
+ */
+void Epd::SetPartialWindowBlackRegion(const unsigned char* frame_black, int frame_width, int x, int y, int w, int l)
+{
+    SetPartialWindowBlackBand(frame_black, frame_width, 0, x, y, w, l);
+}
+
+/**
+ *  @brief: transmit a region of a band buffer to the black part of SRAM.
+ *          the band buffer holds full frame rows starting at band_y,
+ *          the region given by frame coordinates must lie within the band.
+ */
+void Epd::SetPartialWindowBlackBand(const unsigned char* band_black, int frame_width, int band_y, int x, int y, int w, int l)
+{
+    SendCommand(PARTIAL_IN);
+    SendCommand(PARTIAL_WINDOW);
+    SendData(x >> 8);
+    SendData(x & 0xf8);     // x should be the multiple of 8, the last 3 bit will always be ignored
+    SendData(((x & ~0x07) + w  - 1) >> 8);
+    SendData(((x & ~0x07) + w  - 1) | 0x07);
+    SendData(y >> 8);
+    SendData(y & 0xff);
+    SendData((y + l - 1) >> 8);
+    SendData((y + l - 1) & 0xff);
+    SendData(0x01);         // Gates scan both inside and outside of the partial window. (default)
+    DelayMs(2);
+
+#if defined(EPD_THREE_COLOR) && (EPD_THREE_COLOR == 1)
+    SendCommand(DATA_START_TRANSMISSION_1);
+#else
+    SendCommand(DATA_START_TRANSMISSION_2);
+#endif
+
+    if (band_black != NULL) {
+        const unsigned char* rows = &band_black[(y - band_y) * frame_width / 8];
+        if (x == 0 && w == frame_width) {
+            /* Full rows are contiguous in the frame buffer */
+            SendDataBlock(rows, w / 8 * l);
+        } else {
+            for (int j = 0; j < l; j++) {
+                SendDataBlock(&rows[(j * frame_width + x) / 8], w / 8);
+            }
         }
+        UpdateShadow(&rows[x / 8], frame_width / 8, x, y, w, l);
+    }
+    DelayMs(2);
+    SendCommand(PARTIAL_OUT);
+}
+
+/**
+ *  @brief: start streaming rows to a window of the black part of SRAM.
+ *          the rows are sent with StreamWindowRows() in the background, so the
+ *          caller can prepare the next rows meanwhile. no other command may be
+ *          sent until StreamWindowEnd() was called.
+ */
+void Epd::StreamWindowBegin(int x, int y, int w, int l)
+{
+    SendCommand(PARTIAL_IN);
+    SendCommand(PARTIAL_WINDOW);
+    SendData(x >> 8);
+    SendData(x & 0xf8);     // x should be the multiple of 8, the last 3 bit will always be ignored
+    SendData(((x & ~0x07) + w  - 1) >> 8);
+    SendData(((x & ~0x07) + w  - 1) | 0x07);
+    SendData(y >> 8);
+    SendData(y & 0xff);
+    SendData((y + l - 1) >> 8);
+    SendData((y + l - 1) & 0xff);
+    SendData(0x01);         // Gates scan both inside and outside of the partial window. (default)
+    DelayMs(2);
+
+#if defined(EPD_THREE_COLOR) && (EPD_THREE_COLOR == 1)
+    SendCommand(DATA_START_TRANSMISSION_1);
+#else
+    SendCommand(DATA_START_TRANSMISSION_2);
+#endif
+    stream_x = x & ~0x07;
+    stream_y = y;
+    stream_w = w;
+}
+
+/**
+ *  @brief: send the next count rows of the window, w / 8 bytes each.
+ *          waits for the rows sent before, then returns while the new rows
+ *          are still being sent. the rows must stay valid until the next
+ *          call. returns -1 if the rows before did not get sent.
+ */
+int Epd::StreamWindowRows(const unsigned char* rows, int count)
+{
+    if (SpiTransferWait(EPD_TRANSFER_TIMEOUT_MS) != 0) {
+        return -1;
     }
+    UpdateShadow(rows, stream_w / 8, stream_x, stream_y, stream_w, count);
+    stream_y += count;
+    return SendDataBlockAsync(rows, stream_w / 8 * count, Callback<void()>());
+}
+
+/**
+ *  @brief: wait for the last rows and close the window.
+ *          returns -1 if the rows did not get sent.
+ */
+int Epd::StreamWindowEnd(void)
+{
+    int ret = SpiTransferWait(EPD_TRANSFER_TIMEOUT_MS);
     DelayMs(2);
     SendCommand(PARTIAL_OUT);
+    return ret;
 }
 
 /**
@@ -198,8 +455,8 @@ void Epd::SetPartialWindowRed(const unsigned char* buffer_red, int x, int y, int
     SendCommand(PARTIAL_WINDOW);
     SendData(x >> 8);
     SendData(x & 0xf8);     // x should be the multiple of 8, the last 3 bit will always be ignored
-    SendData(((x & 0xf8) + w  - 1) >> 8);
-    SendData(((x & 0xf8) + w  - 1) | 0x07);
+    SendData(((x & ~0x07) + w  - 1) >> 8);
+    SendData(((x & ~0x07) + w  - 1) | 0x07);
     SendData(y >> 8);
     SendData(y & 0xff);
     SendData((y + l - 1) >> 8);
@@ -208,9 +465,7 @@ void Epd::SetPartialWindowRed(const unsigned char* buffer_red, int x, int y, int
     DelayMs(2);
     SendCommand(DATA_START_TRANSMISSION_2);
     if (buffer_red != NULL) {
-        for(int i = 0; i < w  / 8 * l; i++) {
-            SendData(buffer_red[i]);
-        }
+        SendDataBlock(buffer_red, w / 8 * l);
     }
     DelayMs(2);
     SendCommand(PARTIAL_OUT);
@@ -219,26 +474,21 @@ void Epd::SetPartialWindowRed(const unsigned char* buffer_red, int x, int y, int
 /**
  * @brief: refresh and displays the frame
  */
-void Epd::DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red)
+int Epd::DisplayFrame(const unsigned char* frame_buffer_black, const unsigned char* frame_buffer_red)
 {
     if (frame_buffer_black != NULL) {
         SendCommand(DATA_START_TRANSMISSION_1);
         DelayMs(2);
-        for (int i = 0; i < this->width / 8 * this->height; i++) {
-            SendData(*(frame_buffer_black + i));
-        }
+        SendDataBlock(frame_buffer_black, this->width / 8 * this->height);
         DelayMs(2);
     }
     if (frame_buffer_red != NULL) {
         SendCommand(DATA_START_TRANSMISSION_2);
         DelayMs(2);
-        for (int i = 0; i < this->width / 8 * this->height; i++) {
-            SendData(*(frame_buffer_red + i));
-        }
+        SendDataBlock(frame_buffer_red, this->width / 8 * this->height);
         DelayMs(2);
     }
-    SendCommand(DISPLAY_REFRESH);
-    WaitUntilIdle();
+    return DisplayFrame();
 }
 
 /**
@@ -248,26 +498,176 @@ void Epd::ClearFrame(void)
 {
     SendCommand(DATA_START_TRANSMISSION_1);
     DelayMs(2);
-    for(int i = 0; i < width / 8 * height; i++) {
-        SendData(0xFF);
-    }
+    DigitalWrite(m_dc, HIGH);
+    SpiTransferFill(0xFF, width / 8 * height);
     DelayMs(2);
     SendCommand(DATA_START_TRANSMISSION_2);
     DelayMs(2);
-    for(int i = 0; i < width / 8 * height; i++) {
-        SendData(0xFF);
-    }
+    DigitalWrite(m_dc, HIGH);
+    SpiTransferFill(0xFF, width / 8 * height);
     DelayMs(2);
+    if (shadow != NULL) {
+        memset(shadow, 0xFF, width / 8 * height);
+        shadow_valid = true;
+    }
 }
 
 /**
- * @brief: This displays the frame data from SRAM
+ * @brief: This displays the frame data from SRAM.
+ *         returns -1 if the refresh did not finish in time
  */
-void Epd::DisplayFrame(void)
+int Epd::DisplayFrame(void)
 {
+    /* Fast refreshes leave ghosting behind, clear it with a full refresh from time to time */
+    int mode = refresh_mode;
+    if (mode == EPD_REFRESH_FAST && full_refresh_interval > 0 && fast_refresh_count >= full_refresh_interval) {
+        mode = EPD_REFRESH_FULL;
+    }
+    if (mode != lut_mode) {
+        SetLut(mode);
+    }
+
     SendCommand(DISPLAY_REFRESH);
-    DelayMs(100);
-    WaitUntilIdle();
+    DelayMs(1);     // BUSY goes LOW right after the command
+    int ret = WaitUntilIdle();
+    last_refresh_ms = last_busy_ms + 1;
+
+    if (mode == EPD_REFRESH_FAST) {
+        fast_refresh_count++;
+    } else {
+        fast_refresh_count = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief: duration of the last display refresh in ms
+ */
+int Epd::GetLastRefreshTime(void)
+{
+    return last_refresh_ms;
+}
+
+/**
+ * @brief: find the first and last byte that differs between two rows,
+ *         the rows are compared by 32 bit words first.
+ *         returns false if the rows are equal.
+ */
+static bool FindChangedBytes(const unsigned char* a, const unsigned char* b, int count, int* first, int* last)
+{
+    uint32_t word_a, word_b;
+    int i = 0;
+    int j = count;
+
+    for (; i + 4 <= count; i += 4) {
+        memcpy(&word_a, &a[i], 4);
+        memcpy(&word_b, &b[i], 4);
+        if (word_a != word_b) {
+            break;
+        }
+    }
+    while (i < count && a[i] == b[i]) {
+        i++;
+    }
+    if (i == count) {
+        return false;
+    }
+
+    for (; j - 4 >= i; j -= 4) {
+        memcpy(&word_a, &a[j - 4], 4);
+        memcpy(&word_b, &b[j - 4], 4);
+        if (word_a != word_b) {
+            break;
+        }
+    }
+    while (a[j - 1] == b[j - 1]) {
+        j--;
+    }
+
+    *first = i;
+    *last = j - 1;
+    return true;
+}
+
+/**
+ * @brief: compares the frame with the shadow frame and only transmits the changed
+ *         row bands through partial windows, then refreshes the display.
+ *         without a valid shadow frame the full frame is transmitted.
+ *         returns the number of transmitted bands, 0 means nothing changed
+ *         and the display was not refreshed, -1 means the refresh failed.
+ */
+int Epd::DisplayFrameDiff(const unsigned char* frame_black)
+{
+    int line_bytes = width / 8;
+    int bands = 0;
+    int band_y0 = -1;
+    int band_y1 = 0;
+    int band_first = 0;
+    int band_last = 0;
+
+    if (shadow == NULL || !shadow_valid) {
+        SetPartialWindowBlack(frame_black, 0, 0, width, height);
+        return DisplayFrame() == 0 ? 1 : -1;
+    }
+
+    for (int y = 0; y < (int)height; y++) {
+        int first, last;
+        if (!FindChangedBytes(&frame_black[y * line_bytes], &shadow[y * line_bytes], line_bytes, &first, &last)) {
+            continue;
+        }
+        /* Close the current band, if the unchanged gap is too large */
+        if (band_y0 >= 0 && y - band_y1 - 1 > EPD_DIFF_BAND_GAP) {
+            SetPartialWindowBlackRegion(frame_black, width, band_first * 8, band_y0,
+                                        (band_last - band_first + 1) * 8, band_y1 - band_y0 + 1);
+            bands++;
+            band_y0 = -1;
+        }
+        if (band_y0 < 0) {
+            band_y0 = y;
+            band_first = first;
+            band_last = last;
+        } else {
+            band_first = first < band_first ? first : band_first;
+            band_last = last > band_last ? last : band_last;
+        }
+        band_y1 = y;
+    }
+    if (band_y0 >= 0) {
+        SetPartialWindowBlackRegion(frame_black, width, band_first * 8, band_y0,
+                                    (band_last - band_first + 1) * 8, band_y1 - band_y0 + 1);
+        bands++;
+    }
+
+    if (bands > 0 && DisplayFrame() != 0) {
+        return -1;
+    }
+    return bands;
+}
+
+/**
+ * @brief: set a buffer of width / 8 * height bytes for the shadow frame, or NULL to disable it.
+ *         the shadow frame is valid after the first full frame was transmitted.
+ */
+void Epd::SetShadowFrame(unsigned char* shadow_buffer)
+{
+    shadow = shadow_buffer;
+    shadow_valid = false;
+}
+
+/**
+ * @brief: copy transmitted black data into the shadow frame
+ */
+void Epd::UpdateShadow(const unsigned char* buffer, int line_bytes, int x, int y, int w, int l)
+{
+    if (shadow == NULL) {
+        return;
+    }
+    for (int j = 0; j < l; j++) {
+        memcpy(&shadow[(y + j) * (width / 8) + x / 8], &buffer[j * line_bytes], w / 8);
+    }
+    if (x == 0 && y == 0 && w == (int)width && l == (int)height) {
+        shadow_valid = true;
+    }
 }
 
 /**
@@ -284,6 +684,7 @@ void Epd::Sleep()
     WaitUntilIdle();
     SendCommand(DEEP_SLEEP);
     SendData(0xA5);     // check code
+    shadow_valid = false;
 }
 
 /**
@@ -59,6 +59,22 @@
 
 #define EPD_THREE_COLOR    0 
 
+// DisplayFrameDiff: changed rows closer than this are sent as one band
+#define EPD_DIFF_BAND_GAP  4
+
+// Longest time the controller may be busy, e.g. with a full refresh
+#define EPD_BUSY_TIMEOUT_MS 30000
+
+// Longest time a background block transfer may take
+#define EPD_TRANSFER_TIMEOUT_MS 1000
+
+// Refresh modes
+#define EPD_REFRESH_FULL    0   // LUT from OTP, flashes the panel, clears ghosting
+#define EPD_REFRESH_FAST    1   // LUT from register, sub-second update, ghosting adds up
+
+// In fast refresh mode every n-th refresh is done as full refresh
+#define EPD_FULL_REFRESH_INTERVAL   10
+
 // EPD2IN13B commands
 #define PANEL_SETTING                               0x00
 #define POWER_SETTING                               0x01
@@ -119,10 +135,15 @@ public:
         ;
     }
 
+    using EpdIf::SetSpiFrequency;
+    using EpdIf::SpiTransferBusy;
+
     int  Init(void);
     void SendCommand(unsigned char command);
     void SendData(unsigned char data);
-    void WaitUntilIdle(void);
+    void SendDataBlock(const unsigned char* data, size_t length);
+    int  SendDataBlockAsync(const unsigned char* data, size_t length, Callback<void()> done);
+    int  WaitUntilIdle(void);
     void Reset(void);
     void SetPartialWindow(const unsigned char* buffer_black,
                           const unsigned char* buffer_red,
@@ -135,21 +156,56 @@ public:
                                int y,
                                int w,
                                int l);
+    void SetPartialWindowBlackRegion(const unsigned char* frame_black,
+                                     int frame_width,
+                                     int x,
+                                     int y,
+                                     int w,
+                                     int l);
+    void SetPartialWindowBlackBand(const unsigned char* band_black,
+                                   int frame_width,
+                                   int band_y,
+                                   int x,
+                                   int y,
+                                   int w,
+                                   int l);
+    void StreamWindowBegin(int x, int y, int w, int l);
+    int  StreamWindowRows(const unsigned char* rows, int count);
+    int  StreamWindowEnd(void);
     void SetPartialWindowRed(const unsigned char* buffer_red,
                              int x,
                              int y,
                              int w,
                              int l);
-    void DisplayFrame(const unsigned char* frame_buffer_black,
+    int  DisplayFrame(const unsigned char* frame_buffer_black,
                       const unsigned char* frame_buffer_red);
-    void DisplayFrame(void);
+    int  DisplayFrame(void);
+    int  GetLastRefreshTime(void);
+    void SetRefreshMode(int mode);
+    int  GetRefreshMode(void);
+    void SetFullRefreshInterval(int interval);
+    int  DisplayFrameDiff(const unsigned char* frame_black);
+    void SetShadowFrame(unsigned char* shadow_buffer);
     void ClearFrame(void);
     void Sleep(void);
     void PwrOn(void);
     void PwrOff(void);
 
 private:
+    unsigned char* shadow;      // copy of the black frame in the panel SRAM, optional
+    bool shadow_valid;
+    int last_refresh_ms;        // duration of the last display refresh
+    int last_busy_ms;           // duration of the last wait for the controller
+    int refresh_mode;
+    int lut_mode;               // refresh mode the loaded LUT is made for
+    int full_refresh_interval;
+    int fast_refresh_count;     // fast refreshes since the last full refresh
+    int stream_x;               // window of the running stream
+    int stream_y;               // next row of the window to be sent
+    int stream_w;
 
+    void SetLut(int mode);
+    void UpdateShadow(const unsigned char* buffer, int line_bytes, int x, int y, int w, int l);
 };
 
 #endif /* EPD4IN2B_H */
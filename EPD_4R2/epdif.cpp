@@ -66,10 +66,13 @@ EpdIf::EpdIf(PinName mosi,
     m_cs   = new DigitalOut(cs);
     m_dc   = new DigitalOut(dc);
     m_rst  = new DigitalOut(rst);
-    m_busy = new DigitalIn(busy);
+    m_busy = new InterruptIn(busy);
     m_pwr  = new DigitalOut(pwr);
     p_mosi = mosi;
     p_sclk = sclk;
+    m_frequency = EPD_SPI_FREQUENCY;
+    m_busy_transfer = false;
+    m_busy->rise(callback(this, &EpdIf::BusyIdleIrq));
 }
 
 void EpdIf::DigitalWrite(DigitalOut* pin, int value)
@@ -83,11 +86,47 @@ int EpdIf::DigitalRead(DigitalIn* pin)
     return ret;
 }
 
+int EpdIf::DigitalRead(InterruptIn* pin)
+{
+    int ret = *pin;
+    return ret;
+}
+
 void EpdIf::DelayMs(unsigned int delaytime)
 {
     ThisThread::sleep_for(delaytime);
 }
 
+/**
+ *  @brief: block the calling thread until the BUSY pin goes HIGH (idle).
+ *          the thread sleeps on an event flag set by the pin interrupt,
+ *          so the MCU can enter low power sleep meanwhile. the time is taken
+ *          from the kernel clock, a running Timer would lock deep sleep.
+ *          returns -1 if the pin is still LOW after timeout_ms.
+ */
+int EpdIf::BusyWait(unsigned int timeout_ms)
+{
+    Kernel::Clock::time_point start = Kernel::Clock::now();
+
+    m_busy_flags.clear(EPD_BUSY_IDLE_FLAG);
+    while (DigitalRead(m_busy) == 0) {      //0: busy, 1: idle
+        unsigned int elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(Kernel::Clock::now() - start).count();
+        if (elapsed_ms >= timeout_ms) {
+            return -1;
+        }
+        uint32_t flags = m_busy_flags.wait_any(EPD_BUSY_IDLE_FLAG, timeout_ms - elapsed_ms);
+        if (flags & osFlagsError) {
+            return DigitalRead(m_busy) ? 0 : -1;
+        }
+    }
+    return 0;
+}
+
+void EpdIf::BusyIdleIrq(void)
+{
+    m_busy_flags.set(EPD_BUSY_IDLE_FLAG);
+}
+
 void EpdIf::SpiTransfer(unsigned char data)
 {
     *m_cs = 0;
@@ -95,13 +134,127 @@ void EpdIf::SpiTransfer(unsigned char data)
     *m_cs = 1;
 }
 
+/**
+ *  @brief: transfer a block of bytes, CS is held low for the whole block
+ */
+void EpdIf::SpiTransferBlock(const unsigned char* data, size_t length)
+{
+    if (length == 0) {
+        return;
+    }
+    *m_cs = 0;
+    m_spi->write((const char*)data, length, NULL, 0);
+    *m_cs = 1;
+}
+
+/**
+ *  @brief: transfer the same byte length times, CS is held low for all of them
+ */
+void EpdIf::SpiTransferFill(unsigned char data, size_t length)
+{
+    unsigned char chunk[32];
+
+    if (length == 0) {
+        return;
+    }
+    memset(chunk, data, sizeof(chunk));
+    *m_cs = 0;
+    while (length > 0) {
+        size_t count = length < sizeof(chunk) ? length : sizeof(chunk);
+        m_spi->write((const char*)chunk, count, NULL, 0);
+        length -= count;
+    }
+    *m_cs = 1;
+}
+
+/**
+ *  @brief: start the transfer of a block of bytes in the background (DMA if available).
+ *          done is called from interrupt context when the block was sent.
+ *          the data must stay valid until then. without asynchronous SPI support
+ *          of the target the block is sent right away.
+ *          returns -1 if another block transfer is still running.
+ */
+int EpdIf::SpiTransferBlockAsync(const unsigned char* data, size_t length, Callback<void()> done)
+{
+    if (m_busy_transfer) {
+        return -1;
+    }
+#if DEVICE_SPI_ASYNCH
+    if (length > 0) {
+        m_busy_transfer = true;
+        m_transfer_done = done;
+        *m_cs = 0;
+        if (m_spi->transfer(data, (int)length, (unsigned char*)NULL, 0,
+                            callback(this, &EpdIf::SpiTransferDone), SPI_EVENT_COMPLETE) == 0) {
+            return 0;
+        }
+        /* The peripheral is busy, fall back to the blocking transfer */
+        *m_cs = 1;
+        m_busy_transfer = false;
+    }
+#endif
+    SpiTransferBlock(data, length);
+    if (done) {
+        done();
+    }
+    return 0;
+}
+
+/**
+ *  @brief: true while a block transfer started by SpiTransferBlockAsync is running
+ */
+bool EpdIf::SpiTransferBusy(void)
+{
+    return m_busy_transfer;
+}
+
+/**
+ *  @brief: block the calling thread until the block transfer started by
+ *          SpiTransferBlockAsync is done. returns -1 if it is still running
+ *          after timeout_ms.
+ */
+int EpdIf::SpiTransferWait(unsigned int timeout_ms)
+{
+    while (m_busy_transfer) {
+        uint32_t flags = m_busy_flags.wait_any(EPD_TRANSFER_DONE_FLAG, timeout_ms);
+        if (flags & osFlagsError) {
+            return m_busy_transfer ? -1 : 0;
+        }
+    }
+    return 0;
+}
+
+void EpdIf::SpiTransferDone(int event)
+{
+    *m_cs = 1;
+    m_busy_transfer = false;
+    if (m_transfer_done) {
+        m_transfer_done();
+    }
+    m_busy_flags.set(EPD_TRANSFER_DONE_FLAG);
+}
+
 int EpdIf::IfInit(void)
 {
     m_spi->format(8,0);
-    m_spi->frequency(2000000);
+    m_spi->frequency(m_frequency);
     return 0;
 }
 
+/**
+ *  @brief: set the SPI clock, limited to what the display controller supports.
+ *          returns the clock in use.
+ */
+int EpdIf::SetSpiFrequency(int frequency)
+{
+    if (frequency > EPD_SPI_MAX_FREQUENCY) {
+        frequency = EPD_SPI_MAX_FREQUENCY;
+    }
+    m_frequency = frequency;
+    m_spi->frequency(m_frequency);
+    return m_frequency;
+}
+
 void EpdIf::all_off(void)
 {
     m_mosi = new DigitalOut(p_mosi);
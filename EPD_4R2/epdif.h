@@ -51,6 +51,20 @@
 
 #include "mbed.h"
 
+// SPI clock of the display interface
+#ifndef EPD_SPI_FREQUENCY
+#define EPD_SPI_FREQUENCY       2000000
+#endif
+
+// The controller needs a serial write cycle of at least 100 ns
+#define EPD_SPI_MAX_FREQUENCY   10000000
+
+// Event flag set by the BUSY pin interrupt, when the controller gets idle
+#define EPD_BUSY_IDLE_FLAG      0x01
+
+// Event flag set by the SPI interrupt, when a background block transfer is done
+#define EPD_TRANSFER_DONE_FLAG  0x02
+
 class EpdIf
 {
 public:
@@ -69,22 +83,39 @@ public:
     }
 
     int  IfInit(void);
+    int  SetSpiFrequency(int frequency);
     void DigitalWrite(DigitalOut* pin, int value);
     int  DigitalRead(DigitalIn* pin);
+    int  DigitalRead(InterruptIn* pin);
     void DelayMs(unsigned int delaytime);
+    int  BusyWait(unsigned int timeout_ms);
     void SpiTransfer(unsigned char data);
+    void SpiTransferBlock(const unsigned char* data, size_t length);
+    void SpiTransferFill(unsigned char data, size_t length);
+    int  SpiTransferBlockAsync(const unsigned char* data, size_t length, Callback<void()> done);
+    bool SpiTransferBusy(void);
+    int  SpiTransferWait(unsigned int timeout_ms);
     void all_off(void);
 
     SPI* m_spi;
     DigitalOut* m_cs;
     DigitalOut* m_dc;
     DigitalOut* m_rst;
-    DigitalIn*  m_busy;
+    InterruptIn* m_busy;
     DigitalOut* m_pwr;
     PinName p_mosi;
     PinName p_sclk;
     DigitalOut* m_mosi;
     DigitalOut* m_sclk;
+
+private:
+    int m_frequency;
+    volatile bool m_busy_transfer;
+    Callback<void()> m_transfer_done;
+    EventFlags m_busy_flags;
+
+    void SpiTransferDone(int event);
+    void BusyIdleIrq(void);
 };
 
 #endif
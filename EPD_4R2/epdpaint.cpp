@@ -27,41 +27,220 @@
 //#include <avr/pgmspace.h>  by JH1PJL for mbed-os5 Apr.28,2019
 #include "epdpaint.h"
 
-Paint::Paint(unsigned char* image, int width, int height)
+#include <string.h>
+
+
+/**
+ *  @brief: find the glyph of a character of a packed font by binary search,
+ *          returns NULL if the font has no such character.
+ */
+const sGLYPH* FindGlyph(const sFONT* font, char ascii_char)
+{
+    int low = 0;
+    int high = font->count - 1;
+
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        if (font->codes[middle] == (unsigned char)ascii_char) {
+            return &font->glyphs[font->index[middle]];
+        }
+        if (font->codes[middle] < (unsigned char)ascii_char) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return NULL;
+}
+
+/**
+ *  @brief: pixels from a character to the next one. Packed fonts are
+ *          proportional, characters they miss advance like a blank.
+ */
+int GetCharAdvance(const sFONT* font, char ascii_char)
+{
+    if (font->glyphs == NULL) {
+        return font->Width;
+    }
+    const sGLYPH* glyph = FindGlyph(font, ascii_char);
+    return glyph != NULL ? glyph->Advance : font->glyphs[0].Advance;
+}
+
+PaintFrame::PaintFrame(unsigned char* image, int width, int height)
 {
-    this->rotate = ROTATE_0;
     this->image = image;
     /* 1 byte = 8 pixels, so the width should be the multiple of 8 */
     this->width = width % 8 ? width + 8 - (width % 8) : width;
     this->height = height;
+    this->band_y = 0;
+    this->band_height = height;
+    ClearDirtyRect();
 }
 
-Paint::~Paint()
+/**
+ *  @brief: this adds a rectangle by absolute coordinates to the dirty region.
+ *          the dirty region is the union of everything drawn since the last
+ *          ClearDirtyRect(), widened to whole bytes in x.
+ *          call this after writing to the image buffer directly.
+ */
+void PaintFrame::AddDirtyRect(int x0, int y0, int x1, int y1)
 {
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (y0 < 0) {
+        y0 = 0;
+    }
+    if (x1 >= this->width) {
+        x1 = this->width - 1;
+    }
+    if (y1 >= this->height) {
+        y1 = this->height - 1;
+    }
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    x0 &= ~0x07;
+    x1 |= 0x07;
+
+    if (this->dirty_x0 > this->dirty_x1) {
+        this->dirty_x0 = x0;
+        this->dirty_y0 = y0;
+        this->dirty_x1 = x1;
+        this->dirty_y1 = y1;
+        return;
+    }
+    if (x0 < this->dirty_x0) {
+        this->dirty_x0 = x0;
+    }
+    if (y0 < this->dirty_y0) {
+        this->dirty_y0 = y0;
+    }
+    if (x1 > this->dirty_x1) {
+        this->dirty_x1 = x1;
+    }
+    if (y1 > this->dirty_y1) {
+        this->dirty_y1 = y1;
+    }
 }
 
 /**
- *  @brief: clear the image
+ *  @brief: this returns the dirty region by absolute coordinates.
+ *          x and w are multiples of 8, returns false if nothing was drawn.
  */
-void Paint::Clear(int colored)
+bool PaintFrame::GetDirtyRect(int* x, int* y, int* w, int* h)
 {
-    for (int x = 0; x < this->width; x++) {
-        for (int y = 0; y < this->height; y++) {
-            DrawAbsolutePixel(x, y, colored);
-        }
+    if (this->dirty_x0 > this->dirty_x1) {
+        return false;
     }
+    *x = this->dirty_x0;
+    *y = this->dirty_y0;
+    *w = this->dirty_x1 - this->dirty_x0 + 1;
+    *h = this->dirty_y1 - this->dirty_y0 + 1;
+    return true;
+}
+
+/**
+ *  @brief: this resets the dirty region, e.g. after it was sent to the display
+ */
+void PaintFrame::ClearDirtyRect(void)
+{
+    this->dirty_x0 = 0;
+    this->dirty_y0 = 0;
+    this->dirty_x1 = -1;
+    this->dirty_y1 = -1;
+}
+
+/**
+ *  @brief: Getters and Setters
+ */
+unsigned char* PaintFrame::GetImage(void)
+{
+    return this->image;
+}
+
+/**
+ *  @brief: draw into another buffer of the same size from now on,
+ *          e.g. while the last one is still being sent to the display
+ */
+void PaintFrame::SetImage(unsigned char* image)
+{
+    this->image = image;
+}
+
+int PaintFrame::GetWidth(void)
+{
+    return this->width;
+}
+
+void PaintFrame::SetWidth(int width)
+{
+    this->width = width % 8 ? width + 8 - (width % 8) : width;
+}
+
+int PaintFrame::GetHeight(void)
+{
+    return this->height;
+}
+
+void PaintFrame::SetHeight(int height)
+{
+    this->height = height;
+    this->band_y = 0;
+    this->band_height = height;
+}
+
+/**
+ *  @brief: render the frame band by band with a small buffer. the buffer holds
+ *          the given rows starting at absolute row y, drawing outside is clipped.
+ *          draw the frame again for every band, the coordinates stay the same.
+ */
+void PaintFrame::SetBand(int y, int rows)
+{
+    if (y < 0) {
+        y = 0;
+    }
+    if (y + rows > this->height) {
+        rows = this->height - y;
+    }
+    this->band_y = y;
+    this->band_height = rows > 0 ? rows : 0;
+}
+
+int PaintFrame::GetBandY(void)
+{
+    return this->band_y;
+}
+
+int PaintFrame::GetBandHeight(void)
+{
+    return this->band_height;
+}
+
+/**
+ *  @brief: clear the image, only the rows of the band are in the buffer
+ */
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::Clear(int colored)
+{
+    int set_bits = Polarity ? colored : !colored;
+    memset(this->image, set_bits ? 0xFF : 0x00, this->width / 8 * this->band_height);
+    AddDirtyRect(0, this->band_y, this->width - 1, this->band_y + this->band_height - 1);
 }
 
 /**
  *  @brief: this draws a pixel by absolute coordinates.
  *          this function won't be affected by the rotate parameter.
  */
-void Paint::DrawAbsolutePixel(int x, int y, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawAbsolutePixel(int x, int y, int colored)
 {
-    if (x < 0 || x >= this->width || y < 0 || y >= this->height) {
+    if (x < 0 || x >= this->width || y < this->band_y || y >= this->band_y + this->band_height) {
         return;
     }
-    if (IF_INVERT_COLOR) {
+    AddDirtyRect(x, y, x, y);
+    y -= this->band_y;
+    if (Polarity) {
         if (colored) {
             image[(x + y * this->width) / 8] |= 0x80 >> (x % 8);
         } else {
@@ -77,91 +256,429 @@ void Paint::DrawAbsolutePixel(int x, int y, int colored)
 }
 
 /**
- *  @brief: Getters and Setters
+ *  @brief: this fills a rectangle by absolute coordinates, both corners included.
+ *          the rectangle is clipped once, the edge bytes of every row are
+ *          written with a mask and the bytes in between with memset.
+ *          this function won't be affected by the rotate parameter.
  */
-unsigned char* Paint::GetImage(void)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawAbsoluteFilledRectangle(int x0, int y0, int x1, int y1, int colored)
 {
-    return this->image;
-}
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (y0 < this->band_y) {
+        y0 = this->band_y;
+    }
+    if (x1 >= this->width) {
+        x1 = this->width - 1;
+    }
+    if (y1 >= this->band_y + this->band_height) {
+        y1 = this->band_y + this->band_height - 1;
+    }
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    AddDirtyRect(x0, y0, x1, y1);
 
-int Paint::GetWidth(void)
-{
-    return this->width;
-}
+    int set_bits = Polarity ? colored : !colored;
+    unsigned char fill = set_bits ? 0xFF : 0x00;
+    int line_bytes = this->width / 8;
+    int first = x0 / 8;
+    int last = x1 / 8;
+    unsigned char first_mask = 0xFF >> (x0 % 8);
+    unsigned char last_mask = 0xFF << (7 - x1 % 8);
 
-void Paint::SetWidth(int width)
-{
-    this->width = width % 8 ? width + 8 - (width % 8) : width;
+    /* Full rows are contiguous in the buffer */
+    if (first_mask == 0xFF && last_mask == 0xFF && first == 0 && last == line_bytes - 1) {
+        memset(&this->image[(y0 - this->band_y) * line_bytes], fill, (y1 - y0 + 1) * line_bytes);
+        return;
+    }
+
+    if (first == last) {
+        first_mask &= last_mask;
+    }
+
+    unsigned char* row = &this->image[(y0 - this->band_y) * line_bytes];
+    for (int y = y0; y <= y1; y++, row += line_bytes) {
+        if (set_bits) {
+            row[first] |= first_mask;
+        } else {
+            row[first] &= ~first_mask;
+        }
+        if (first == last) {
+            continue;
+        }
+        if (last - first > 1) {
+            memset(&row[first + 1], fill, last - first - 1);
+        }
+        if (set_bits) {
+            row[last] |= last_mask;
+        } else {
+            row[last] &= ~last_mask;
+        }
+    }
 }
 
-int Paint::GetHeight(void)
+/**
+ *  @brief: this draws a pixel by the coordinates
+ */
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawPixel(int x, int y, int colored)
 {
-    return this->height;
+    if (MapPixel(&x, &y)) {
+        DrawAbsolutePixel(x, y, colored);
+    }
 }
 
-void Paint::SetHeight(int height)
+/**
+ *  @brief: this maps the coordinates to absolute coordinates by the rotate parameter,
+ *          returns false if the pixel is outside the image.
+ */
+template <int Rotation, int Polarity>
+bool BasicPaint<Rotation, Polarity>::MapPixel(int* x, int* y)
 {
-    this->height = height;
+    int point_temp;
+    if (Rotation == ROTATE_0) {
+        if(*x < 0 || *x >= this->width || *y < 0 || *y >= this->height) {
+            return false;
+        }
+        return true;
+    } else if (Rotation == ROTATE_90) {
+        if(*x < 0 || *x >= this->height || *y < 0 || *y >= this->width) {
+            return false;
+        }
+        point_temp = *x;
+        *x = this->width - *y;
+        *y = point_temp;
+        return true;
+    } else if (Rotation == ROTATE_180) {
+        if(*x < 0 || *x >= this->width || *y < 0 || *y >= this->height) {
+            return false;
+        }
+        *x = this->width - *x;
+        *y = this->height - *y;
+        return true;
+    } else if (Rotation == ROTATE_270) {
+        if(*x < 0 || *x >= this->height || *y < 0 || *y >= this->width) {
+            return false;
+        }
+        point_temp = *x;
+        *x = *y;
+        *y = this->height - point_temp;
+        return true;
+    }
+    return false;
 }
 
-int Paint::GetRotate(void)
+/**
+ *  @brief: this fills a rectangle by the coordinates, both corners included.
+ *          the corners are clipped and mapped to absolute coordinates
+ *          the same way DrawPixel maps a single pixel.
+ */
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::FillRectangle(int x0, int y0, int x1, int y1, int colored)
 {
-    return this->rotate;
+    int max_x = this->width;
+    int max_y = this->height;
+    if (Rotation == ROTATE_90 || Rotation == ROTATE_270) {
+        max_x = this->height;
+        max_y = this->width;
+    }
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (y0 < 0) {
+        y0 = 0;
+    }
+    if (x1 >= max_x) {
+        x1 = max_x - 1;
+    }
+    if (y1 >= max_y) {
+        y1 = max_y - 1;
+    }
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+
+    if (Rotation == ROTATE_0) {
+        DrawAbsoluteFilledRectangle(x0, y0, x1, y1, colored);
+    } else if (Rotation == ROTATE_90) {
+        DrawAbsoluteFilledRectangle(this->width - y1, x0, this->width - y0, x1, colored);
+    } else if (Rotation == ROTATE_180) {
+        DrawAbsoluteFilledRectangle(this->width - x1, this->height - y1,
+                                    this->width - x0, this->height - y0, colored);
+    } else if (Rotation == ROTATE_270) {
+        DrawAbsoluteFilledRectangle(y0, this->height - x1, y1, this->height - x0, colored);
+    }
 }
 
-void Paint::SetRotate(int rotate)
+/**
+ *  @brief: this draws the set bits of a 1bpp row (msb first) by absolute coordinates,
+ *          cleared bits leave the buffer untouched. every source byte is shifted
+ *          into two buffer bytes, bits outside the buffer are clipped.
+ */
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawAbsoluteBits(int x, int y, const unsigned char* bits, int count, int colored)
 {
-    this->rotate = rotate;
+    if (y < this->band_y || y >= this->band_y + this->band_height || count <= 0) {
+        return;
+    }
+
+    int set_bits = Polarity ? colored : !colored;
+    int line_bytes = this->width / 8;
+    unsigned char* row = &this->image[(y - this->band_y) * line_bytes];
+    int shift = x & 0x07;
+    int index = (x - shift) / 8;    /* rounds down for negative x as well */
+    int src_bytes = (count + 7) / 8;
+
+    AddDirtyRect(x, y, x + count - 1, y);
+    for (int i = 0; i < src_bytes; i++, index++) {
+        unsigned char data = bits[i];
+        if (i == src_bytes - 1 && count % 8) {
+            data &= 0xFF << (8 - count % 8);
+        }
+        if (data == 0x00) {
+            continue;
+        }
+        unsigned char high = data >> shift;
+        unsigned char low = shift ? (unsigned char)(data << (8 - shift)) : 0x00;
+        if (index >= 0 && index < line_bytes) {
+            if (set_bits) {
+                row[index] |= high;
+            } else {
+                row[index] &= ~high;
+            }
+        }
+        if (low != 0x00 && index + 1 >= 0 && index + 1 < line_bytes) {
+            if (set_bits) {
+                row[index + 1] |= low;
+            } else {
+                row[index + 1] &= ~low;
+            }
+        }
+    }
 }
 
 /**
- *  @brief: this draws a pixel by the coordinates
+ *  @brief: this draws a scaled 1bpp bitmap by absolute coordinates, see DrawScaledBitmap().
+ *          the first buffer row of a bitmap row is expanded run by run into whole
+ *          bytes, the other scale - 1 rows are copies of it. rows outside the band
+ *          and pixels outside the buffer are clipped.
  */
-void Paint::DrawPixel(int x, int y, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawAbsoluteScaledBitmap(int x, int y, const unsigned char* bitmap,
+                                                              int width, int height, int line_bits,
+                                                              int scale, int colored)
 {
-    int point_temp;
-    if (this->rotate == ROTATE_0) {
-        if(x < 0 || x >= this->width || y < 0 || y >= this->height) {
-            return;
-        }
-        DrawAbsolutePixel(x, y, colored);
-    } else if (this->rotate == ROTATE_90) {
-        if(x < 0 || x >= this->height || y < 0 || y >= this->width) {
-            return;
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < this->band_y ? this->band_y : y;
+    int x1 = x + width * scale - 1;
+    int y1 = y + height * scale - 1;
+    if (x1 >= this->width) {
+        x1 = this->width - 1;
+    }
+    if (y1 >= this->band_y + this->band_height) {
+        y1 = this->band_y + this->band_height - 1;
+    }
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    AddDirtyRect(x0, y0, x1, y1);
+
+    /* Set bits of the bitmap become set bits of the buffer, if colored sets them */
+    unsigned char flip = (Polarity ? colored : !colored) ? 0x00 : 0xFF;
+    int line_bytes = this->width / 8;
+    int first = x0 / 8;
+    int last = x1 / 8;
+    unsigned char first_mask = 0xFF >> (x0 % 8);
+    unsigned char last_mask = 0xFF << (7 - x1 % 8);
+    if (first == last) {
+        first_mask &= last_mask;
+        last_mask = first_mask;
+    }
+
+    unsigned char* row = &this->image[(y0 - this->band_y) * line_bytes];
+    const unsigned char* expanded = NULL;
+    int expanded_y = -1;
+    for (int j = y0; j <= y1; j++, row += line_bytes) {
+        int src_y = (j - y) / scale;
+        if (src_y == expanded_y) {
+            /* Same bitmap row as the buffer row before */
+            row[first] = (row[first] & ~first_mask) | (expanded[first] & first_mask);
+            if (last > first) {
+                if (last - first > 1) {
+                    memcpy(&row[first + 1], &expanded[first + 1], last - first - 1);
+                }
+                row[last] = (row[last] & ~last_mask) | (expanded[last] & last_mask);
+            }
+            continue;
         }
-        point_temp = x;
-        x = this->width - y;
-        y = point_temp;
-        DrawAbsolutePixel(x, y, colored);
-    } else if (this->rotate == ROTATE_180) {
-        if(x < 0 || x >= this->width || y < 0 || y >= this->height) {
-            return;
+
+        int bit = src_y * line_bits + (x0 - x) / scale;
+        int run = scale - (x0 - x) % scale;     /* pixels left of the current bit */
+        int index = first;
+        int count = x0 % 8;                     /* bits of value in use */
+        unsigned char value = 0x00;
+        for (int px = x0; px <= x1; bit++, run = scale) {
+            int set = bitmap[bit / 8] & (0x80 >> (bit % 8));
+            if (run > x1 - px + 1) {
+                run = x1 - px + 1;
+            }
+            px += run;
+            while (run > 0) {
+                int take = run < 8 - count ? run : 8 - count;
+                if (set) {
+                    value |= (0xFF >> count) & (0xFF << (8 - count - take));
+                }
+                count += take;
+                run -= take;
+                if (count == 8 || px > x1) {
+                    unsigned char mask = 0xFF;
+                    if (index == first) {
+                        mask &= first_mask;
+                    }
+                    if (index == last) {
+                        mask &= last_mask;
+                    }
+                    row[index] = (row[index] & ~mask) | ((value ^ flip) & mask);
+                    index++;
+                    count = 0;
+                    value = 0x00;
+                }
+            }
         }
-        x = this->width - x;
-        y = this->height - y;
-        DrawAbsolutePixel(x, y, colored);
-    } else if (this->rotate == ROTATE_270) {
-        if(x < 0 || x >= this->height || y < 0 || y >= this->width) {
-            return;
+        expanded = row;
+        expanded_y = src_y;
+    }
+}
+
+/**
+ *  @brief: this draws the region of an image by absolute coordinates, see DrawImage().
+ *          the region is clipped once, then every buffer byte of a row is made
+ *          of two neighbouring image bytes shifted into place and combined with
+ *          the buffer under the mask of the edge bytes.
+ */
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawAbsoluteImage(const unsigned char* image, int line_bytes,
+                                                       int src_x, int src_y, int x, int y,
+                                                       int width, int height, int op)
+{
+    if (x < 0) {
+        src_x -= x;
+        width += x;
+        x = 0;
+    }
+    if (y < this->band_y) {
+        src_y += this->band_y - y;
+        height -= this->band_y - y;
+        y = this->band_y;
+    }
+    if (x + width > this->width) {
+        width = this->width - x;
+    }
+    if (y + height > this->band_y + this->band_height) {
+        height = this->band_y + this->band_height - y;
+    }
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    AddDirtyRect(x, y, x + width - 1, y + height - 1);
+
+    /* Without inverted colors a colored pixel is a cleared bit, XOR inverts in either polarity */
+    unsigned char flip = Polarity || op == IMAGE_XOR ? 0x00 : 0xFF;
+    if (!Polarity && op == IMAGE_OR) {
+        op = IMAGE_AND;
+    } else if (!Polarity && op == IMAGE_AND) {
+        op = IMAGE_OR;
+    }
+
+    int buffer_bytes = this->width / 8;
+    int first = x / 8;
+    int last = (x + width - 1) / 8;
+    unsigned char first_mask = 0xFF >> (x % 8);
+    unsigned char last_mask = 0xFF << (7 - (x + width - 1) % 8);
+    if (first == last) {
+        first_mask &= last_mask;
+    }
+
+    /* The image bit of the first bit of the first buffer byte, up to 7 bits before src_x */
+    int start = src_x - x % 8;
+    int start_byte = (start + 8) / 8 - 1;
+    int shift = start - start_byte * 8;
+    int src_first = src_x / 8;
+    int src_last = (src_x + width - 1) / 8;
+
+    unsigned char* row = &this->image[(y - this->band_y) * buffer_bytes];
+    for (int j = 0; j < height; j++, row += buffer_bytes) {
+        const unsigned char* src = &image[(src_y + j) * line_bytes];
+        int index = start_byte;
+        unsigned char high = index >= src_first ? src[index] : 0x00;
+
+        for (int i = first; i <= last; i++) {
+            unsigned char low = ++index <= src_last ? src[index] : 0x00;
+            unsigned char data = shift ? (high << shift) | (low >> (8 - shift)) : high;
+            unsigned char mask = i == first ? first_mask : (i == last ? last_mask : 0xFF);
+            high = low;
+
+            data ^= flip;
+            if (op == IMAGE_OR) {
+                row[i] |= data & mask;
+            } else if (op == IMAGE_AND) {
+                row[i] &= data | ~mask;
+            } else if (op == IMAGE_XOR) {
+                row[i] ^= data & mask;
+            } else {
+                row[i] = (row[i] & ~mask) | (data & mask);
+            }
         }
-        point_temp = x;
-        x = y;
-        y = this->height - point_temp;
-        DrawAbsolutePixel(x, y, colored);
     }
 }
 
 /**
  *  @brief: this draws a charactor on the frame buffer but not refresh
  */
-void Paint::DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored)
 {
     int i, j;
-    unsigned int char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-    const unsigned char* ptr = &font->table[char_offset];
+    int width = font->Width;
+    int height = font->Height;
+    int line_bytes = width / 8 + (width % 8 ? 1 : 0);
+    const unsigned char* ptr;
 
-    for (j = 0; j < font->Height; j++) {
-        for (i = 0; i < font->Width; i++) {
+    if (font->glyphs != NULL) {
+        /* Packed font, only the bounding box of the glyph is stored */
+        const sGLYPH* glyph = FindGlyph(font, ascii_char);
+        if (glyph == NULL) {
+            return;
+        }
+        x += glyph->X;
+        y += glyph->Y;
+        width = glyph->Width;
+        height = glyph->Height;
+        line_bytes = (width + 7) / 8;
+        ptr = &font->table[glyph->Offset];
+    } else {
+        unsigned int char_offset = (ascii_char - ' ') * height * line_bytes;
+        ptr = &font->table[char_offset];
+    }
+
+    if (Rotation == ROTATE_0) {
+        /* Glyph rows are blitted byte-wise, rows outside the band are skipped */
+        if (x >= this->width || x + width <= 0) {
+            return;
+        }
+        j = y < this->band_y ? this->band_y - y : 0;
+        for (ptr += j * line_bytes; j < height && y + j < this->band_y + this->band_height; j++) {
+            DrawAbsoluteBits(x, y + j, ptr, width, colored);
+            ptr += line_bytes;
+        }
+        return;
+    }
+
+    for (j = 0; j < height; j++) {
+        for (i = 0; i < width; i++) {
             if (*ptr & (0x80 >> (i % 8))) {
                 DrawPixel(x + i, y + j, colored);
             }
@@ -169,7 +686,7 @@ void Paint::DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored)
                 ptr++;
             }
         }
-        if (font->Width % 8 != 0) {
+        if (width % 8 != 0) {
             ptr++;
         }
     }
@@ -178,7 +695,8 @@ void Paint::DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored)
 /**
 *  @brief: this displays a string on the frame buffer but not refresh
 */
-void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawStringAt(int x, int y, const char* text, sFONT* font, int colored)
 {
     const char* p_text = text;
     unsigned int counter = 0;
@@ -188,8 +706,8 @@ void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colore
     while (*p_text != 0) {
         /* Display one character on EPD */
         DrawCharAt(refcolumn, y, *p_text, font, colored);
-        /* Decrement the column position by 16 */
-        refcolumn += font->Width;
+        /* Advance by the width of the character */
+        refcolumn += GetCharAdvance(font, *p_text);
         /* Point on the next character */
         p_text++;
         counter++;
@@ -199,7 +717,8 @@ void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colore
 /**
 *  @brief: this draws a line on the frame buffer
 */
-void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawLine(int x0, int y0, int x1, int y1, int colored)
 {
     /* Bresenham algorithm */
     int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
@@ -224,29 +743,30 @@ void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored)
 /**
 *  @brief: this draws a horizontal line on the frame buffer
 */
-void Paint::DrawHorizontalLine(int x, int y, int line_width, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawHorizontalLine(int x, int y, int line_width, int colored)
 {
-    int i;
-    for (i = x; i < x + line_width; i++) {
-        DrawPixel(i, y, colored);
+    if (line_width > 0) {
+        FillRectangle(x, y, x + line_width - 1, y, colored);
     }
 }
 
 /**
 *  @brief: this draws a vertical line on the frame buffer
 */
-void Paint::DrawVerticalLine(int x, int y, int line_height, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawVerticalLine(int x, int y, int line_height, int colored)
 {
-    int i;
-    for (i = y; i < y + line_height; i++) {
-        DrawPixel(x, i, colored);
+    if (line_height > 0) {
+        FillRectangle(x, y, x, y + line_height - 1, colored);
     }
 }
 
 /**
 *  @brief: this draws a rectangle
 */
-void Paint::DrawRectangle(int x0, int y0, int x1, int y1, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawRectangle(int x0, int y0, int x1, int y1, int colored)
 {
     int min_x, min_y, max_x, max_y;
     min_x = x1 > x0 ? x0 : x1;
@@ -263,24 +783,23 @@ void Paint::DrawRectangle(int x0, int y0, int x1, int y1, int colored)
 /**
 *  @brief: this draws a filled rectangle
 */
-void Paint::DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored)
 {
     int min_x, min_y, max_x, max_y;
-    int i;
     min_x = x1 > x0 ? x0 : x1;
     max_x = x1 > x0 ? x1 : x0;
     min_y = y1 > y0 ? y0 : y1;
     max_y = y1 > y0 ? y1 : y0;
 
-    for (i = min_x; i <= max_x; i++) {
-        DrawVerticalLine(i, min_y, max_y - min_y + 1, colored);
-    }
+    FillRectangle(min_x, min_y, max_x, max_y, colored);
 }
 
 /**
 *  @brief: this draws a circle
 */
-void Paint::DrawCircle(int x, int y, int radius, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawCircle(int x, int y, int radius, int colored)
 {
     /* Bresenham algorithm */
     int x_pos = -radius;
@@ -309,7 +828,8 @@ void Paint::DrawCircle(int x, int y, int radius, int colored)
 /**
 *  @brief: this draws a filled circle
 */
-void Paint::DrawFilledCircle(int x, int y, int radius, int colored)
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawFilledCircle(int x, int y, int radius, int colored)
 {
     /* Bresenham algorithm */
     int x_pos = -radius;
@@ -337,29 +857,225 @@ void Paint::DrawFilledCircle(int x, int y, int radius, int colored)
     } while(x_pos <= 0);
 }
 
-void Paint::DrawImage(unsigned char* img, int x, int y, int width, int height)
+/**
+ *  @brief: this draws a 1bpp bitmap (msb first) scaled up by an integer factor,
+ *          every bit becomes a square of scale x scale pixels.
+ *          set bits are drawn colored and cleared bits uncolored.
+ *          the rows of the bitmap start line_bits apart, so bitmaps without
+ *          row padding like the modules of a qrcode can be drawn directly.
+ */
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawScaledBitmap(int x, int y, const unsigned char* bitmap,
+                                                      int width, int height, int line_bits,
+                                                      int scale, int colored)
 {
-    char data;
-    int pixelByte;
+    if (width <= 0 || height <= 0 || scale <= 0) {
+        return;
+    }
+    if (Rotation == ROTATE_0) {
+        DrawAbsoluteScaledBitmap(x, y, bitmap, width, height, line_bits, scale, colored);
+        return;
+    }
 
-    for (int line = 0; line < height; line++)
-    {
-        for (int row = 0; row < width; row++)
-        {
-            if (row + x > this->width)
-                break;
-            if (line + y > this->height)
-                break;
+    for (int j = 0; j < height; j++) {
+        for (int i = 0; i < width; i++) {
+            int bit = j * line_bits + i;
+            int set = bitmap[bit / 8] & (0x80 >> (bit % 8));
+            FillRectangle(x + i * scale, y + j * scale,
+                          x + i * scale + scale - 1, y + j * scale + scale - 1,
+                          set ? colored : !colored);
+        }
+    }
+}
 
-            pixelByte = ((width * line) + row);
-            data = img[pixelByte / 8];
-            data &= 0x80 >> (pixelByte % 8);
+/**
+ *  @brief: this draws a 1bpp image (msb first, rows padded to whole bytes).
+ *          a set bit is a colored pixel, op combines the image with the pixels
+ *          below, see IMAGE_COPY. the image is clipped to the buffer.
+ */
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawImage(const unsigned char* image, int x, int y, int width, int height, int op)
+{
+    DrawSubImage(image, width, 0, 0, x, y, width, height, op);
+}
+
+/**
+ *  @brief: this draws the region of an image starting at src_x, src_y,
+ *          e.g. an icon of a sheet of icons. see DrawImage().
+ */
+template <int Rotation, int Polarity>
+void BasicPaint<Rotation, Polarity>::DrawSubImage(const unsigned char* image, int image_width,
+                                                  int src_x, int src_y, int x, int y,
+                                                  int width, int height, int op)
+{
+    int line_bytes = (image_width + 7) / 8;
+
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    if (Rotation == ROTATE_0) {
+        DrawAbsoluteImage(image, line_bytes, src_x, src_y, x, y, width, height, op);
+        return;
+    }
 
-            DrawPixel(x + line, y + row, (data != 0x00));
+    for (int j = 0; j < height; j++) {
+        const unsigned char* row = &image[(src_y + j) * line_bytes];
+        for (int i = 0; i < width; i++) {
+            int px = x + i;
+            int py = y + j;
+            if (MapPixel(&px, &py)) {
+                unsigned char bit = (row[(src_x + i) / 8] << ((src_x + i) % 8)) & 0x80;
+                DrawAbsoluteImage(&bit, 1, 0, 0, px, py, 1, 1, op);
+            }
         }
     }
 }
 
+/* The painters for all rotations and both polarities */
+template class BasicPaint<ROTATE_0, 0>;
+template class BasicPaint<ROTATE_90, 0>;
+template class BasicPaint<ROTATE_180, 0>;
+template class BasicPaint<ROTATE_270, 0>;
+template class BasicPaint<ROTATE_0, 1>;
+template class BasicPaint<ROTATE_90, 1>;
+template class BasicPaint<ROTATE_180, 1>;
+template class BasicPaint<ROTATE_270, 1>;
+
+Paint::Paint(unsigned char* image, int width, int height) : PaintFrame(image, width, height)
+{
+    this->rotate = ROTATE_0;
+}
+
+Paint::~Paint()
+{
+}
+
+int Paint::GetRotate(void)
+{
+    return this->rotate;
+}
+
+void Paint::SetRotate(int rotate)
+{
+    this->rotate = rotate;
+}
+
+/**
+ *  @brief: call function with the painter of the rotation. the painter draws
+ *          into a copy of the frame, the dirty region is taken back from it.
+ */
+template <int Rotation, typename Function>
+void Paint::Run(Function function)
+{
+    BasicPaint<Rotation, IF_INVERT_COLOR> paint(*this);
+    function(paint);
+    PaintFrame::operator=(paint);
+}
+
+template <typename Function>
+void Paint::Dispatch(Function function)
+{
+    if (this->rotate == ROTATE_0) {
+        Run<ROTATE_0>(function);
+    } else if (this->rotate == ROTATE_90) {
+        Run<ROTATE_90>(function);
+    } else if (this->rotate == ROTATE_180) {
+        Run<ROTATE_180>(function);
+    } else if (this->rotate == ROTATE_270) {
+        Run<ROTATE_270>(function);
+    }
+}
+
+/**
+ *  @brief: the absolute coordinates do not depend on the rotation
+ */
+void Paint::Clear(int colored)
+{
+    Run<ROTATE_0>([&](BasicPaint<ROTATE_0, IF_INVERT_COLOR>& paint) { paint.Clear(colored); });
+}
+
+void Paint::DrawAbsolutePixel(int x, int y, int colored)
+{
+    Run<ROTATE_0>([&](BasicPaint<ROTATE_0, IF_INVERT_COLOR>& paint) { paint.DrawAbsolutePixel(x, y, colored); });
+}
+
+void Paint::DrawAbsoluteFilledRectangle(int x0, int y0, int x1, int y1, int colored)
+{
+    Run<ROTATE_0>([&](BasicPaint<ROTATE_0, IF_INVERT_COLOR>& paint) {
+        paint.DrawAbsoluteFilledRectangle(x0, y0, x1, y1, colored);
+    });
+}
+
+/**
+ *  @brief: the drawing calls of the rotated coordinates
+ */
+void Paint::DrawPixel(int x, int y, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawPixel(x, y, colored); });
+}
+
+void Paint::DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawCharAt(x, y, ascii_char, font, colored); });
+}
+
+void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawStringAt(x, y, text, font, colored); });
+}
+
+void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawLine(x0, y0, x1, y1, colored); });
+}
+
+void Paint::DrawHorizontalLine(int x, int y, int line_width, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawHorizontalLine(x, y, line_width, colored); });
+}
+
+void Paint::DrawVerticalLine(int x, int y, int line_height, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawVerticalLine(x, y, line_height, colored); });
+}
+
+void Paint::DrawRectangle(int x0, int y0, int x1, int y1, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawRectangle(x0, y0, x1, y1, colored); });
+}
+
+void Paint::DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawFilledRectangle(x0, y0, x1, y1, colored); });
+}
+
+void Paint::DrawCircle(int x, int y, int radius, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawCircle(x, y, radius, colored); });
+}
+
+void Paint::DrawFilledCircle(int x, int y, int radius, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawFilledCircle(x, y, radius, colored); });
+}
+
+void Paint::DrawScaledBitmap(int x, int y, const unsigned char* bitmap, int width, int height,
+                             int line_bits, int scale, int colored)
+{
+    Dispatch([&](auto& paint) { paint.DrawScaledBitmap(x, y, bitmap, width, height, line_bits, scale, colored); });
+}
+
+void Paint::DrawImage(const unsigned char* image, int x, int y, int width, int height, int op)
+{
+    Dispatch([&](auto& paint) { paint.DrawImage(image, x, y, width, height, op); });
+}
+
+void Paint::DrawSubImage(const unsigned char* image, int image_width, int src_x, int src_y,
+                         int x, int y, int width, int height, int op)
+{
+    Dispatch([&](auto& paint) { paint.DrawSubImage(image, image_width, src_x, src_y, x, y, width, height, op); });
+}
+
 /* END OF FILE */
 
 
@@ -36,22 +36,113 @@
 // Color inverse. 1 or 0 = set or reset a bit if set a colored pixel
 #define IF_INVERT_COLOR     1
 
+// Raster operations of DrawImage, a set image bit is a colored pixel
+#define IMAGE_COPY          0   // the image replaces the pixels
+#define IMAGE_OR            1   // set bits are drawn colored, cleared bits are transparent
+#define IMAGE_AND           2   // cleared bits are drawn uncolored, set bits are transparent
+#define IMAGE_XOR           3   // set bits invert the pixels
+
 #include "fonts.h"
 
-class Paint
+/* Glyph of a character of a packed font, NULL if the font misses it */
+const sGLYPH* FindGlyph(const sFONT* font, char ascii_char);
+/* Pixels from a character to the next one, font->Width for monospaced fonts */
+int GetCharAdvance(const sFONT* font, char ascii_char);
+
+/**
+ *  The image buffer a painter draws into. it holds a band of rows of the frame,
+ *  see SetBand(), and the region drawn since the last ClearDirtyRect().
+ */
+class PaintFrame
 {
 public:
-    Paint(unsigned char* image, int width, int height);
-    ~Paint();
-    void Clear(int colored);
+    PaintFrame(unsigned char* image, int width, int height);
     int  GetWidth(void);
     void SetWidth(int width);
     int  GetHeight(void);
     void SetHeight(int height);
+    void SetBand(int y, int rows);
+    int  GetBandY(void);
+    int  GetBandHeight(void);
+    unsigned char* GetImage(void);
+    void SetImage(unsigned char* image);
+
+    void AddDirtyRect(int x0, int y0, int x1, int y1);
+    bool GetDirtyRect(int* x, int* y, int* w, int* h);
+    void ClearDirtyRect(void);
+
+protected:
+    unsigned char* image;
+    int width;
+    int height;
+
+    /* The image buffer holds the rows band_y to band_y + band_height - 1 of the frame */
+    int band_y;
+    int band_height;
+
+    /* Union of all drawn regions by absolute coordinates, x is 8 pixel aligned */
+    int dirty_x0;
+    int dirty_y0;
+    int dirty_x1;
+    int dirty_y1;
+};
+
+/**
+ *  Painter with the rotation and the polarity of the pixels fixed at compile time,
+ *  so the drawing loops do not branch on them. Polarity is 1 or 0 like IF_INVERT_COLOR.
+ *  the instances for all rotations and both polarities are built in epdpaint.cpp.
+ */
+template <int Rotation, int Polarity>
+class BasicPaint : public PaintFrame
+{
+public:
+    BasicPaint(unsigned char* image, int width, int height) : PaintFrame(image, width, height) {}
+    explicit BasicPaint(const PaintFrame& frame) : PaintFrame(frame) {}
+
+    void Clear(int colored);
+    void DrawAbsolutePixel(int x, int y, int colored);
+    void DrawAbsoluteFilledRectangle(int x0, int y0, int x1, int y1, int colored);
+    void DrawPixel(int x, int y, int colored);
+    void DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored);
+    void DrawStringAt(int x, int y, const char* text, sFONT* font, int colored);
+    void DrawLine(int x0, int y0, int x1, int y1, int colored);
+    void DrawHorizontalLine(int x, int y, int width, int colored);
+    void DrawVerticalLine(int x, int y, int height, int colored);
+    void DrawRectangle(int x0, int y0, int x1, int y1, int colored);
+    void DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored);
+    void DrawCircle(int x, int y, int radius, int colored);
+    void DrawFilledCircle(int x, int y, int radius, int colored);
+    void DrawScaledBitmap(int x, int y, const unsigned char* bitmap, int width, int height,
+                          int line_bits, int scale, int colored);
+
+    void DrawImage(const unsigned char* image, int x, int y, int width, int height, int op = IMAGE_COPY);
+    void DrawSubImage(const unsigned char* image, int image_width, int src_x, int src_y,
+                      int x, int y, int width, int height, int op = IMAGE_COPY);
+
+private:
+    bool MapPixel(int* x, int* y);
+    void FillRectangle(int x0, int y0, int x1, int y1, int colored);
+    void DrawAbsoluteBits(int x, int y, const unsigned char* bits, int count, int colored);
+    void DrawAbsoluteScaledBitmap(int x, int y, const unsigned char* bitmap, int width, int height,
+                                  int line_bits, int scale, int colored);
+    void DrawAbsoluteImage(const unsigned char* image, int line_bytes, int src_x, int src_y,
+                           int x, int y, int width, int height, int op);
+};
+
+/**
+ *  Painter with the rotation set at runtime.
+ *  every call is passed on to the BasicPaint of the current rotation.
+ */
+class Paint : public PaintFrame
+{
+public:
+    Paint(unsigned char* image, int width, int height);
+    ~Paint();
+    void Clear(int colored);
     int  GetRotate(void);
     void SetRotate(int rotate);
-    unsigned char* GetImage(void);
     void DrawAbsolutePixel(int x, int y, int colored);
+    void DrawAbsoluteFilledRectangle(int x0, int y0, int x1, int y1, int colored);
     void DrawPixel(int x, int y, int colored);
     void DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored);
     void DrawStringAt(int x, int y, const char* text, sFONT* font, int colored);
@@ -62,14 +153,18 @@ public:
     void DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored);
     void DrawCircle(int x, int y, int radius, int colored);
     void DrawFilledCircle(int x, int y, int radius, int colored);
+    void DrawScaledBitmap(int x, int y, const unsigned char* bitmap, int width, int height,
+                          int line_bits, int scale, int colored);
 
-    void DrawImage(unsigned char*, int x, int y, int width, int height);
+    void DrawImage(const unsigned char* image, int x, int y, int width, int height, int op = IMAGE_COPY);
+    void DrawSubImage(const unsigned char* image, int image_width, int src_x, int src_y,
+                      int x, int y, int width, int height, int op = IMAGE_COPY);
 
 private:
-    unsigned char* image;
-    int width;
-    int height;
     int rotate;
+
+    template <int Rotation, typename Function> void Run(Function function);
+    template <typename Function> void Dispatch(Function function);
 };
 
 #endif
@@ -481,86 +481,150 @@ static void drawCodewords(BitBucket *modules, BitBucket *isFunction, BitBucket *
 #define PENALTY_N3     40
 #define PENALTY_N4     10
 
+// The penalty is scored on 32 modules of a row or column at once. A line of modules is held
+// in words, the first module in the most significant bit, and modules beyond the end are 0.
+
+// Returns the 32 bits of the grid starting at the bit offset, the first one in the most significant bit
+static uint32_t bb_getWord(BitBucket *bitGrid, uint32_t offset) {
+    uint16_t index = offset >> 3;
+    uint8_t shift = offset & 0x07;
+    
+    uint32_t word = 0;
+    for (uint8_t i = 0; i < 5; i++, index++) {
+        uint8_t byte = (index < bitGrid->capacityBytes) ? bitGrid->data[index] : 0;
+        if (i < 4) {
+            word = (word << 8) | byte;
+        } else if (shift != 0) {
+            word = (word << shift) | (byte >> (8 - shift));
+        }
+    }
+    return word;
+}
+
+// Returns the bits of the modules x in word i of a line with x < count
+static uint32_t getLineMask(uint8_t i, int16_t count) {
+    int16_t bits = count - 32 * i;
+    if (bits <= 0) { return 0; }
+    if (bits >= 32) { return 0xFFFFFFFF; }
+    return ~(0xFFFFFFFF >> bits);
+}
+
+// Returns word i of a line moved by k < 32 modules, so the bit of module x holds module x + k
+static uint32_t getLineWord(const uint32_t *line, uint8_t words, uint8_t i, uint8_t k) {
+    if (k == 0) { return line[i]; }
+    uint32_t next = (i + 1 < words) ? line[i + 1] : 0;
+    return (line[i] << k) | (next >> (32 - k));
+}
+
+static uint8_t countBits(uint32_t bits) {
+    bits = bits - ((bits >> 1) & 0x55555555);
+    bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+    return (bits * 0x01010101) >> 24;
+}
+
+// Transposes a block of 32*32 modules, the module x of word y becomes the module y of word x.
+// See: Hacker's Delight, 7-3 "Transposing a Bit Matrix"
+static void transposeBlock(uint32_t *block) {
+    uint32_t m = 0x0000FFFF;
+    for (uint8_t j = 16; j != 0; j >>= 1, m ^= (m << j)) {
+        for (uint8_t k = 0; k < 32; k = ((k | j) + 1) & ~j) {
+            uint32_t t = (block[k] ^ (block[k | j] >> j)) & m;
+            block[k] ^= t;
+            block[k | j] ^= (t << j);
+        }
+    }
+}
+
+// Adjacent modules having same color and finder-like patterns in a row or column
+static uint32_t getLinePenalty(const uint32_t *line, uint8_t words, uint8_t size) {
+    uint32_t result = 0;
+    uint32_t lastRun = 0;
+    
+    // Runs and patterns start at least 4 modules before the end, the last word may hold none
+    for (uint8_t i = 0; 32 * i < size - 4; i++) {
+        uint32_t m[11];
+        for (uint8_t k = 0; k < 11; k++) {
+            m[k] = getLineWord(line, words, i, k);
+        }
+        
+        // Bit x is set if the modules x to x + 4 have the same color. A run of n >= 5 modules
+        // sets n - 4 bits and scores N1 + n - 5, so N1 - 1 is added for the first bit of a run
+        uint32_t runs = ((m[0] & m[1] & m[2] & m[3] & m[4]) | ~(m[0] | m[1] | m[2] | m[3] | m[4])) & getLineMask(i, size - 4);
+        uint32_t starts = runs & ~((runs >> 1) | (lastRun << 31));
+        lastRun = runs & 1;
+        result += countBits(runs) + (PENALTY_N1 - 1) * countBits(starts);
+        
+        // Bit x is set if the modules x to x + 10 are 00001011101 or 10111010000
+        uint32_t core = m[4] & ~m[5] & m[6] & ~m[9];
+        uint32_t before = ~m[0] & ~m[1] & ~m[2] & ~m[3] & m[7] & m[8] & m[10];
+        uint32_t after = m[0] & ~m[1] & m[2] & m[3] & ~m[7] & ~m[8] & ~m[10];
+        uint32_t finders = core & (before | after) & getLineMask(i, size - 10);
+        result += PENALTY_N3 * countBits(finders);
+    }
+    
+    return result;
+}
+
 // Calculates and returns the penalty score based on state of this QR Code's current modules.
 // This is used by the automatic mask choice algorithm to find the mask pattern that yields the lowest score.
-// @TODO: This can be optimized by working with the bytes instead of bits.
 static uint32_t getPenaltyScore(BitBucket *modules) {
     uint32_t result = 0;
     
     uint8_t size = modules->bitOffsetOrWidth;
+    uint8_t words = (size + 31) / 32;
+    uint32_t lastWordMask = getLineMask(words - 1, size);
+    
+    uint32_t row[words], lastRow[words];
+    uint16_t black = 0;
     
-    // Adjacent modules in row having same color
     for (uint8_t y = 0; y < size; y++) {
+        for (uint8_t i = 0; i < words; i++) {
+            row[i] = bb_getWord(modules, y * size + 32 * i);
+        }
+        row[words - 1] &= lastWordMask;
         
-        bool colorX = bb_getBit(modules, 0, y);
-        for (uint8_t x = 1, runX = 1; x < size; x++) {
-            bool cx = bb_getBit(modules, x, y);
-            if (cx != colorX) {
-                colorX = cx;
-                runX = 1;
-                
-            } else {
-                runX++;
-                if (runX == 5) {
-                    result += PENALTY_N1;
-                } else if (runX > 5) {
-                    result++;
-                }
+        // Adjacent modules in row having same color, finder-like pattern in rows
+        result += getLinePenalty(row, words, size);
+        
+        // 2*2 blocks of modules having same color
+        if (y > 0) {
+            for (uint8_t i = 0; 32 * i < size - 1; i++) {
+                uint32_t color = row[i], colorNext = getLineWord(row, words, i, 1);
+                uint32_t sameUp = ~(color ^ lastRow[i]);
+                uint32_t sameUpNext = ~(colorNext ^ getLineWord(lastRow, words, i, 1));
+                uint32_t blocks = sameUp & sameUpNext & ~(color ^ colorNext) & getLineMask(i, size - 1);
+                result += PENALTY_N2 * countBits(blocks);
             }
         }
-    }
-    
-    // Adjacent modules in column having same color
-    for (uint8_t x = 0; x < size; x++) {
-        bool colorY = bb_getBit(modules, x, 0);
-        for (uint8_t y = 1, runY = 1; y < size; y++) {
-            bool cy = bb_getBit(modules, x, y);
-            if (cy != colorY) {
-                colorY = cy;
-                runY = 1;
-            } else {
-                runY++;
-                if (runY == 5) {
-                    result += PENALTY_N1;
-                } else if (runY > 5) {
-                    result++;
-                }
-            }
+        
+        // Balance of black and white modules
+        for (uint8_t i = 0; i < words; i++) {
+            black += countBits(row[i]);
+            lastRow[i] = row[i];
         }
     }
     
-    uint16_t black = 0;
-    for (uint8_t y = 0; y < size; y++) {
-        uint16_t bitsRow = 0, bitsCol = 0;
-        for (uint8_t x = 0; x < size; x++) {
-            bool color = bb_getBit(modules, x, y);
-
-            // 2*2 blocks of modules having same color
-            if (x > 0 && y > 0) {
-                bool colorUL = bb_getBit(modules, x - 1, y - 1);
-                bool colorUR = bb_getBit(modules, x, y - 1);
-                bool colorL = bb_getBit(modules, x - 1, y);
-                if (color == colorUL && color == colorUR && color == colorL) {
-                    result += PENALTY_N2;
-                }
+    // Adjacent modules in column having same color, finder-like pattern in columns.
+    // The columns are transposed in strips of 32 columns
+    uint32_t block[32], columns[32 * words];
+    for (uint8_t strip = 0; strip < words; strip++) {
+        for (uint8_t i = 0; i < words; i++) {
+            for (uint8_t j = 0; j < 32; j++) {
+                uint8_t y = 32 * i + j;
+                block[j] = (y < size) ? bb_getWord(modules, y * size + 32 * strip) : 0;
             }
-
-            // Finder-like pattern in rows and columns
-            bitsRow = ((bitsRow << 1) & 0x7FF) | color;
-            bitsCol = ((bitsCol << 1) & 0x7FF) | bb_getBit(modules, y, x);
-
-            // Needs 11 bits accumulated
-            if (x >= 10) {
-                if (bitsRow == 0x05D || bitsRow == 0x5D0) {
-                    result += PENALTY_N3;
-                }
-                if (bitsCol == 0x05D || bitsCol == 0x5D0) {
-                    result += PENALTY_N3;
-                }
+            if (strip == words - 1) {
+                for (uint8_t j = 0; j < 32; j++) { block[j] &= lastWordMask; }
             }
-
-            // Balance of black and white modules
-            if (color) { black++; }
+            transposeBlock(block);
+            for (uint8_t j = 0; j < 32; j++) {
+                columns[j * words + i] = block[j];
+            }
+        }
+        
+        for (uint8_t j = 0; j < 32 && 32 * strip + j < size; j++) {
+            result += getLinePenalty(&columns[j * words], words, size);
         }
     }
 
@@ -576,6 +640,97 @@ static uint32_t getPenaltyScore(BitBucket *modules) {
 
 #pragma mark - Reed-Solomon Generator
 
+#if RS_LOOKUP_TABLES
+
+// Powers of the generator element 0x02 of the field GF(2^8/0x11D); RS_EXP[i] = 2^i
+static const uint8_t RS_EXP[256] = {
+      1,   2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,
+     76, 152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192,
+    157,  39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,
+     70, 140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,
+     95, 190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240,
+    253, 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226,
+    217, 175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206,
+    129,  31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204,
+    133,  23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84,
+    168,  77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115,
+    230, 209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255,
+    227, 219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65,
+    130,  25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,
+     81, 162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,
+     18,  36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,
+     44,  88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142,   1,
+};
+
+// Exponents of the elements; RS_LOG[2^i] = i, RS_LOG[0] is unused
+static const uint8_t RS_LOG[256] = {
+      0,   0,   1,  25,   2,  50,  26, 198,   3, 223,  51, 238,  27, 104, 199,  75,
+      4, 100, 224,  14,  52, 141, 239, 129,  28, 193, 105, 248, 200,   8,  76, 113,
+      5, 138, 101,  47, 225,  36,  15,  33,  53, 147, 142, 218, 240,  18, 130,  69,
+     29, 181, 194, 125, 106,  39, 249, 185, 201, 154,   9, 120,  77, 228, 114, 166,
+      6, 191, 139,  98, 102, 221,  48, 253, 226, 152,  37, 179,  16, 145,  34, 136,
+     54, 208, 148, 206, 143, 150, 219, 189, 241, 210,  19,  92, 131,  56,  70,  64,
+     30,  66, 182, 163, 195,  72, 126, 110, 107,  58,  40,  84, 250, 133, 186,  61,
+    202,  94, 155, 159,  10,  21, 121,  43,  78, 212, 229, 172, 115, 243, 167,  87,
+      7, 112, 192, 247, 140, 128,  99,  13, 103,  74, 222, 237,  49, 197, 254,  24,
+    227, 165, 153, 119,  38, 184, 180, 124,  17,  68, 146, 217,  35,  32, 137,  46,
+     55,  63, 209,  91, 149, 188, 207, 205, 144, 135, 151, 178, 220, 252, 190,  97,
+    242,  86, 211, 171,  20,  42,  93, 158, 132,  60,  57,  83,  71, 109,  65, 162,
+     31,  45,  67, 216, 183, 123, 164, 118, 196,  23,  73, 236, 127,  12, 111, 246,
+    108, 161,  59,  82,  41, 157,  85, 170, 251,  96, 134, 177, 187, 204,  62,  90,
+    203,  89,  95, 176, 156, 169, 160,  81,  11, 245,  22, 235, 122, 117,  44, 215,
+     79, 174, 213, 233, 230, 231, 173, 232, 116, 214, 244, 234, 168,  80,  88, 175,
+};
+
+// The generator polynomials of all block ECC lengths of the versions 1 to 40, each one as the
+// length followed by the exponents of its coefficients in order of descending powers, leaving out
+// the highest term. They are the products (x - r^0) * (x - r^1) * ... * (x - r^{degree-1}) of rs_init
+static const uint8_t RS_GENERATORS[] = {
+     7,  87, 229, 146, 149, 238, 102,  21,
+    10, 251,  67,  46,  61, 118,  70,  64,  94,  32,  45,
+    13,  74, 152, 176, 100,  86, 100, 106, 104, 130, 218, 206, 140,  78,
+    15,   8, 183,  61,  91, 202,  37,  51,  58,  58, 237, 140, 124,   5,  99, 105,
+    16, 120, 104, 107, 109, 102, 161,  76,   3,  91, 191, 147, 169, 182, 194, 225, 120,
+    17,  43, 139, 206,  78,  43, 239, 123, 206, 214, 147,  24,  99, 150,  39, 243, 163, 136,
+    18, 215, 234, 158,  94, 184,  97, 118, 170,  79, 187, 152, 148, 252, 179,   5,  98,  96, 153,
+    20,  17,  60,  79,  50,  61, 163,  26, 187, 202, 180, 221, 225,  83, 239, 156, 164, 212, 212, 188, 190,
+    22, 210, 171, 247, 242,  93, 230,  14, 109, 221,  53, 200,  74,   8, 172,  98,  80, 219, 134, 160, 105, 165, 231,
+    24, 229, 121, 135,  48, 211, 117, 251, 126, 159, 180, 169, 152, 192, 226, 228, 218, 111,   0, 117, 232,  87,  96, 227,  21,
+    26, 173, 125, 158,   2, 103, 182, 118,  17, 145, 201, 111,  28, 165,  53, 161,  21, 245, 142,  13, 102,  48, 227, 153, 145, 218,  70,
+    28, 168, 223, 200, 104, 224, 234, 108, 180, 110, 190, 195, 147, 205,  27, 232, 201,  21,  43, 245,  87,  42, 195, 212, 119, 242,  37,   9, 123,
+    30,  41, 173, 145, 152, 216,  31, 179, 182,  50,  48, 110,  86, 239,  96, 222, 125,  42, 173, 226, 193, 224, 130, 156,  37, 251, 216, 238,  40, 192, 180,
+     0
+};
+
+static const uint8_t *rs_getGenerator(uint8_t degree) {
+    const uint8_t *coeff = RS_GENERATORS;
+    while (*coeff != 0 && *coeff != degree) { coeff += *coeff + 1; }
+    return coeff + 1;
+}
+
+static void rs_getRemainder(uint8_t degree, const uint8_t *coeff, uint8_t *data, uint8_t length, uint8_t *result, uint8_t stride) {
+    // Compute the remainder by performing polynomial division, the coefficients and the factor
+    // are multiplied by adding their exponents
+    for (uint8_t i = 0; i < length; i++) {
+        uint8_t factor = data[i] ^ result[0];
+        for (uint8_t j = 1; j < degree; j++) {
+            result[(j - 1) * stride] = result[j * stride];
+        }
+        result[(degree - 1) * stride] = 0;
+        
+        if (factor == 0) { continue; }
+        
+        uint8_t logFactor = RS_LOG[factor];
+        for (uint8_t j = 0; j < degree; j++) {
+            uint16_t exponent = coeff[j] + logFactor;
+            if (exponent >= 255) { exponent -= 255; }
+            result[j * stride] ^= RS_EXP[exponent];
+        }
+    }
+}
+
+#else
+
 static uint8_t rs_multiply(uint8_t x, uint8_t y) {
     // Russian peasant multiplication
     // See: https://en.wikipedia.org/wiki/Ancient_Egyptian_multiplication
@@ -626,15 +781,117 @@ static void rs_getRemainder(uint8_t degree, uint8_t *coeff, uint8_t *data, uint8
     }
 }
 
+#endif
 
 
-#pragma mark - QrCode
 
-static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text, uint16_t length, uint8_t version) {
-    int8_t mode = MODE_BYTE;
+#pragma mark - Segmentation
+
+// Returns the single mode which can encode all of the text
+static uint8_t getMode(const uint8_t *text, uint16_t length) {
+    if (isNumeric((char*)text, length)) { return MODE_NUMERIC; }
+    if (isAlphanumeric((char*)text, length)) { return MODE_ALPHANUMERIC; }
+    return MODE_BYTE;
+}
+
+// Returns the bits of a segment of length characters in the mode, including the mode indicator and
+// the character count. UINT32_MAX if the character count does not fit its bits in this version
+static uint32_t getSegmentBits(uint8_t version, uint8_t mode, uint16_t length) {
+    uint8_t countBits = getModeBits(version, mode);
+    if ((uint32_t)length >> countBits != 0) { return UINT32_MAX; }
+    
+    uint32_t bits = 4 + countBits;
+    switch (mode) {
+        case MODE_NUMERIC:       bits += 10 * (length / 3) + ((length % 3) ? (length % 3) * 3 + 1 : 0);  break;
+        case MODE_ALPHANUMERIC:  bits += 11 * (length / 2) + 6 * (length % 2);                          break;
+        default:                 bits += 8 * (uint32_t)length;                                           break;
+    }
+    return bits;
+}
+
+// Chooses the mode of every character, so that the segments of characters with the same mode take
+// the fewest bits in this version. Returns the bits of all segments, modes holds the mode of each
+// character. UINT32_MAX if a segment does not fit the character count bits.
+// See: https://www.nayuki.io/page/optimal-text-segmentation-for-qr-codes
+static uint32_t segmentModes(const uint8_t *text, uint16_t length, uint8_t version, uint8_t *modes) {
+    
+    // The costs are in 1/6 bits, a digit takes 10/3 bits and an alphanumeric character 11/2 bits
+    static const uint8_t CHARACTER_COSTS[3] = { 20, 33, 48 };
     
-    if (isNumeric((char*)text, length)) {
-        mode = MODE_NUMERIC;
+    uint32_t headCosts[3], costs[3];
+    for (uint8_t m = 0; m < 3; m++) {
+        headCosts[m] = (4 + getModeBits(version, m)) * 6;
+        costs[m] = headCosts[m];
+    }
+    
+    // For each mode m the cheapest segments of the characters up to i which end in a segment of
+    // mode m. The 2 bits m of modes[i] are 1 + the mode of character i in them, 0 if there are none
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t choices = 0;
+        uint32_t nextCosts[3];
+        
+        // Extend the segments with the character
+        for (uint8_t m = 0; m < 3; m++) {
+            bool encodable = (m == MODE_BYTE) ||
+                             (m == MODE_ALPHANUMERIC && getAlphanumeric(text[i]) != -1) ||
+                             (m == MODE_NUMERIC && text[i] >= '0' && text[i] <= '9');
+            if (encodable) {
+                nextCosts[m] = costs[m] + CHARACTER_COSTS[m];
+                choices |= (m + 1) << (2 * m);
+            }
+        }
+        
+        // Start a new segment after the character to switch modes
+        for (uint8_t to = 0; to < 3; to++) {
+            for (uint8_t from = 0; from < 3; from++) {
+                uint8_t fromChoice = (choices >> (2 * from)) & 0x03;
+                if (fromChoice == 0) { continue; }
+                
+                uint32_t cost = (nextCosts[from] + 5) / 6 * 6 + headCosts[to];
+                if (((choices >> (2 * to)) & 0x03) == 0 || cost < nextCosts[to]) {
+                    nextCosts[to] = cost;
+                    choices = (choices & ~(0x03 << (2 * to))) | (fromChoice << (2 * to));
+                }
+            }
+        }
+        
+        modes[i] = choices;
+        memcpy(costs, nextCosts, sizeof(costs));
+    }
+    
+    if (length == 0) { return 0; }
+    
+    // Trace the cheapest segments back from the end, byte mode can encode anything
+    uint8_t mode = MODE_BYTE;
+    for (uint8_t m = 0; m < 3; m++) {
+        if (((modes[length - 1] >> (2 * m)) & 0x03) != 0 && costs[m] < costs[mode]) { mode = m; }
+    }
+    for (uint16_t i = length; i-- > 0; ) {
+        mode = ((modes[i] >> (2 * mode)) & 0x03) - 1;
+        modes[i] = mode;
+    }
+    
+    // The costs round the bits of the characters, count them exactly
+    uint32_t bits = 0;
+    uint16_t start = 0;
+    for (uint16_t i = 1; i <= length; i++) {
+        if (i == length || modes[i] != modes[start]) {
+            uint32_t segmentBits = getSegmentBits(version, modes[start], i - start);
+            if (segmentBits == UINT32_MAX) { return UINT32_MAX; }
+            bits += segmentBits;
+            start = i;
+        }
+    }
+    
+    return bits;
+}
+
+
+#pragma mark - QrCode
+
+// Appends a segment of the text in the mode, the mode must be able to encode all of its characters
+static void appendSegment(BitBucket *dataCodewords, const uint8_t *text, uint16_t length, uint8_t version, uint8_t mode) {
+    if (mode == MODE_NUMERIC) {
         bb_appendBits(dataCodewords, 1 << MODE_NUMERIC, 4);
         bb_appendBits(dataCodewords, length, getModeBits(version, MODE_NUMERIC));
 
@@ -655,8 +912,7 @@ static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text,
             bb_appendBits(dataCodewords, accumData, accumCount * 3 + 1);
         }
         
-    } else if (isAlphanumeric((char*)text, length)) {
-        mode = MODE_ALPHANUMERIC;
+    } else if (mode == MODE_ALPHANUMERIC) {
         bb_appendBits(dataCodewords, 1 << MODE_ALPHANUMERIC, 4);
         bb_appendBits(dataCodewords, length, getModeBits(version, MODE_ALPHANUMERIC));
 
@@ -684,13 +940,11 @@ static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text,
             bb_appendBits(dataCodewords, (char)(text[i]), 8);
         }
     }
-    
-    //bb_setBits(dataCodewords, length, 4, getModeBits(version, mode));
-    
-    return mode;
 }
 
-static void performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data) {
+// Interleaves the data codewords of the blocks with their error correction codewords, result
+// holds data->capacityBytes bytes
+static void performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data, uint8_t *result) {
     
     // See: http://www.thonky.com/qr-code-tutorial/structure-final-message
     
@@ -710,11 +964,14 @@ static void performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data
     
     uint8_t shortDataBlockLen = shortBlockLen - blockEccLen;
     
-    uint8_t result[data->capacityBytes];
-    memset(result, 0, sizeof(result));
+    memset(result, 0, data->capacityBytes);
     
+#if RS_LOOKUP_TABLES
+    const uint8_t *coeff = rs_getGenerator(blockEccLen);
+#else
     uint8_t coeff[blockEccLen];
     rs_init(blockEccLen, coeff);
+#endif
     
     uint16_t offset = 0;
     uint8_t *dataBytes = data->data;
@@ -768,64 +1025,71 @@ static void performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data
 // The format bits can be determined by ECC_FORMAT_BITS >> (2 * ecc)
 static const uint8_t ECC_FORMAT_BITS = (0x02 << 6) | (0x03 << 4) | (0x00 << 2) | (0x01 << 0);
 
-
-#pragma mark - Public QRCode functions
-
-uint16_t qrcode_getBufferSize(uint8_t version) {
-    return bb_getGridSizeBytes(4 * version + 17);
+static uint16_t getModuleCount(uint8_t version) {
+#if LOCK_VERSION == 0
+    return NUM_RAW_DATA_MODULES[version - 1];
+#else
+    return NUM_RAW_DATA_MODULES;
+#endif
 }
 
-// @TODO: Return error if data is too big.
-int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length) {
-    uint8_t size = version * 4 + 17;
-    qrcode->version = version;
-    qrcode->size = size;
-    qrcode->ecc = ecc;
-    qrcode->modules = modules;
-    
+// Returns the data codewords of the version with the error correction level
+static uint16_t getDataCapacity(uint8_t version, uint8_t ecc) {
     uint8_t eccFormatBits = (ECC_FORMAT_BITS >> (2 * ecc)) & 0x03;
     
 #if LOCK_VERSION == 0
-    uint16_t moduleCount = NUM_RAW_DATA_MODULES[version - 1];
-    uint16_t dataCapacity = moduleCount / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits][version - 1];
+    return getModuleCount(version) / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits][version - 1];
 #else
-    version = LOCK_VERSION;
-    uint16_t moduleCount = NUM_RAW_DATA_MODULES;
-    uint16_t dataCapacity = moduleCount / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits];
+    return getModuleCount(version) / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits];
 #endif
-    
-    struct BitBucket codewords;
-    uint8_t codewordBytes[bb_getBufferSizeBytes(moduleCount)];
-    bb_initBuffer(&codewords, codewordBytes, (int32_t)sizeof(codewordBytes));
-    
-    // Place the data code words into the buffer
-    int8_t mode = encodeDataCodewords(&codewords, data, length, version);
-    
-    if (mode < 0) { return -1; }
-    qrcode->mode = mode;
+}
+
+// Terminates and pads the data codewords up to the capacity, adds the error correction and
+// draws the modules of the QR code with the mask of the lowest penalty
+static void drawQRCode(QRCode *qrcode, uint8_t version, BitBucket *codewords, QRCodeWorkspace *workspace) {
+    uint8_t size = qrcode->size;
+    uint8_t eccFormatBits = (ECC_FORMAT_BITS >> (2 * qrcode->ecc)) & 0x03;
+    uint16_t dataCapacity = getDataCapacity(version, qrcode->ecc);
     
     // Add terminator and pad up to a byte if applicable
-    uint32_t padding = (dataCapacity * 8) - codewords.bitOffsetOrWidth;
+    uint32_t padding = (dataCapacity * 8) - codewords->bitOffsetOrWidth;
     if (padding > 4) { padding = 4; }
-    bb_appendBits(&codewords, 0, padding);
-    bb_appendBits(&codewords, 0, (8 - codewords.bitOffsetOrWidth % 8) % 8);
+    bb_appendBits(codewords, 0, padding);
+    bb_appendBits(codewords, 0, (8 - codewords->bitOffsetOrWidth % 8) % 8);
 
     // Pad with alternate bytes until data capacity is reached
-    for (uint8_t padByte = 0xEC; codewords.bitOffsetOrWidth < (dataCapacity * 8); padByte ^= 0xEC ^ 0x11) {
-        bb_appendBits(&codewords, padByte, 8);
+    for (uint8_t padByte = 0xEC; codewords->bitOffsetOrWidth < (dataCapacity * 8); padByte ^= 0xEC ^ 0x11) {
+        bb_appendBits(codewords, padByte, 8);
     }
 
     BitBucket modulesGrid;
-    bb_initGrid(&modulesGrid, modules, size);
-    
     BitBucket isFunctionGrid;
-    uint8_t isFunctionGridBytes[bb_getGridSizeBytes(size)];
-    bb_initGrid(&isFunctionGrid, isFunctionGridBytes, size);
     
     // Draw function patterns, draw all codewords, do masking
-    drawFunctionPatterns(&modulesGrid, &isFunctionGrid, version, eccFormatBits);
-    performErrorCorrection(version, eccFormatBits, &codewords);
-    drawCodewords(&modulesGrid, &isFunctionGrid, &codewords);
+    if (workspace->functionModules == NULL) {
+        bb_initGrid(&modulesGrid, qrcode->modules, size);
+        bb_initGrid(&isFunctionGrid, workspace->isFunction, size);
+        drawFunctionPatterns(&modulesGrid, &isFunctionGrid, version, eccFormatBits);
+        
+    } else {
+        // The function patterns only depend on the version, the format bits are drawn for each mask
+        if (workspace->version != version) {
+            bb_initGrid(&modulesGrid, workspace->functionModules, size);
+            bb_initGrid(&isFunctionGrid, workspace->isFunction, size);
+            drawFunctionPatterns(&modulesGrid, &isFunctionGrid, version, eccFormatBits);
+            workspace->version = version;
+        }
+        
+        bb_initGrid(&modulesGrid, qrcode->modules, size);
+        memcpy(qrcode->modules, workspace->functionModules, modulesGrid.capacityBytes);
+        
+        isFunctionGrid.bitOffsetOrWidth = size;
+        isFunctionGrid.capacityBytes = bb_getGridSizeBytes(size);
+        isFunctionGrid.data = workspace->isFunction;
+    }
+    
+    performErrorCorrection(version, eccFormatBits, codewords, workspace->eccCodewords);
+    drawCodewords(&modulesGrid, &isFunctionGrid, codewords);
     
     // Find the best (lowest penalty) mask
     uint8_t mask = 0;
@@ -848,6 +1112,97 @@ int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8
     
     // Apply the final choice of mask
     applyMask(&modulesGrid, &isFunctionGrid, mask);
+}
+
+
+#pragma mark - Public QRCode functions
+
+uint16_t qrcode_getBufferSize(uint8_t version) {
+    return bb_getGridSizeBytes(4 * version + 17);
+}
+
+// Finds the smallest version up to maxVersion the data fits into at the level ecc, splits the data
+// into the segments of modes and raises ecc as far as the data still fits. Returns 0 if none fits
+static uint8_t chooseVersion(const uint8_t *data, uint16_t length, uint8_t maxVersion, uint8_t *ecc, uint8_t *modes) {
+    
+#if LOCK_VERSION == 0
+    uint8_t minVersion = 1;
+    if (maxVersion > 40) { maxVersion = 40; }
+#else
+    uint8_t minVersion = LOCK_VERSION;
+    if (maxVersion > LOCK_VERSION) { maxVersion = LOCK_VERSION; }
+#endif
+    
+    // The segments only change with the character count bits, at the versions 10 and 27
+    uint32_t bits = UINT32_MAX;
+    uint8_t version = minVersion;
+    for (; version <= maxVersion; version++) {
+        if (version == minVersion || version == 10 || version == 27) {
+            bits = segmentModes(data, length, version, modes);
+        }
+        if (bits <= getDataCapacity(version, *ecc) * 8) { break; }
+    }
+    if (version > maxVersion) { return 0; }
+    
+    // Raise the error correction as far as the data still fits this version
+    while (*ecc < ECC_HIGH && bits <= getDataCapacity(version, *ecc + 1) * 8) { (*ecc)++; }
+    
+    return version;
+}
+
+// Encodes the data into the modules of qrcode, whose version, size and ecc are set. The data is
+// split into the segments of modes, or in the single qrcode->mode if modes is NULL
+static void encodeQRCode(QRCode *qrcode, uint8_t version, const uint8_t *data, uint16_t length, const uint8_t *modes, QRCodeWorkspace *workspace) {
+    struct BitBucket codewords;
+    bb_initBuffer(&codewords, workspace->codewords, bb_getBufferSizeBytes(getModuleCount(version)));
+    
+    // Place the data code words into the buffer
+    if (modes == NULL) {
+        appendSegment(&codewords, data, length, version, qrcode->mode);
+    } else {
+        uint16_t start = 0;
+        for (uint16_t i = 1; i <= length; i++) {
+            if (i == length || modes[i] != modes[start]) {
+                appendSegment(&codewords, data + start, i - start, version, modes[start]);
+                start = i;
+            }
+        }
+    }
+    
+    drawQRCode(qrcode, version, &codewords, workspace);
+}
+
+// Encodes with the buffers of the version on the stack, the function patterns are drawn every time
+static void encodeQRCodeOnStack(QRCode *qrcode, uint8_t version, const uint8_t *data, uint16_t length, const uint8_t *modes) {
+    uint16_t codewordBytes = bb_getBufferSizeBytes(getModuleCount(version));
+    uint8_t codewords[codewordBytes];
+    uint8_t eccCodewords[codewordBytes];
+    uint8_t isFunction[bb_getGridSizeBytes(qrcode->size)];
+    
+    QRCodeWorkspace workspace;
+    memset(&workspace, 0, sizeof(workspace));
+    workspace.isFunction = isFunction;
+    workspace.codewords = codewords;
+    workspace.eccCodewords = eccCodewords;
+    
+    encodeQRCode(qrcode, version, data, length, modes, &workspace);
+}
+
+int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length) {
+    qrcode->version = version;
+    qrcode->size = version * 4 + 17;
+    qrcode->ecc = ecc;
+    qrcode->modules = modules;
+    
+#if LOCK_VERSION != 0
+    version = LOCK_VERSION;
+#endif
+    
+    uint8_t mode = getMode(data, length);
+    if (getSegmentBits(version, mode, length) > getDataCapacity(version, ecc) * 8) { return -1; }
+    qrcode->mode = mode;
+    
+    encodeQRCodeOnStack(qrcode, version, data, length, NULL);
 
     return 0;
 }
@@ -856,6 +1211,65 @@ int8_t qrcode_initText(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_
     return qrcode_initBytes(qrcode, modules, version, ecc, (uint8_t*)data, strlen(data));
 }
 
+int8_t qrcode_initBytesAuto(QRCode *qrcode, uint8_t *modules, uint8_t maxVersion, uint8_t ecc, uint8_t *data, uint16_t length) {
+    uint8_t modes[length > 0 ? length : 1];
+    uint8_t version = chooseVersion(data, length, maxVersion, &ecc, modes);
+    if (version == 0) { return -1; }
+    
+    qrcode->version = version;
+    qrcode->size = version * 4 + 17;
+    qrcode->ecc = ecc;
+    qrcode->mode = (length > 0) ? modes[0] : MODE_NUMERIC;
+    qrcode->modules = modules;
+    
+    encodeQRCodeOnStack(qrcode, version, data, length, modes);
+    
+    return 0;
+}
+
+int8_t qrcode_initTextAuto(QRCode *qrcode, uint8_t *modules, uint8_t maxVersion, uint8_t ecc, const char *data) {
+    return qrcode_initBytesAuto(qrcode, modules, maxVersion, ecc, (uint8_t*)data, strlen(data));
+}
+
+uint16_t qrcode_getWorkspaceSize(uint8_t maxVersion, uint16_t maxLength) {
+    return QRCODE_WORKSPACE_SIZE(maxVersion, maxLength);
+}
+
+void qrcode_initWorkspace(QRCodeWorkspace *workspace, uint8_t *buffer, uint8_t maxVersion, uint16_t maxLength) {
+    uint16_t gridBytes = qrcode_getBufferSize(maxVersion);
+    
+    // A version has fewer codewords than modules, so every buffer takes the bytes of the grid
+    workspace->maxVersion = maxVersion;
+    workspace->maxLength = maxLength;
+    workspace->version = 0;
+    workspace->isFunction = buffer;
+    workspace->functionModules = buffer + gridBytes;
+    workspace->codewords = buffer + 2 * gridBytes;
+    workspace->eccCodewords = buffer + 3 * gridBytes;
+    workspace->modes = buffer + 4 * gridBytes;
+}
+
+int8_t qrcode_initBytesWorkspace(QRCodeWorkspace *workspace, QRCode *qrcode, uint8_t *modules, uint8_t ecc, uint8_t *data, uint16_t length) {
+    if (length > workspace->maxLength) { return -1; }
+    
+    uint8_t version = chooseVersion(data, length, workspace->maxVersion, &ecc, workspace->modes);
+    if (version == 0) { return -1; }
+    
+    qrcode->version = version;
+    qrcode->size = version * 4 + 17;
+    qrcode->ecc = ecc;
+    qrcode->mode = (length > 0) ? workspace->modes[0] : MODE_NUMERIC;
+    qrcode->modules = modules;
+    
+    encodeQRCode(qrcode, version, data, length, workspace->modes, workspace);
+    
+    return 0;
+}
+
+int8_t qrcode_initTextWorkspace(QRCodeWorkspace *workspace, QRCode *qrcode, uint8_t *modules, uint8_t ecc, const char *data) {
+    return qrcode_initBytesWorkspace(workspace, qrcode, modules, ecc, (uint8_t*)data, strlen(data));
+}
+
 bool qrcode_getModule(QRCode *qrcode, uint8_t x, uint8_t y) {
     if (x < 0 || x >= qrcode->size || y < 0 || y >= qrcode->size) {
         return false;
@@ -65,16 +65,42 @@ static const bool true = 1;
 #define LOCK_VERSION       0
 #endif
 
+// If set to non-zero, the error correction multiplies with exp/log tables and uses precomputed
+// generator polynomials. This costs about 800 bytes of flash; set to 0 on tight flash budgets
+#ifndef RS_LOOKUP_TABLES
+#define RS_LOOKUP_TABLES   1
+#endif
+
+
+// Bytes of the modules of a version, see qrcode_getBufferSize()
+#define QRCODE_BUFFER_SIZE(version)     ((((version) * 4 + 17) * ((version) * 4 + 17) + 7) / 8)
+
+// Bytes of the workspace of the versions up to maxVersion and data of up to maxLength bytes
+#define QRCODE_WORKSPACE_SIZE(maxVersion, maxLength)    (4 * QRCODE_BUFFER_SIZE(maxVersion) + (maxLength))
+
 
 typedef struct QRCode {
     uint8_t version;
     uint8_t size;
     uint8_t ecc;
-    uint8_t mode;
+    uint8_t mode;           // of the first segment
     uint8_t mask;
     uint8_t *modules;
 } QRCode;
 
+// The buffers of encoding a QR code, so it needs no stack for them. The function patterns of the
+// last version are kept, only the data, the error correction and the mask are drawn again
+typedef struct QRCodeWorkspace {
+    uint8_t maxVersion;
+    uint16_t maxLength;
+    uint8_t version;                // of the kept function patterns, 0 for none
+    uint8_t *isFunction;
+    uint8_t *functionModules;       // NULL to draw the function patterns every time
+    uint8_t *codewords;
+    uint8_t *eccCodewords;
+    uint8_t *modes;                 // of the characters of the data
+} QRCodeWorkspace;
+
 
 #ifdef __cplusplus
 extern "C"{
@@ -84,9 +110,24 @@ extern "C"{
 
 uint16_t qrcode_getBufferSize(uint8_t version);
 
+// Encode the data in a single mode into the version, returns -1 if it does not fit
 int8_t qrcode_initText(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, const char *data);
 int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length);
 
+// Encode the data into the smallest version up to maxVersion it fits into, modules must hold
+// qrcode_getBufferSize(maxVersion) bytes. The data is split into numeric, alphanumeric and byte
+// segments which take the fewest bits, and the error correction is raised above ecc as far as
+// the data still fits. Returns -1 if the data does not fit maxVersion at the level ecc
+int8_t qrcode_initTextAuto(QRCode *qrcode, uint8_t *modules, uint8_t maxVersion, uint8_t ecc, const char *data);
+int8_t qrcode_initBytesAuto(QRCode *qrcode, uint8_t *modules, uint8_t maxVersion, uint8_t ecc, uint8_t *data, uint16_t length);
+
+// Encode like qrcode_initBytesAuto() up to the maxVersion of the workspace with the buffers of the
+// workspace. buffer must hold qrcode_getWorkspaceSize() bytes and stay with the workspace
+uint16_t qrcode_getWorkspaceSize(uint8_t maxVersion, uint16_t maxLength);
+void qrcode_initWorkspace(QRCodeWorkspace *workspace, uint8_t *buffer, uint8_t maxVersion, uint16_t maxLength);
+int8_t qrcode_initTextWorkspace(QRCodeWorkspace *workspace, QRCode *qrcode, uint8_t *modules, uint8_t ecc, const char *data);
+int8_t qrcode_initBytesWorkspace(QRCodeWorkspace *workspace, QRCode *qrcode, uint8_t *modules, uint8_t ecc, uint8_t *data, uint16_t length);
+
 bool qrcode_getModule(QRCode *qrcode, uint8_t x, uint8_t y);
 
 
@@ -0,0 +1,388 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "DisplayList.h"
+
+#include <algorithm>
+#include <string.h>
+
+
+DisplayList::DisplayList()
+{
+    clear();
+}
+
+DisplayList::~DisplayList()
+{
+
+}
+
+void DisplayList::clear()
+{
+    count = 0;
+    shownX0 = 0;
+    shownY0 = 0;
+    shownX1 = -1;
+    shownY1 = -1;
+}
+
+bool DisplayList::addBackground(int id, const PackedImage *image, int colored)
+{
+    Widget *widget = add(id, Type::BACKGROUND, 0, 0, image->width - 1, image->height - 1, colored);
+    if (nullptr == widget) {
+        return false;
+    }
+    widget->image = image;
+    widget->hash = hash(&image, sizeof(image));
+    return true;
+}
+
+bool DisplayList::addText(int id, int x, int y, int width, TextLayout::Align align, sFONT *font,
+                          int colored, const char *text)
+{
+    // The bounds cover the whole field, so a shorter text erases a longer one
+    Widget *widget = add(id, Type::TEXT, x, y, x + width - 1, y + font->Height - 1, colored);
+    if (nullptr == widget) {
+        return false;
+    }
+    widget->font = font;
+    widget->align = align;
+    widget->hash = hash(widget->text.getText(), 0);
+    if (nullptr != text) {
+        setText(widget, text);
+    }
+    return true;
+}
+
+bool DisplayList::addQRCode(int id, int x, int y, int scale, int colored)
+{
+    // The bounds are set with the qrcode, its size depends on the version
+    Widget *widget = add(id, Type::QRCODE, x, y, x - 1, y - 1, colored);
+    if (nullptr == widget) {
+        return false;
+    }
+    widget->scale = scale;
+    return true;
+}
+
+bool DisplayList::addPlate(int id, int x, int y, int width, int colored)
+{
+    Widget *widget = add(id, Type::PLATE, x, y, x + width - 1, y + LicensePlate::kHeight - 1, colored);
+    if (nullptr == widget) {
+        return false;
+    }
+    widget->hash = hash(&widget->plate, sizeof(widget->plate));
+    return true;
+}
+
+bool DisplayList::addBarGauge(int id, int x, int y, int barWidth, int barHeight, int gap,
+                              int bars, int colored)
+{
+    Widget *widget = add(id, Type::BAR_GAUGE, x, y,
+                         x + bars * (barWidth + gap) - gap - 1,
+                         y + barHeight - 1, colored);
+    if (nullptr == widget) {
+        return false;
+    }
+    widget->barWidth = barWidth;
+    widget->gap = gap;
+    widget->bars = bars;
+    widget->hash = hash(&widget->level, sizeof(widget->level));
+    return true;
+}
+
+void DisplayList::setText(int id, const char *text)
+{
+    Widget *widget = find(id);
+    if (nullptr == widget || Type::TEXT != widget->type) {
+        return;
+    }
+    setText(widget, text);
+}
+
+void DisplayList::setText(Widget *widget, const char *text)
+{
+    widget->text.layout(widget->font, text, widget->x1 - widget->x0 + 1);
+    widget->hash = hash(widget->text.getText(), widget->text.getLength());
+}
+
+void DisplayList::setQRCode(int id, const QRCode *qrCode)
+{
+    Widget *widget = find(id);
+    if (nullptr == widget || Type::QRCODE != widget->type) {
+        return;
+    }
+
+    uint32_t value = 0;
+    int size = 0;
+    if (nullptr != qrCode) {
+        size = qrCode->size;
+        value = hash(&qrCode->size, sizeof(qrCode->size));
+        value = hash(qrCode->modules, (size * size + 7) / 8, value);
+    }
+    if (value == widget->hash && qrCode == widget->qrCode) {
+        return;
+    }
+
+    int x1 = widget->x0 + size * widget->scale - 1;
+    int y1 = widget->y0 + size * widget->scale - 1;
+    if (0 == size) {
+        x1 = widget->x0 - 1;
+        y1 = widget->y0 - 1;
+    }
+    if (x1 != widget->x1 || y1 != widget->y1) {
+        // The old qrcode must be erased as well
+        addShownBounds(*widget);
+        widget->x1 = x1;
+        widget->y1 = y1;
+    }
+    widget->qrCode = qrCode;
+    widget->hash = value;
+}
+
+void DisplayList::setPlate(int id, const LicensePlate *plate)
+{
+    Widget *widget = find(id);
+    if (nullptr == widget || Type::PLATE != widget->type) {
+        return;
+    }
+
+    // The plate is laid out already, its sign, font and text are shown
+    uint32_t value = hash(&plate, sizeof(plate));
+    if (nullptr != plate) {
+        sFONT *font = plate->getFont();
+        value = hash(plate->getSign(), strlen(plate->getSign()), value);
+        value = hash(&font, sizeof(font), value);
+        value = hash(plate->getText(), strlen(plate->getText()), value);
+    }
+    widget->plate = plate;
+    widget->hash = value;
+}
+
+void DisplayList::setLevel(int id, int level)
+{
+    Widget *widget = find(id);
+    if (nullptr == widget || Type::BAR_GAUGE != widget->type) {
+        return;
+    }
+    widget->level = level;
+    widget->hash = hash(&level, sizeof(level));
+}
+
+bool DisplayList::getDirtyRegion(int *x0, int *y0, int *x1, int *y1)
+{
+    int rx0 = shownX0;
+    int ry0 = shownY0;
+    int rx1 = shownX1;
+    int ry1 = shownY1;
+
+    for (size_t i = 0; i < count; i++) {
+        const Widget &widget = widgets[i];
+        if (widget.hash == widget.shownHash || widget.x0 > widget.x1) {
+            continue;
+        }
+        if (rx0 > rx1) {
+            rx0 = widget.x0;
+            ry0 = widget.y0;
+            rx1 = widget.x1;
+            ry1 = widget.y1;
+        } else {
+            rx0 = std::min(rx0, widget.x0);
+            ry0 = std::min(ry0, widget.y0);
+            rx1 = std::max(rx1, widget.x1);
+            ry1 = std::max(ry1, widget.y1);
+        }
+    }
+    if (rx0 > rx1) {
+        return false;
+    }
+
+    // Widgets are painted completely, so the ones overlapping the region
+    // belong to it. The background is clipped to the region instead
+    bool grown = true;
+    while (grown) {
+        grown = false;
+        rx0 &= ~0x07;
+        rx1 |= 0x07;
+        for (size_t i = 0; i < count; i++) {
+            const Widget &widget = widgets[i];
+            if (Type::BACKGROUND == widget.type || widget.x0 > widget.x1) {
+                continue;
+            }
+            if (widget.x1 < rx0 || widget.x0 > rx1 || widget.y1 < ry0 || widget.y0 > ry1) {
+                continue;
+            }
+            if (widget.x0 < rx0 || widget.y0 < ry0 || widget.x1 > rx1 || widget.y1 > ry1) {
+                rx0 = std::min(rx0, widget.x0);
+                ry0 = std::min(ry0, widget.y0);
+                rx1 = std::max(rx1, widget.x1);
+                ry1 = std::max(ry1, widget.y1);
+                grown = true;
+            }
+        }
+    }
+
+    *x0 = rx0;
+    *y0 = ry0;
+    *x1 = rx1;
+    *y1 = ry1;
+    return true;
+}
+
+void DisplayList::markShown()
+{
+    for (size_t i = 0; i < count; i++) {
+        widgets[i].shownHash = widgets[i].hash;
+    }
+    shownX0 = 0;
+    shownY0 = 0;
+    shownX1 = -1;
+    shownY1 = -1;
+}
+
+void DisplayList::paint(Paint &painter, int x0, int y0, int x1, int y1)
+{
+    for (size_t i = 0; i < count; i++) {
+        const Widget &widget = widgets[i];
+        if (Type::BACKGROUND != widget.type &&
+            (widget.x1 < x0 || widget.x0 > x1 || widget.y1 < y0 || widget.y0 > y1)) {
+            continue;
+        }
+        paintWidget(painter, widget, x0, y0, x1, y1);
+    }
+}
+
+DisplayList::Widget *DisplayList::add(int id, Type type, int x0, int y0, int x1, int y1, int colored)
+{
+    if (count >= kMaxWidgets) {
+        return nullptr;
+    }
+
+    Widget *widget = &widgets[count++];
+    *widget = Widget();
+    widget->id = id;
+    widget->type = type;
+    widget->x0 = x0;
+    widget->y0 = y0;
+    widget->x1 = x1;
+    widget->y1 = y1;
+    widget->colored = colored;
+    return widget;
+}
+
+DisplayList::Widget *DisplayList::find(int id)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (id == widgets[i].id) {
+            return &widgets[i];
+        }
+    }
+    return nullptr;
+}
+
+void DisplayList::addShownBounds(const Widget &widget)
+{
+    if (widget.x0 > widget.x1) {
+        return;
+    }
+    if (shownX0 > shownX1) {
+        shownX0 = widget.x0;
+        shownY0 = widget.y0;
+        shownX1 = widget.x1;
+        shownY1 = widget.y1;
+        return;
+    }
+    shownX0 = std::min(shownX0, widget.x0);
+    shownY0 = std::min(shownY0, widget.y0);
+    shownX1 = std::max(shownX1, widget.x1);
+    shownY1 = std::max(shownY1, widget.y1);
+}
+
+void DisplayList::paintWidget(Paint &painter, const Widget &widget, int x0, int y0, int x1, int y1)
+{
+    switch (widget.type) {
+        case Type::BACKGROUND : {
+            uint8_t *band = painter.GetImage();
+            int bandY = painter.GetBandY();
+            int lineBytes = painter.GetWidth() / 8;
+
+            // Only the region within the current band is painted
+            x0 = std::max(x0, 0);
+            x1 = std::min(x1, widget.x1);
+            y0 = std::max(y0, bandY);
+            y1 = std::min(y1, bandY + painter.GetBandHeight() - 1);
+            if (x0 > x1 || y0 > y1) {
+                break;
+            }
+
+            // The background image is already in the polarity of the image buffer
+            int y = y0;
+            for (; y <= y1 && y <= widget.y1; y++) {
+                packedimage_decodeRow(widget.image, y, &band[(y - bandY) * lineBytes], x0 / 8, x1 / 8);
+            }
+            painter.AddDirtyRect(x0, y0, x1, y - 1);
+            if (y <= y1) {
+                painter.DrawAbsoluteFilledRectangle(x0, y, x1, y1, !widget.colored);
+            }
+            break;
+        }
+
+        case Type::TEXT :
+            widget.text.draw(painter, widget.x0, widget.y0, widget.x1 - widget.x0 + 1,
+                             widget.align, widget.colored);
+            break;
+
+        case Type::QRCODE : {
+            const QRCode *qrCode = widget.qrCode;
+            if (nullptr == qrCode) {
+                break;
+            }
+
+            // The modules are packed without row padding, dark ones are colored
+            painter.DrawScaledBitmap(widget.x0, widget.y0, qrCode->modules,
+                                     qrCode->size, qrCode->size, qrCode->size,
+                                     widget.scale, widget.colored);
+            break;
+        }
+
+        case Type::PLATE :
+            if (nullptr != widget.plate) {
+                widget.plate->draw(painter, widget.x0, widget.y0, widget.colored);
+            }
+            break;
+
+        case Type::BAR_GAUGE :
+            for (int i = 0; i < widget.bars; i++) {
+                int x = widget.x0 + i * (widget.barWidth + widget.gap);
+                painter.DrawFilledRectangle(x, widget.y0, x + widget.barWidth - 1, widget.y1,
+                                            i < widget.level ? widget.colored : !widget.colored);
+            }
+            break;
+    }
+}
+
+/**
+ * FNV-1a hash of the content
+ */
+uint32_t DisplayList::hash(const void *data, size_t length, uint32_t value)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+
+    for (size_t i = 0; i < length; i++) {
+        value ^= bytes[i];
+        value *= 16777619u;
+    }
+    return value;
+}
@@ -0,0 +1,160 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef DISPLAY_LIST_H
+#define DISPLAY_LIST_H
+
+
+#include "epdpaint.h"
+#include "LicensePlate.h"
+#include "PackedImage.h"
+#include "TextLayout.h"
+
+#include "QRCode/src/qrcode.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/**
+ * Retained list of the widgets a screen is made of
+ * @details Every widget has fixed bounds and a hash of its content.
+ *          Setting the same content again changes nothing, so after an
+ *          update only the region of the changed widgets must be painted
+ *          and sent to the display.
+ *          The widgets are painted in the order they were added, either into
+ *          a full frame buffer or into the band of a band buffer, see
+ *          Paint::SetBand().
+ */
+class DisplayList
+{
+public:
+    static constexpr size_t kMaxWidgets = 20;
+
+    DisplayList();
+    ~DisplayList();
+
+    /**
+     * Remove all widgets, e.g. to build another screen
+     */
+    void clear();
+
+    /**
+     * Add a full width background image, it is painted first and clipped to the
+     * painted region. The rows are decoded straight into the image buffer,
+     * rows below the image are painted uncolored.
+     */
+    bool addBackground(int id, const PackedImage *image, int colored);
+
+    /**
+     * Add a text field of width pixels, the text is aligned in it.
+     * Characters which do not fit are dropped, see TextLayout
+     */
+    bool addText(int id, int x, int y, int width, TextLayout::Align align, sFONT *font,
+                 int colored, const char *text = nullptr);
+
+    /**
+     * Add a qrcode with scale x scale pixels per module
+     */
+    bool addQRCode(int id, int x, int y, int scale, int colored);
+
+    /**
+     * Add a license plate of width pixels, see LicensePlate
+     */
+    bool addPlate(int id, int x, int y, int width, int colored);
+
+    /**
+     * Add a gauge of bars side by side, the first level bars are colored
+     */
+    bool addBarGauge(int id, int x, int y, int barWidth, int barHeight, int gap,
+                     int bars, int colored);
+
+    /**
+     * Set the content of a widget
+     */
+    void setText(int id, const char *text);
+    void setQRCode(int id, const QRCode *qrCode);
+    void setPlate(int id, const LicensePlate *plate);
+    void setLevel(int id, int level);
+
+    /**
+     * Get the region of all widgets changed since the last markShown().
+     * Widgets overlapping the region are added to it, x is 8 pixel aligned
+     */
+    bool getDirtyRegion(int *x0, int *y0, int *x1, int *y1);
+
+    /**
+     * The painted content has been sent to the display
+     */
+    void markShown();
+
+    /**
+     * Paint the region of the screen, both corners included.
+     * The widgets overlapping the region are painted completely
+     */
+    void paint(Paint &painter, int x0, int y0, int x1, int y1);
+
+private:
+    /**
+     * The kinds of widgets
+     */
+    enum class Type
+    {
+        BACKGROUND,
+        TEXT,
+        QRCODE,
+        PLATE,
+        BAR_GAUGE
+    };
+
+    struct Widget
+    {
+        int id;
+        Type type;
+        int x0, y0, x1, y1;     // bounds, both corners included
+        uint32_t hash;          // hash of the current content
+        uint32_t shownHash;     // hash of the content on the display
+        int colored;
+
+        const PackedImage *image;
+        sFONT *font;
+        TextLayout::Align align;
+        TextLayout text;        // text: laid out in the width of the bounds
+        const QRCode *qrCode;
+        int scale;              // qrcode: pixels per module
+        const LicensePlate *plate;
+        int barWidth;
+        int gap;
+        int bars;
+        int level;              // bar gauge: number of colored bars
+    };
+
+    Widget widgets[kMaxWidgets];
+    size_t count;
+
+    /* Bounds the changed widgets had on the display, e.g. of a smaller qrcode */
+    int shownX0, shownY0, shownX1, shownY1;
+
+    Widget *add(int id, Type type, int x0, int y0, int x1, int y1, int colored);
+    Widget *find(int id);
+    void setText(Widget *widget, const char *text);
+    void addShownBounds(const Widget &widget);
+    void paintWidget(Paint &painter, const Widget &widget, int x0, int y0, int x1, int y1);
+
+    static uint32_t hash(const void *data, size_t length, uint32_t value = 2166136261u);
+};
+
+
+#endif /* DISPLAY_LIST_H */
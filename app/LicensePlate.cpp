@@ -0,0 +1,203 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "LicensePlate.h"
+
+#include <ctype.h>
+#include <string.h>
+
+
+// The plate fonts from the largest to the smallest, see tools/pack_font.py
+extern sFONT PackedEuroFont9664;
+extern sFONT PackedEuroFont7248;
+extern sFONT PackedEuroFont4832;
+extern sFONT PackedEuroFont2416;
+
+static sFONT *const kFonts[] = { &PackedEuroFont9664, &PackedEuroFont7248, &PackedEuroFont4832 };
+
+// Glyphs of the plate fonts: the EU band, it shows the sign of germany,
+// and the registration badge
+constexpr char kBandGlyph = '!';
+constexpr const char *kBandSign = "D";
+constexpr char kBadgeGlyph = ':';
+
+// Other signs are drawn onto the band in place of the D
+constexpr int kSignX0 = 4;
+constexpr int kSignY0 = 38;
+constexpr int kSignX1 = 27;
+constexpr int kSignY1 = 56;
+constexpr int kSignY = 40;
+
+// Formats of the countries, see LicensePlate::Format
+static const LicensePlate::Format kFormats[] = {
+    { "D",   true,  ' ',  0, true,  9 },     // M:AB 1234E
+    { "A",   true,  ' ', -1, false, 8 },     // W 12345 X
+    { "B",   true,  '-', -1, false, 7 },     // 1-ABC-123
+    { "CH",  false, ' ', -1, false, 8 },     // ZH 123456
+    { "CZ",  true,  ' ', -1, false, 7 },     // 1A2 3456
+    { "DK",  true,  ' ', -1, false, 7 },     // AB 12 345
+    { "E",   true,  ' ', -1, false, 7 },     // 1234 BCD
+    { "F",   true,  '-', -1, false, 7 },     // AB-123-CD
+    { "FIN", true,  '-', -1, false, 6 },     // ABC-123
+    { "I",   true,  ' ', -1, false, 7 },     // AB 123CD
+    { "L",   true,  ' ', -1, false, 6 },     // AB 1234
+    { "NL",  true,  '-', -1, false, 6 },     // 12-ABC-3
+    { "PL",  true,  ' ', -1, false, 8 },     // WA 12345
+    { "S",   true,  ' ', -1, false, 6 },     // ABC 12A
+    { "UK",  true,  ' ', -1, false, 7 },     // AB12 CDE
+};
+
+// Countries without a format of their own
+static const LicensePlate::Format kDefaultFormat = { "", true, ' ', -1, false, 10 };
+
+
+LicensePlate::LicensePlate(int width) :
+              width(width),
+              format(&kFormats[0]),
+              font(kFonts[0])
+{
+    sign[0] = '\0';
+}
+
+LicensePlate::~LicensePlate()
+{
+
+}
+
+void LicensePlate::setLicense(const char *sign, const char *license)
+{
+    if ('\0' == sign[0]) {
+        sign = kFormats[0].sign;
+    }
+    size_t length = 0;
+    for (; length < kMaxSignLength && '\0' != sign[length]; length++) {
+        this->sign[length] = toupper((unsigned char)sign[length]);
+    }
+    this->sign[length] = '\0';
+
+    format = findFormat(this->sign);
+    if (nullptr == format) {
+        format = &kDefaultFormat;
+    }
+
+    char buffer[TextLayout::kMaxLength + 1];
+    formatLicense(license, buffer, sizeof(buffer));
+
+    // The largest font the license fits with, the smallest one drops the rest
+    int textWidth = width;
+    if (format->band) {
+        textWidth -= GetCharAdvance(kFonts[0], kBandGlyph);
+    }
+    size_t i = 0;
+    while (i + 1 < sizeof(kFonts) / sizeof(kFonts[0]) &&
+           TextLayout::measure(kFonts[i], buffer) > textWidth) {
+        i++;
+    }
+    font = kFonts[i];
+    text.layout(font, buffer, textWidth);
+}
+
+const LicensePlate::Format *LicensePlate::getFormat() const
+{
+    return format;
+}
+
+const char *LicensePlate::getSign() const
+{
+    return sign;
+}
+
+const char *LicensePlate::getText() const
+{
+    return text.getText();
+}
+
+sFONT *LicensePlate::getFont() const
+{
+    return font;
+}
+
+int LicensePlate::getWidth() const
+{
+    return width;
+}
+
+void LicensePlate::draw(Paint &painter, int x, int y, int colored) const
+{
+    int bandWidth = 0;
+
+    if (format->band) {
+        bandWidth = GetCharAdvance(kFonts[0], kBandGlyph);
+        painter.DrawCharAt(x, y, kBandGlyph, kFonts[0], colored);
+        if (0 != strcmp(sign, kBandSign)) {
+            painter.DrawFilledRectangle(x + kSignX0, y + kSignY0, x + kSignX1, y + kSignY1, colored);
+            int signX = x + (bandWidth - TextLayout::measure(&PackedEuroFont2416, sign)) / 2;
+            painter.DrawStringAt(signX, y + kSignY, sign, &PackedEuroFont2416, !colored);
+        }
+    }
+
+    // Smaller fonts are centered vertically
+    text.draw(painter, x + bandWidth, y + (kHeight - font->Height) / 2, width - bandWidth,
+              TextLayout::Align::CENTER, colored);
+}
+
+const LicensePlate::Format *LicensePlate::findFormat(const char *sign)
+{
+    for (const Format &entry : kFormats) {
+        if (0 == strcmp(sign, entry.sign)) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Join the groups of letters and digits of the license with the separator
+ * or the badge of the format. Never reads beyond the end of the license
+ */
+void LicensePlate::formatLicense(const char *license, char *buffer, size_t size) const
+{
+    size_t length = 0;
+    size_t count = 0;
+    int group = 0;
+    bool separate = false;
+    char last = '\0';
+
+    for (; '\0' != *license && count < format->maxLength; license++) {
+        char c = toupper((unsigned char)*license);
+        if (!isalnum((unsigned char)c)) {
+            separate = true;
+            continue;
+        }
+        if (format->splitNumber && isdigit((unsigned char)c) && isalpha((unsigned char)last)) {
+            separate = true;
+        }
+        if (separate && 0 < count) {
+            if (length + 2 >= size) {
+                break;
+            }
+            buffer[length++] = group == format->badgeGroup ? kBadgeGlyph : format->separator;
+            group++;
+        }
+        if (length + 1 >= size) {
+            break;
+        }
+        buffer[length++] = c;
+        separate = false;
+        last = c;
+        count++;
+    }
+    buffer[length] = '\0';
+}
@@ -0,0 +1,97 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef LICENSE_PLATE_H
+#define LICENSE_PLATE_H
+
+
+#include "epdpaint.h"
+#include "TextLayout.h"
+
+#include <stddef.h>
+
+
+/**
+ * License plate of a car as it is shown on the parking screen
+ * @details The letters and digits of a license are split into groups by
+ *          any other character, e.g. "M:AB1234" or "M AB 1234". The groups
+ *          are joined as on the plates of the country, see the formats in
+ *          LicensePlate.cpp, and laid out once in the largest plate font
+ *          which fits. The blue EU band with the distinguishing sign of the
+ *          country is drawn left of the license.
+ */
+class LicensePlate
+{
+public:
+    static constexpr int kHeight = 64;          // of the largest plate font
+    static constexpr size_t kMaxSignLength = 3;
+
+    /**
+     * Layout of the plates of a country
+     */
+    struct Format
+    {
+        const char *sign;       // distinguishing sign of the country, e.g. "D"
+        bool band;              // the plate has the EU band with the sign
+        char separator;         // drawn between the groups
+        int badgeGroup;         // the registration badge follows this group, -1 for none
+        bool splitNumber;       // letters and following digits are separate groups
+        size_t maxLength;       // letters and digits of the longest license
+    };
+
+    /**
+     * A plate of width pixels
+     */
+    explicit LicensePlate(int width);
+    ~LicensePlate();
+
+    /**
+     * Lay out the license of a car registered in the country with the sign,
+     * an empty sign is germany. Characters beyond the maximum length of
+     * the country and which do not fit the plate are dropped.
+     */
+    void setLicense(const char *sign, const char *license);
+
+    /**
+     * The laid out plate
+     */
+    const Format *getFormat() const;
+    const char *getSign() const;
+    const char *getText() const;
+    sFONT *getFont() const;
+    int getWidth() const;
+
+    /**
+     * Draw the plate with the top left corner at x, y
+     */
+    void draw(Paint &painter, int x, int y, int colored) const;
+
+    /**
+     * Get the format of the country with the sign, nullptr if there is none
+     */
+    static const Format *findFormat(const char *sign);
+
+private:
+    int width;
+    const Format *format;
+    char sign[kMaxSignLength + 1];
+    sFONT *font;
+    TextLayout text;
+
+    void formatLicense(const char *license, char *buffer, size_t size) const;
+};
+
+
+#endif /* LICENSE_PLATE_H */
@@ -18,16 +18,95 @@
 #include "boardmap.h"
 #include "helpers.h"
 
+#include <algorithm>
+
 #define COLORED     0
 #define UNCOLORED   1
 
-
-// RAM display buffer. Memory used 300 x 400 / 8 bytes
-uint8_t image[EPD_HEIGHT*(EPD_WIDTH/8 + 1)];
+// Widgets of the screens
+constexpr int kWidgetStatic = -1;       // content never changes
+constexpr int kWidgetBackground = 0;
+constexpr int kWidgetTemperature = 1;
+constexpr int kWidgetBattery = 2;
+constexpr int kWidgetQRCode = 3;
+constexpr int kWidgetTime = 4;
+constexpr int kWidgetDate = 5;
+constexpr int kWidgetPlate = 6;
+constexpr int kWidgetCountdown = 7;
+
+// License plate of the parking screen, up to the right edge
+constexpr int kPlateX = 10;
+constexpr int kPlateWidth = EPD_WIDTH - kPlateX;
+
+// Requests to the display thread
+constexpr uint32_t kRequestEnable = 0x01;
+constexpr uint32_t kRequestScreen = 0x02;
+constexpr uint32_t kRequestUpdate = 0x04;
+constexpr uint32_t kRequestDisable = 0x08;
+constexpr uint32_t kRequestAll = kRequestEnable | kRequestScreen | kRequestUpdate | kRequestDisable;
+
+// Information changed since the screen has been painted
+constexpr uint32_t kDirtyStatus = 0x01;     // temperature and battery level
+constexpr uint32_t kDirtyContent = 0x02;    // qrcode, license and parking end time
+constexpr uint32_t kDirtyCountdown = 0x04;  // remaining parking time
+
+
+// Keep a copy of the panel content in the display driver, so redraws
+// with unchanged pixels are not sent to the display.
+// Costs another frame of RAM, therefore disabled by default
+#ifndef DISPLAY_SHADOW_FRAME
+#define DISPLAY_SHADOW_FRAME 0
+#endif
+
+// The screens are drawn band by band into a small buffer and every band
+// is streamed to the display. While a band is sent in the background the
+// next one is drawn into a second buffer. The shadow frame compares full
+// frames, so then the band is the whole frame
+#ifndef DISPLAY_BAND_ROWS
+#define DISPLAY_BAND_ROWS 16
+#endif
+
+#if DISPLAY_SHADOW_FRAME
+constexpr int kBandRows = EPD_HEIGHT;
+constexpr int kBandBuffers = 1;
+#else
+constexpr int kBandRows = DISPLAY_BAND_ROWS;
+constexpr int kBandBuffers = 2;
+#endif
+
+// The remaining parking time counts down in steps of DISPLAY_COUNTDOWN_TICK
+// seconds, every step only repaints the countdown and refreshes it with the
+// fast waveforms. Each refresh costs energy and adds ghosting, so on average
+// at most DISPLAY_COUNTDOWN_BUDGET refreshes are spent per hour: while much
+// time is left the countdown takes coarser steps and saves the budget for
+// counting down the last minutes by the tick
+#ifndef DISPLAY_COUNTDOWN_TICK
+#define DISPLAY_COUNTDOWN_TICK 60
+#endif
+
+#ifndef DISPLAY_COUNTDOWN_BUDGET
+#define DISPLAY_COUNTDOWN_BUDGET 12
+#endif
+
+constexpr int kCountdownTick = DISPLAY_COUNTDOWN_TICK;
+constexpr int kCountdownCost = 3600 / DISPLAY_COUNTDOWN_BUDGET;     // seconds of budget per refresh
+constexpr int kCountdownMaxCredit = 3600;                           // budget saved up at most
+constexpr int kCountdownCoarseStep = (kCountdownCost + kCountdownTick - 1) / kCountdownTick * kCountdownTick;
+
+// RAM display buffers. Memory used kBandBuffers x kBandRows x 400 / 8 bytes
+uint8_t image[kBandBuffers][kBandRows * EPD_WIDTH / 8];
+
+#if DISPLAY_SHADOW_FRAME
+uint8_t shadowImage[EPD_HEIGHT*EPD_WIDTH/8];
+#endif
 
 // Private parking meter background image
-extern const uint8_t bg_welcomescreen[];
-extern const uint8_t bg_parkingscreen[];
+extern const PackedImage bg_welcomescreen;
+extern const PackedImage bg_parkingscreen;
+
+// Fonts packed with the characters of the screens, see tools/pack_font.py
+extern sFONT PackedFont24;
+extern sFONT PackedFont4040;
 
 // Epaper display driver
 Epd disp(EPAPER_WS42_MOSI,
@@ -42,12 +121,24 @@ Epd disp(EPAPER_WS42_MOSI,
 
 
 LicensePlateDisplay::LicensePlateDisplay() :
-              painter(image, EPD_WIDTH, EPD_HEIGHT),
+              painter(image[0], EPD_WIDTH, EPD_HEIGHT),
+              plate(kPlateWidth),
               temperature(23.3),
               batteryLevel(BatteryLevel::MEDIUM),
               qrCode(nullptr),
               license("xx:xx2020"),
-              parkingEndTime(1606004894)
+              parkingEndTime(1606004894),
+              countdownMinutes(-1),
+              countdownCredit(kCountdownMaxCredit),
+              countdownTime(0),
+              countdownTick(0),
+              thread(osPriorityBelowNormal, 4096),
+              screen(Screen::NONE),
+              requestedScreen(Screen::NONE),
+              dirty(0),
+              transition(Transition::DIRECT),
+              clearInterval(EPAPER_WS42_CLEAR_INTERVAL),
+              transitionCount(0)
 {
 
 }
@@ -59,224 +150,400 @@ LicensePlateDisplay::~LicensePlateDisplay()
 
 void LicensePlateDisplay::enable()
 {
-   disp.Init();
+    if (Thread::Inactive == thread.get_state()) {
+        thread.start(callback(this, &LicensePlateDisplay::run));
+    }
+    requests.set(kRequestEnable);
 }
 
 void LicensePlateDisplay::disable()
 {
-    disp.Sleep();
+    requests.set(kRequestDisable);
 }
 
 void LicensePlateDisplay::setTemperature(float temperature)
 {
+    mutex.lock();
     this->temperature = temperature;
+    dirty |= kDirtyStatus;
+    mutex.unlock();
 }
 
-void LicensePlateDisplay::setBatteryLevel(BatteryLevel batterylevel)
+void LicensePlateDisplay::setBatteryLevel(BatteryLevel batteryLevel)
 {
+    mutex.lock();
     this->batteryLevel = batteryLevel;
+    dirty |= kDirtyStatus;
+    mutex.unlock();
 }
 
-void LicensePlateDisplay::setQRCode(QRCode *qrCode)
+void LicensePlateDisplay::setQRCode(const QRCode *qrCode)
 {
+    mutex.lock();
     this->qrCode = qrCode;
+    dirty |= kDirtyContent;
+    mutex.unlock();
 }
 
-void LicensePlateDisplay::setLicense(std::string license)
+void LicensePlateDisplay::setLicense(std::string license, std::string country)
 {
+    mutex.lock();
     this->license = license;
+    this->country = country;
+    dirty |= kDirtyContent;
+    mutex.unlock();
 }
 
 void LicensePlateDisplay::setParkingEndTime(time_t parkingEndTime)
 {
+    mutex.lock();
     this->parkingEndTime = parkingEndTime;
+    dirty |= kDirtyContent;
+    mutex.unlock();
+}
+
+void LicensePlateDisplay::setTransition(Transition transition, unsigned int clearInterval)
+{
+    mutex.lock();
+    this->transition = transition;
+    this->clearInterval = clearInterval;
+    mutex.unlock();
 }
 
 void LicensePlateDisplay::showWelcomeScreen()
 {
-    // Clear frame and send the data
-    disp.ClearFrame();
-    disp.DisplayFrame();
+    mutex.lock();
+    requestedScreen = Screen::WELCOME;
+    mutex.unlock();
+    requests.set(kRequestScreen);
+}
 
-    paintWelcomeScreen();
+void LicensePlateDisplay::showParkingScreen()
+{
+    mutex.lock();
+    requestedScreen = Screen::PARKING;
+    mutex.unlock();
+    requests.set(kRequestScreen);
+}
 
-    // Now send the image data and refresh the display image
-    disp.SetPartialWindowBlack(painter.GetImage(), 0, 0,
-                               painter.GetWidth(), painter.GetHeight());
-    disp.DisplayFrame();
+void LicensePlateDisplay::updateStatus()
+{
+    requests.set(kRequestUpdate);
 }
 
-void LicensePlateDisplay::showParkingScreen()
+void LicensePlateDisplay::run()
 {
-    // Clear frame and send the data
-    disp.ClearFrame();
-    disp.DisplayFrame();
+    while (true) {
+        // All requests made since the last pass are handled at once,
+        // without requests the thread wakes up for the next countdown step
+        uint32_t flags = requests.wait_any(kRequestAll, getCountdownTimeout());
+        if (osFlagsErrorTimeout == flags) {
+            mutex.lock();
+            updateCountdown();
+            dirty |= kDirtyCountdown;
+            mutex.unlock();
+            showChanges();
+            continue;
+        }
+        if (flags & osFlagsError) {
+            continue;
+        }
 
-    paintParkingScreen();
+        if (flags & kRequestEnable) {
+            disp.SetSpiFrequency(EPAPER_WS42_SPI_FREQ);
+            disp.SetFullRefreshInterval(EPAPER_WS42_FULL_REFRESH_INTERVAL);
+            disp.Init();
+#if DISPLAY_SHADOW_FRAME
+            disp.SetShadowFrame(shadowImage);
+#endif
+        }
 
-    // Now send the image data and refresh the display image
-    disp.SetPartialWindowBlack(painter.GetImage(), 0, 0,
-                               painter.GetWidth(), painter.GetHeight());
-    disp.DisplayFrame();
+        if (flags & (kRequestScreen | kRequestUpdate)) {
+            mutex.lock();
+            Screen next = requestedScreen;
+            mutex.unlock();
+
+            // An update only repaints the widgets with changed content
+            if (Screen::NONE == next) {
+                // Nothing shown yet
+            } else if ((flags & kRequestScreen) || next != screen) {
+                showScreen(next);
+            } else {
+                showChanges();
+            }
+        }
+
+        if (flags & kRequestDisable) {
+            disp.Sleep();
+        }
+    }
 }
 
-void LicensePlateDisplay::paintWelcomeScreen()
+void LicensePlateDisplay::showScreen(Screen next)
 {
-    // Clear the display buffer
-    painter.Clear(UNCOLORED);
-
-    // Draw the background image
-    memcpy(image, bg_welcomescreen, sizeof(image));
-    // We have to invert the buffer image buffer
-    for (int i = 0; i <= sizeof(image); i++) {
-        image[i] = ~image[i];
+    // A new screen gets a full refresh without ghosting
+    disp.SetRefreshMode(EPD_REFRESH_FULL);
+
+    // Clearing the panel first costs a second refresh,
+    // so the direct transition does it only now and then
+    transitionCount++;
+    if (Transition::CLEAR == transition ||
+        (0 != clearInterval && transitionCount >= clearInterval)) {
+        disp.ClearFrame();
+        refreshDisplay();
+        transitionCount = 0;
     }
 
-    // Draw the temperature value in the top right corner
-    paintTemperature();
-
-    // Draw the battery level in the top right corner
-    paintBatteryLevel();
-
-    if (nullptr != qrCode) {
-        constexpr int kScale = 5;
-        constexpr int xOrigin = 30;
-        constexpr int yOrigin = 100;
-
-        // Draw the QRCode
-        for (uint8_t y = 0; y < qrCode->size; y++) {
-            for (uint8_t x = 0; x < qrCode->size; x++) {
-                painter.DrawFilledRectangle(xOrigin + (x * kScale),
-                                            yOrigin + (y * kScale),
-                                            xOrigin + (x * kScale) + kScale,
-                                            yOrigin + (y * kScale) + kScale,
-                                            (int)!qrcode_getModule(qrCode, x, y));
-            }
-        }
+    mutex.lock();
+    if (Screen::WELCOME == next) {
+        buildWelcomeScreen();
+    } else {
+        buildParkingScreen();
+        updateCountdown();
+    }
+    updateWidgets();
+    dirty = 0;
+
+    // Stream the screen to the display band by band. Only the widgets
+    // overlapping a band are painted over the background rows, and the
+    // band is painted while the one before is still being sent
+    int result = 0;
+    disp.StreamWindowBegin(0, 0, painter.GetWidth(), EPD_HEIGHT);
+    for (int y = 0, i = 0; y < EPD_HEIGHT && 0 == result; y += kBandRows, i++) {
+        painter.SetImage(image[i % kBandBuffers]);
+        painter.SetBand(y, kBandRows);
+        displayList.paint(painter, 0, y, EPD_WIDTH - 1, y + painter.GetBandHeight() - 1);
+        result = disp.StreamWindowRows(painter.GetImage(), painter.GetBandHeight());
+    }
+    if (0 != disp.StreamWindowEnd()) {
+        result = -1;
     }
+    displayList.markShown();
+    mutex.unlock();
+
+    if (0 != result) {
+        // The screen did not get sent, try to recover with a new initialization
+        printf("EPD: display transfer timed out\r\n");
+        disp.Init();
+        return;
+    }
+
+    // Now refresh the display image
+    refreshDisplay();
+    painter.ClearDirtyRect();
+    screen = next;
 }
 
-void LicensePlateDisplay::paintParkingScreen()
+void LicensePlateDisplay::showChanges()
 {
-    // Clear the display buffer
-    painter.Clear(UNCOLORED);
-
-    // Draw the background image
-    memcpy(image, bg_parkingscreen, sizeof(image));
-    // We have to invert the buffer image buffer
-    for (int i = 0; i <= sizeof(image); i++) {
-        image[i] = ~image[i];
+    int x0, y0, x1, y1;
+
+    mutex.lock();
+    if (0 == dirty) {
+        mutex.unlock();
+        return;
+    }
+    if ((dirty & kDirtyContent) && Screen::PARKING == screen) {
+        // The parking end time may have changed
+        updateCountdown();
+    }
+    dirty = 0;
+
+    // Nothing to do, if the shown information is still valid
+    updateWidgets();
+    if (false == displayList.getDirtyRegion(&x0, &y0, &x1, &y1)) {
+        mutex.unlock();
+        return;
     }
 
-    // Draw the temperature value in the top right corner
-    paintTemperature();
+    // Small updates use the fast waveforms, the driver inserts a full
+    // refresh from time to time to remove the ghosting
+    disp.SetRefreshMode(EPD_REFRESH_FAST);
 
-    // Draw the battery level in the top right corner
-    paintBatteryLevel();
+    // Only repaint the changed region, band by band
+    // if the band has less rows than the region
+    for (int y = y0; y <= y1; y += kBandRows) {
+        painter.SetBand(std::min(y, EPD_HEIGHT - kBandRows), kBandRows);
+        displayList.paint(painter, x0, y0, x1, y1);
+        sendDirtyRegion();
+    }
+    displayList.markShown();
+    mutex.unlock();
+
+#if DISPLAY_SHADOW_FRAME
+    // The driver finds the changed pixels itself and skips identical redraws
+    int bands = disp.DisplayFrameDiff(painter.GetImage());
+    if (bands < 0) {
+        printf("EPD: display refresh timed out\r\n");
+        disp.Init();
+    } else if (bands > 0) {
+        printf("EPD: %d bands refreshed in %d ms\r\n", bands, disp.GetLastRefreshTime());
+    }
+#else
+    refreshDisplay();
+#endif
+}
 
-    // Convert timestamp to string
-    char buffer[5];
-    char oneCharBuffer[2] = "";
-    std::tm * ptm = std::localtime(&parkingEndTime);
+void LicensePlateDisplay::sendDirtyRegion()
+{
+#if !DISPLAY_SHADOW_FRAME
+    // With the shadow frame the whole frame is compared on refresh instead
+    int x, y, w, h;
+
+    if (true == painter.GetDirtyRect(&x, &y, &w, &h)) {
+        disp.SetPartialWindowBlackBand(painter.GetImage(), painter.GetWidth(), painter.GetBandY(),
+                                       x, y, w, h);
+    }
+#endif
+    painter.ClearDirtyRect();
+}
 
-    // Draw the parking end time
-    std::strftime(buffer, sizeof(buffer), "%H%M", ptm);
-
-    oneCharBuffer[0] = buffer[0];
-    painter.DrawStringAt(100, 115, oneCharBuffer, &Font4040, COLORED);
-    oneCharBuffer[0] = buffer[1];
-    painter.DrawStringAt(130, 115, oneCharBuffer, &Font4040, COLORED);
-    painter.DrawStringAt(155, 115, ":", &Font4040, COLORED);
-    oneCharBuffer[0] = buffer[2];
-    painter.DrawStringAt(175, 115, oneCharBuffer, &Font4040, COLORED);
-    oneCharBuffer[0] = buffer[3];
-    painter.DrawStringAt(205, 115, oneCharBuffer, &Font4040, COLORED);
-
-    // Draw the parking end date
-    std::strftime(buffer, sizeof(buffer), "%d%m", ptm);
-
-    oneCharBuffer[0] = buffer[0];
-    painter.DrawStringAt(260, 140, oneCharBuffer, &Font4040, COLORED);
-    oneCharBuffer[0] = buffer[1];
-    painter.DrawStringAt(290, 140, oneCharBuffer, &Font4040, COLORED);
-    painter.DrawStringAt(315, 140, ".", &Font4040, COLORED);
-    oneCharBuffer[0] = buffer[2];
-    painter.DrawStringAt(330, 140, oneCharBuffer, &Font4040, COLORED);
-    oneCharBuffer[0] = buffer[3];
-    painter.DrawStringAt(360, 140, oneCharBuffer, &Font4040, COLORED);
-
-    // Draw the license plate
-    constexpr int ralign = 35;
-
-    // Country identifier (DE right now)
-    painter.DrawStringAt(5,   210, "!", &EuroFont9664, COLORED);
-
-    // Area code
-    oneCharBuffer[0] = license[0];
-    painter.DrawStringAt(ralign,   210, oneCharBuffer, &EuroFont9664, COLORED);
-    oneCharBuffer[0] = license[1];
-    painter.DrawStringAt(ralign + 40,  210, oneCharBuffer, &EuroFont9664, COLORED);
-
-    // Badge
-    painter.DrawStringAt(ralign + 75,  210, ":", &EuroFont9664, COLORED);
-
-    // Random letters
-    oneCharBuffer[0] = license[3];
-    painter.DrawStringAt(ralign + 115, 210, oneCharBuffer, &EuroFont9664, COLORED);
-    oneCharBuffer[0] = license[4];
-    painter.DrawStringAt(ralign + 155, 210, oneCharBuffer, &EuroFont9664, COLORED);
-
-    // Random Number
-    oneCharBuffer[0] = license[5];
-    painter.DrawStringAt(ralign + 200, 210, oneCharBuffer, &EuroFont9664, COLORED);
-    oneCharBuffer[0] = license[6];
-    painter.DrawStringAt(ralign + 240, 210, oneCharBuffer, &EuroFont9664, COLORED);
-    oneCharBuffer[0] = license[7];
-    painter.DrawStringAt(ralign + 280, 210, oneCharBuffer, &EuroFont9664, COLORED);
-    oneCharBuffer[0] = license[8];
-    painter.DrawStringAt(ralign + 320, 210, oneCharBuffer, &EuroFont9664, COLORED);
+void LicensePlateDisplay::refreshDisplay()
+{
+    if (0 != disp.DisplayFrame()) {
+        // The controller did not get idle, try to recover with a new initialization
+        printf("EPD: display refresh timed out\r\n");
+        disp.Init();
+        return;
+    }
+    printf("EPD: display refreshed in %d ms\r\n", disp.GetLastRefreshTime());
+}
+
+void LicensePlateDisplay::buildWelcomeScreen()
+{
+    displayList.clear();
+
+    // The background image, the rows below it stay blank
+    displayList.addBackground(kWidgetBackground, &bg_welcomescreen, COLORED);
+
+    // The temperature value and the battery level in the top right corner
+    displayList.addText(kWidgetTemperature, 243, 26, 84, TextLayout::Align::RIGHT, &PackedFont24, COLORED);
+    displayList.addBarGauge(kWidgetBattery, 340, 30, 11, 12, 1, 3, COLORED);
+
+    // The qrcode for the customer interaction
+    displayList.addQRCode(kWidgetQRCode, 30, 100, 5, COLORED);
+}
+
+void LicensePlateDisplay::buildParkingScreen()
+{
+    displayList.clear();
+
+    // The background image, the rows below it stay blank
+    displayList.addBackground(kWidgetBackground, &bg_parkingscreen, COLORED);
+
+    // The temperature value and the battery level in the top right corner
+    displayList.addText(kWidgetTemperature, 243, 26, 84, TextLayout::Align::RIGHT, &PackedFont24, COLORED);
+    displayList.addBarGauge(kWidgetBattery, 340, 30, 11, 12, 1, 3, COLORED);
 
+    // The parking end time and date, the remaining time below the end time
+    displayList.addText(kWidgetTime, 100, 115, 140, TextLayout::Align::CENTER, &PackedFont4040, COLORED);
+    displayList.addText(kWidgetCountdown, 100, 170, 140, TextLayout::Align::CENTER, &PackedFont24, COLORED);
+    displayList.addText(kWidgetDate, 260, 140, 136, TextLayout::Align::CENTER, &PackedFont4040, COLORED);
+
+    // The license plate with the country identifier
+    displayList.addPlate(kWidgetPlate, kPlateX, 210, kPlateWidth, COLORED);
 }
 
-void LicensePlateDisplay::paintBatteryLevel()
+void LicensePlateDisplay::updateWidgets()
 {
-    int colorBar1, colorBar2, colorBar3;
+    char buffer[10];
+
+    formatTemperature(buffer, sizeof(buffer));
+    displayList.setText(kWidgetTemperature, buffer);
 
     switch (batteryLevel) {
         case BatteryLevel::FULL :
-            colorBar1 = COLORED;
-            colorBar2 = COLORED;
-            colorBar3 = COLORED;
+            displayList.setLevel(kWidgetBattery, 3);
             break;
         case BatteryLevel::MEDIUM :
-            colorBar1 = COLORED;
-            colorBar2 = COLORED;
-            colorBar3 = UNCOLORED;
+            displayList.setLevel(kWidgetBattery, 2);
             break;
         case BatteryLevel::LITTLE :
-            colorBar1 = COLORED;
-            colorBar2 = UNCOLORED;
-            colorBar3 = UNCOLORED;
+            displayList.setLevel(kWidgetBattery, 1);
             break;
         case BatteryLevel::EMPTY :
         default :
-            colorBar1 = UNCOLORED;
-            colorBar2 = UNCOLORED;
-            colorBar3 = UNCOLORED;
+            displayList.setLevel(kWidgetBattery, 0);
             break;
     }
 
-    // Draw the 3 bars
-    painter.DrawFilledRectangle(340, 30, 350, 41, colorBar1);
-    painter.DrawFilledRectangle(352, 30, 362, 41, colorBar2);
-    painter.DrawFilledRectangle(364, 30, 374, 41, colorBar3);
+    displayList.setQRCode(kWidgetQRCode, qrCode);
+
+    // Convert timestamp to string
+    std::tm * ptm = std::localtime(&parkingEndTime);
+
+    std::strftime(buffer, sizeof(buffer), "%H:%M", ptm);
+    displayList.setText(kWidgetTime, buffer);
+
+    std::strftime(buffer, sizeof(buffer), "%d.%m", ptm);
+    displayList.setText(kWidgetDate, buffer);
+
+    formatCountdown(buffer, sizeof(buffer));
+    displayList.setText(kWidgetCountdown, buffer);
+
+    plate.setLicense(country.c_str(), license.c_str());
+    displayList.setPlate(kWidgetPlate, &plate);
+}
+
+void LicensePlateDisplay::updateCountdown()
+{
+    time_t now = time(nullptr);
+    int remaining = parkingEndTime > now ? (int)(parkingEndTime - now) : 0;
+
+    // The budget fills up with the time passed
+    if (0 != countdownTime) {
+        countdownCredit = std::min<int>(kCountdownMaxCredit, countdownCredit + (int)(now - countdownTime));
+    }
+    countdownTime = now;
+
+    // Count down by the tick, if the budget suffices for all
+    // steps left, otherwise in the steps the budget allows
+    int steps = (remaining + kCountdownTick - 1) / kCountdownTick;
+    int step = kCountdownTick;
+    if (steps * kCountdownCost > countdownCredit + remaining) {
+        step = kCountdownCoarseStep;
+    }
+
+    // The shown time is rounded up to the step, it is never less than the time left.
+    // The next step is due when the remaining time reaches the next multiple of the step
+    int minutes = (remaining + step - 1) / step * step / 60;
+    countdownTick = 0;
+    if (0 < remaining) {
+        countdownTick = now + (0 != remaining % step ? remaining % step : step);
+    }
+    if (minutes != countdownMinutes) {
+        countdownCredit = std::max(0, countdownCredit - kCountdownCost);
+        countdownMinutes = minutes;
+    }
+}
+
+uint32_t LicensePlateDisplay::getCountdownTimeout()
+{
+    mutex.lock();
+    time_t tick = countdownTick;
+    Screen shown = screen;
+    mutex.unlock();
+
+    if (Screen::PARKING != shown || 0 == tick) {
+        return osWaitForever;
+    }
+    // A due step still waits a moment, a timeout of 0 would not wait at all
+    time_t now = time(nullptr);
+    return tick > now ? (uint32_t)(tick - now) * 1000 : 1;
+}
+
+void LicensePlateDisplay::formatCountdown(char *buffer, size_t size)
+{
+    if (countdownMinutes >= 60) {
+        snprintf(buffer, size, "%d:%02d h", countdownMinutes / 60, countdownMinutes % 60);
+    } else {
+        snprintf(buffer, size, "%d min", std::max(countdownMinutes, 0));
+    }
 }
 
-void LicensePlateDisplay::paintTemperature()
+void LicensePlateDisplay::formatTemperature(char *buffer, size_t size)
 {
     char bufferTmp[10];
-    char bufferShowValue[8];
 
-    snprintf(bufferShowValue, sizeof(bufferShowValue), "%4sC", print_double(bufferTmp, temperature, 1));
-    painter.DrawStringAt(243, 26, bufferShowValue, &Font24, COLORED);
+    snprintf(buffer, size, "%sC", print_double(bufferTmp, temperature, 1));
 }
@@ -19,6 +19,7 @@
 
 #include "epd4in2b.h"
 #include "epdpaint.h"
+#include "DisplayList.h"
 
 #include "QRCode/src/qrcode.h"
 
@@ -38,9 +39,25 @@ enum class BatteryLevel
 };
 
 
+/**
+  * How the display changes from one screen to the next
+  */
+enum class Transition
+{
+    DIRECT,     // upload the new screen and refresh once
+    CLEAR       // show a blank screen first, removes all ghosting
+};
+
+
 /**
  * EPaper Diplay controlling class.
  * for show  
+ * @details The display implements its own thread, since a refresh
+ *          of the panel takes seconds. The setters only store the
+ *          information, the show and update calls are requests to the
+ *          display thread and return right away.
+ *          Requests made during a running refresh are combined into
+ *          one following refresh.
  */
 class LicensePlateDisplay
 {
@@ -49,7 +66,7 @@ public:
     ~LicensePlateDisplay();
 
     /**
-     * Enable the Epaper display 
+     * Enable the Epaper display and start the display thread
      */
     void enable();
 
@@ -72,62 +89,149 @@ public:
     /**
      * Set the QRCode to show, if parking lot is not booked
      */
-    void setQRCode(QRCode *code);
+    void setQRCode(const QRCode *code);
 
     /**
-     * Set the license information of the parking car.
-     * Shown with the parking screen 
+     * Set the license information of the parking car and the distinguishing
+     * sign of its country, e.g. "F". Shown with the parking screen,
+     * an empty sign is germany
      */
-    void setLicense(std::string license);
+    void setLicense(std::string license, std::string country = std::string());
     
     /**
      * Set the parking end time.
-     * Shown with the parking screen 
+     * Shown with the parking screen, together with the remaining time
      */
     void setParkingEndTime(time_t parkingEndTime);
 
 
     /**
-     * Show the qrcode on the display, for customer interaction
+     * Set how screens are changed. With the direct transition every
+     * clearInterval-th screen change is done with clearing, 0 never clears
+     */
+    void setTransition(Transition transition, unsigned int clearInterval = 0);
+
+
+    /**
+     * Request to show the qrcode on the display, for customer interaction
      */
     void showWelcomeScreen();
 
     /**
-     * Show the parking screen, when the parking lot has been booked
+     * Request to show the parking screen, when the parking lot has been booked
      */
     void showParkingScreen();
 
+    /**
+     * Request to update the shown screen with the changed information.
+     * Only the region of the changed information is sent to the display
+     */
+    void updateStatus();
+
 private:
+    /**
+     * The screen currently shown on the display
+     */
+    enum class Screen
+    {
+        NONE,
+        WELCOME,
+        PARKING
+    };
+
     float temperature;
     BatteryLevel batteryLevel;
-    QRCode *qrCode;
+    const QRCode *qrCode;
     std::string license;
+    std::string country;
     time_t parkingEndTime;
-    
+
+    int countdownMinutes;   // remaining parking time shown
+    int countdownCredit;    // seconds of refresh budget left, see DISPLAY_COUNTDOWN_BUDGET
+    time_t countdownTime;   // when the countdown was updated
+    time_t countdownTick;   // when the next countdown step is due, 0 for none
+
+    Thread thread;
+    EventFlags requests;
+    Mutex mutex;        // guards the information shown on the screen
+
+    Screen screen;
+    Screen requestedScreen;
+    uint32_t dirty;     // information changed since it has been painted
+    Transition transition;
+    unsigned int clearInterval;
+    unsigned int transitionCount;   // screen changes since the last clearing
+
     Paint painter;
-    
+    DisplayList displayList;        // widgets of the shown screen
+    LicensePlate plate;             // license laid out for the parking screen
+
+    /**
+     * Is automatically called by Mbed os
+     */
+    void run();
+
+    /**
+     * Paint the next screen in the image buffer and
+     * change the display to it
+     */
+    void showScreen(Screen next);
+
+    /**
+     * Repaint the widgets with changed information
+     * and send the changed region to the display
+     */
+    void showChanges();
+
+    /**
+     * Send the region drawn in the current band since the last
+     * update to the display
+     */
+    void sendDirtyRegion();
+
+    /**
+     * Refresh the display image with the data sent to the display
+     * and report the refresh duration
+     */
+    void refreshDisplay();
+
+    /**
+     * Build the widgets of the welcome screen with the qrcode
+     */
+    void buildWelcomeScreen();
+
+    /**
+     * Build the widgets of the parking screen with the license
+     * plate of the parking car and the end time and date
+     */
+    void buildParkingScreen();
+
+    /**
+     * Set the information to show in the widgets of the screen,
+     * only widgets with changed content must be repainted
+     */
+    void updateWidgets();
+
     /**
-     * Load the welcome screen and draw the qrcode 
-     * in the image buffer
+     * Count down the remaining parking time by the current step and
+     * schedule the next step within the refresh budget
      */
-    void paintWelcomeScreen();
+    void updateCountdown();
 
     /**
-     * Draw the license plate of the parking car and 
-     * end time and date in the image buffer
+     * Get the milliseconds until the next countdown step of the shown screen
      */
-    void paintParkingScreen();
+    uint32_t getCountdownTimeout();
 
     /**
-     * Paint the battery level on the top right corner
-     * This actually updates the bars 
+     * Format the remaining parking time as shown on the display
      */
-    void paintBatteryLevel();
+    void formatCountdown(char *buffer, size_t size);
 
     /**
-     * Update the temperature information with the image buffer 
+     * Format the temperature text as shown on the display
      */
-    void paintTemperature();
+    void formatTemperature(char *buffer, size_t size);
 };
 
 
@@ -0,0 +1,49 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "PackedImage.h"
+
+#include <string.h>
+
+
+void packedimage_decodeRow(const PackedImage *image, int y, uint8_t *buffer, int first, int last)
+{
+    const uint8_t *src = &image->data[image->rows[y]];
+    int x = 0;
+
+    while (x <= last) {
+        int n = (int8_t)*src++;
+
+        if (n >= 0) {
+            // Literal bytes, only the ones within first to last are copied
+            int from = x > first ? x : first;
+            int to = x + n < last ? x + n : last;
+            if (from <= to) {
+                memcpy(&buffer[from], &src[from - x], to - from + 1);
+            }
+            src += n + 1;
+            x += n + 1;
+        } else if (n != -128) {
+            // Repeated byte
+            int from = x > first ? x : first;
+            int to = x - n < last ? x - n : last;
+            if (from <= to) {
+                memset(&buffer[from], *src, to - from + 1);
+            }
+            src++;
+            x += 1 - n;
+        }
+    }
+}
@@ -0,0 +1,45 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef PACKED_IMAGE_H
+#define PACKED_IMAGE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * 1bpp image in the polarity of the display buffer, every row
+ * is PackBits coded on its own. Generated with tools/pack_image.py
+ */
+typedef struct PackedImage {
+    uint16_t width;
+    uint16_t height;
+    const uint16_t *rows;   // offset of every coded row in data
+    const uint8_t *data;    // n >= 0: copy n + 1 bytes, n < 0: repeat the next byte 1 - n times
+} PackedImage;
+
+/**
+ * Decode the bytes first to last of the row y into buffer[first] to buffer[last]
+ */
+void packedimage_decodeRow(const PackedImage *image, int y, uint8_t *buffer, int first, int last);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PACKED_IMAGE_H */
@@ -0,0 +1,68 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "QRCodeService.h"
+
+
+QRCodeService::QRCodeService() : current(-1)
+{
+    qrcode_initWorkspace(&workspace, workspaceBuffer, kMaxVersion, kMaxPayloadLength);
+}
+
+QRCodeService::~QRCodeService()
+{
+
+}
+
+const QRCode *QRCodeService::encode(const std::string &token)
+{
+    if (-1 != current && token == this->token) {
+        return &codes[current];
+    }
+
+    if (token.size() > (size_t)kMaxTokenLength) {
+        printf("QR: session token of %d characters is too long\r\n", (int)token.size());
+        return nullptr;
+    }
+
+    char payload[kMaxPayloadLength + 1];
+    snprintf(payload, sizeof(payload), "%s,s=%s", QRCODE_APP_ID, token.c_str());
+
+    // Encode into the code not shown
+    int next = (0 == current) ? 1 : 0;
+
+    Timer timer;
+    timer.start();
+    int8_t result = qrcode_initTextWorkspace(&workspace, &codes[next], modules[next], ECC_LOW, payload);
+    timer.stop();
+
+    if (0 != result) {
+        printf("QR: session code does not fit version %d\r\n", kMaxVersion);
+        return nullptr;
+    }
+
+    current = next;
+    this->token = token;
+
+    printf("QR: session code version %d encoded in %d us\r\n", codes[current].version,
+           (int)std::chrono::duration_cast<std::chrono::microseconds>(timer.elapsed_time()).count());
+
+    return &codes[current];
+}
+
+const QRCode *QRCodeService::getQRCode() const
+{
+    return (-1 == current) ? nullptr : &codes[current];
+}
@@ -0,0 +1,70 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef QRCODE_SERVICE_H
+#define QRCODE_SERVICE_H
+
+#include "mbed.h"
+#include <string>
+
+#include "boardmap.h"
+
+#include "QRCode/src/qrcode.h"
+
+
+/**
+ * Encodes the QRCode of a session, the app id with the session token
+ * sent by the server, e.g. "LicensePlate2Tangle,uid=...,s=<token>"
+ * @details All buffers are members, so a static service needs no heap
+ *          and no stack for encoding. The function patterns of the last
+ *          version are kept, a new token only draws the data again.
+ *          The codes are double buffered, the display keeps painting
+ *          the previous one while the next is encoded.
+ */
+class QRCodeService
+{
+public:
+    QRCodeService();
+    ~QRCodeService();
+
+    /**
+     * Encode the QRCode of the session token, reports the duration.
+     * The same token returns the current code without encoding again
+     * @return the code, nullptr if the token is too long
+     */
+    const QRCode *encode(const std::string &token);
+
+    /**
+     * Get the last encoded code, nullptr if there is none
+     */
+    const QRCode *getQRCode() const;
+
+private:
+    constexpr static uint8_t kMaxVersion = 5;       // 37 modules, the most the welcome screen fits
+    constexpr static int kMaxTokenLength = 32;
+    constexpr static int kMaxPayloadLength = sizeof(QRCODE_APP_ID ",s=") - 1 + kMaxTokenLength;
+
+    QRCodeWorkspace workspace;
+    uint8_t workspaceBuffer[QRCODE_WORKSPACE_SIZE(kMaxVersion, kMaxPayloadLength)];
+
+    QRCode codes[2];
+    uint8_t modules[2][QRCODE_BUFFER_SIZE(kMaxVersion)];
+    int current;        // index of the last encoded code, -1 for none
+
+    std::string token;  // of the last encoded code
+};
+
+
+#endif /* QRCODE_SERVICE_H */
@@ -0,0 +1,105 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "TextLayout.h"
+
+#include <string.h>
+
+
+TextLayout::TextLayout() :
+              font(nullptr),
+              maxWidth(0),
+              length(0),
+              next('\0'),
+              width(0)
+{
+    text[0] = '\0';
+}
+
+TextLayout::~TextLayout()
+{
+
+}
+
+void TextLayout::layout(sFONT *font, const char *text, int maxWidth)
+{
+    // The same text is laid out again and again, e.g. on every update.
+    // A text with the same characters up to the first dropped one has the same layout
+    if (font == this->font && maxWidth == this->maxWidth &&
+        0 == strncmp(text, this->text, length) && next == text[length]) {
+        return;
+    }
+
+    this->font = font;
+    this->maxWidth = maxWidth;
+    length = 0;
+    width = 0;
+    for (; length < kMaxLength && '\0' != text[length]; length++) {
+        int advance = GetCharAdvance(font, text[length]);
+        if (width + advance > maxWidth) {
+            break;
+        }
+        this->text[length] = text[length];
+        width += advance;
+    }
+    this->text[length] = '\0';
+    next = text[length];
+}
+
+const char *TextLayout::getText() const
+{
+    return text;
+}
+
+size_t TextLayout::getLength() const
+{
+    return length;
+}
+
+int TextLayout::getWidth() const
+{
+    return width;
+}
+
+int TextLayout::getX(int x, int width, Align align) const
+{
+    switch (align) {
+        case Align::CENTER :
+            return x + (width - this->width) / 2;
+        case Align::RIGHT :
+            return x + width - this->width;
+        case Align::LEFT :
+        default :
+            return x;
+    }
+}
+
+void TextLayout::draw(Paint &painter, int x, int y, int width, Align align, int colored) const
+{
+    if (nullptr == font || 0 == length) {
+        return;
+    }
+    painter.DrawStringAt(getX(x, width, align), y, text, font, colored);
+}
+
+int TextLayout::measure(const sFONT *font, const char *text)
+{
+    int width = 0;
+
+    for (; '\0' != *text; text++) {
+        width += GetCharAdvance(font, *text);
+    }
+    return width;
+}
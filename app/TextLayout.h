@@ -0,0 +1,89 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+
+#include "epdpaint.h"
+
+#include <stddef.h>
+
+
+/**
+ * Layout of a single line of text in a box
+ * @details The characters advance by their own width, see GetCharAdvance(),
+ *          so packed fonts are proportional. The metrics of the last laid out
+ *          text are kept, laying out the same text again costs a compare and
+ *          drawing it into every band of a screen needs no measuring.
+ *          The text is drawn in one pass with Paint::DrawStringAt().
+ */
+class TextLayout
+{
+public:
+    static constexpr size_t kMaxLength = 15;
+
+    /**
+     * Horizontal alignment of the text in its box
+     */
+    enum class Align
+    {
+        LEFT,
+        CENTER,
+        RIGHT
+    };
+
+    TextLayout();
+    ~TextLayout();
+
+    /**
+     * Lay out the text, the characters which do not fit into maxWidth pixels
+     * or beyond kMaxLength are dropped
+     */
+    void layout(sFONT *font, const char *text, int maxWidth);
+
+    /**
+     * Metrics of the laid out text
+     */
+    const char *getText() const;
+    size_t getLength() const;
+    int getWidth() const;
+
+    /**
+     * Get the x of the first character, aligned in the box of width pixels at x
+     */
+    int getX(int x, int width, Align align) const;
+
+    /**
+     * Draw the laid out text aligned in the box of width pixels at x
+     */
+    void draw(Paint &painter, int x, int y, int width, Align align, int colored) const;
+
+    /**
+     * Width of a text in pixels without laying it out
+     */
+    static int measure(const sFONT *font, const char *text);
+
+private:
+    sFONT *font;
+    int maxWidth;
+    char text[kMaxLength + 1];
+    size_t length;
+    char next;              // first character dropped, '\0' if none
+    int width;              // sum of the advances of the characters
+};
+
+
+#endif /* TEXT_LAYOUT_H */
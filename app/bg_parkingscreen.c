@@ -1,905 +1,399 @@
-#include <stdint.h>
-
-// Image 400x300 background
-extern const uint8_t bg_parkingscreen[] = {
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x78,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x0C,0x00,0xFF,0xFF,0xFF,0x80,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x0C,0x00,0xFF,0xFF,0xFF,0xE0,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xF8,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFC,0x00,0x0C,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFE,0x00,0x0C,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x0C,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x0C,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x0C,0x00,0x00,0x23,0x20,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x07,0xFF,0x80,0x0C,0x00,0x00,0x77,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x01,0xFF,0x80,0x0C,0x00,0x00,0x73,0x6E,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0xFF,0xC0,0x0C,0x00,0x00,0x30,0x05,0x8F,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0xFF,0xC0,0x0C,0x00,0x00,0x03,0x91,0xCF,0x78,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0xFF,0xC0,0x0C,0x00,0x00,0x3B,0xB0,0x4F,0x78,0x00,0x00,0x07,0xE0,0x03,0xFF,
-0xF0,0x02,0x00,0x00,0x00,0x00,0x01,0xC6,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x7F,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0xFF,0xC0,0x0C,0x00,0x03,0x3B,0xB6,0x00,0x38,0x06,0x00,0x1E,0x78,0x03,0xFF,
-0xF0,0x03,0x00,0x00,0x00,0x00,0x01,0xC6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0xFF,0xC0,0x0C,0x00,0x07,0xB8,0x07,0x80,0x00,0x06,0x00,0x30,0x0C,0x00,0x0C,
-0x00,0x07,0x80,0x00,0x00,0x00,0x01,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0xFF,0xC0,0x0C,0x00,0x07,0x80,0x00,0x8E,0x20,0x06,0x00,0x60,0x06,0x00,0x0C,
-0x00,0x07,0x80,0x00,0x00,0x00,0x01,0xC6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x07,0x80,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0xFF,0xC0,0x0C,0x00,0x07,0x0C,0xEC,0x0E,0x70,0x06,0x00,0xC0,0x03,0x00,0x0C,
-0x00,0x04,0x80,0x00,0x00,0x00,0x01,0xC6,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x01,0xFF,0x80,0x0C,0x00,0x00,0x1E,0xED,0x8E,0x77,0x06,0x00,0x80,0x01,0x00,0x0C,
-0x00,0x0C,0xC0,0x00,0x00,0x00,0x01,0xC6,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x01,0xFF,0x80,0x0C,0x00,0x01,0xCE,0x45,0x80,0x27,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x08,0x40,0x00,0x00,0x00,0x01,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x07,0xFF,0x80,0x0C,0x00,0x01,0xE4,0x00,0x18,0x07,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x18,0x60,0x00,0x00,0x00,0x01,0xF6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x0C,0x00,0x01,0xE0,0x00,0x1C,0xC0,0x06,0x01,0x00,0x01,0x80,0x0C,
-0x00,0x18,0x60,0x00,0x00,0x00,0x01,0xF6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x0C,0x00,0x38,0xC0,0xE0,0x18,0xEC,0x06,0x01,0x00,0x01,0x80,0x0C,
-0x00,0x30,0x20,0x00,0x00,0x00,0x01,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x0C,0x00,0x3C,0x02,0x40,0x60,0x1E,0x06,0x01,0x00,0x01,0x80,0x0C,
-0x00,0x30,0x30,0x00,0x00,0x00,0x01,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFE,0x00,0x0C,0x00,0x3C,0x12,0x20,0x63,0x0C,0x06,0x01,0x00,0x01,0x80,0x0C,
-0x00,0x20,0x10,0x00,0x00,0x00,0x01,0xF6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xFC,0x00,0x0C,0x00,0x3C,0x12,0x71,0xA3,0x30,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x60,0x10,0x00,0x00,0x00,0x01,0xF6,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xF8,0x00,0x0C,0x00,0x18,0x37,0x61,0x8C,0x30,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x60,0x18,0x00,0x00,0x00,0x03,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0xE0,0x00,0x0C,0x00,0x00,0x32,0x01,0xAC,0x30,0x06,0x00,0x80,0x01,0x00,0x0C,
-0x00,0xC0,0x08,0x00,0x00,0x00,0x07,0xBB,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x0C,0x00,0x00,0x31,0x38,0x30,0xC0,0x06,0x00,0xC0,0x03,0x00,0x0C,
-0x00,0xC0,0x0C,0x00,0x00,0x00,0x06,0xFD,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x33,0xB8,0x22,0xC0,0x06,0x00,0x60,0x06,0x00,0x0C,
-0x00,0x80,0x0C,0x00,0x00,0x00,0x0F,0xFE,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x07,0x80,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x13,0x02,0x0A,0x00,0x06,0x00,0x30,0x0C,0x00,0x0C,
-0x01,0x80,0x04,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x18,0x87,0x08,0x00,0x06,0x00,0x1E,0x78,0x00,0x0C,
-0x01,0x80,0x06,0x00,0x00,0x00,0x0D,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x19,0xC7,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0x00,
-0x00,0x00,0x02,0x00,0x00,0x00,0x0D,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x7F,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x19,0xC3,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x0E,0x10,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFE,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x0E,0x38,0x79,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFD,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x0E,0x38,0x73,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xBB,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x01,0xBB,0x83,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x01,0xC3,0xC3,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x01,0xC3,0xC1,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x83,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x08,0x00,0xFF,0x80,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x0C,0x00,0xFF,0x80,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0x80,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0xE0,0x00,0x00,0x00,0x00,0x01,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x01,0xFC,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x01,0xFC,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x01,0xFC,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x01,0xFC,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0xFE,0xFF,0xFD,0xFD,0xC0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x07,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x1F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x0F,0xC1,0xF0,0x7C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x3F,0xFF,0xF0,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x0F,0xC1,0xF0,0x3C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x7F,0xFF,0xF8,0x0F,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x0F,0xC1,0xF0,0x3C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0xFF,0xFF,0xFC,0x1F,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x0F,0xC1,0xF0,0x3C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x01,0xFF,0xFF,0xFE,0x1F,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFE,0x0F,0xC1,0xF0,0x7C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x03,0xFF,0xFF,0xEE,0x0F,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x03,0xFF,0xFF,0x87,0x07,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x03,0xFF,0xFF,0x07,0x00,0x1F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xFF,0xFE,0x0F,0x80,0x01,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xFF,0xFC,0x1F,0x80,0x00,0x3F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xF0,0x7C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0x8F,0xF8,0x3F,0x80,0x00,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xF0,0x3C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0x87,0xF0,0x7F,0x80,0x00,0x03,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xF0,0x3C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0x83,0xE0,0xFF,0x83,0xC0,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xF0,0x3C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xC1,0xC1,0xFF,0x87,0xFC,0x00,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xF0,0x7C,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xE0,0x83,0xFF,0x83,0xFF,0x00,0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xF0,0x07,0xFF,0x80,0x0F,0xC0,0x1F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xF8,0x0F,0xFF,0x80,0x01,0xF0,0x0F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x03,0xFC,0x1F,0xFF,0x00,0x00,0x78,0x07,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x03,0xFE,0x3F,0xFF,0x00,0x00,0x1C,0x07,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x01,0xFF,0xFF,0xFE,0x00,0x00,0x0E,0x03,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x01,0xFF,0xFF,0xFE,0x0F,0x80,0x07,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0xFF,0xFF,0xFC,0x1F,0x80,0x03,0x81,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x7F,0xFF,0xF8,0x1F,0x80,0x01,0xC0,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x3E,0x0F,0xC1,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x3F,0xFF,0xF0,0x1F,0x80,0x00,0xE0,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x1F,0xFF,0xE0,0x1F,0x80,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x06,0x07,0xFF,0x80,0x1F,0x80,0x00,0x70,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x0E,0x00,0xFC,0x00,0x1F,0x80,0x00,0x30,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x0F,0x00,0x00,0x00,0x1F,0x80,0x00,0x38,0x3F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x1F,0x80,0x00,0x00,0x1F,0x80,0x00,0x18,0x3F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x3F,0x80,0x00,0x00,0x1F,0x80,0x00,0x18,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x3F,0xC0,0x00,0x00,0x1F,0x80,0x00,0x1C,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x7F,0xE0,0x00,0x00,0x1F,0x80,0x00,0x1C,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0xFF,0xE0,0x00,0x00,0x1F,0x80,0x00,0x0C,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0xFF,0xF0,0x00,0x00,0x1F,0x80,0x00,0x0C,0x1F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x01,0xFF,0xF8,0x00,0x00,0x1F,0x80,0x00,0x0C,0x1F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x03,0xFF,0xF9,0x00,0x00,0x1F,0x80,0x00,0x0C,0x1F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x03,0xFF,0xFB,0x80,0x00,0x1F,0x80,0x00,0x0C,0x1F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x1F,0x83,0x80,0x00,0x1F,0x80,0x00,0x0C,0x1F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x1F,0x83,0x80,0x00,0x3F,0x80,0x00,0x0C,0x1F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x1F,0x81,0x80,0x00,0x3F,0x80,0x00,0x0C,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x1F,0xC1,0x80,0x00,0x7F,0x80,0x00,0x1C,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x1F,0xC1,0x80,0x01,0xFF,0x00,0x00,0x1C,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x0F,0xC1,0xC0,0x03,0xFE,0x00,0x00,0x18,0x1F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x0F,0xC0,0xC0,0x03,0xFC,0x00,0x00,0x18,0x3F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x0F,0xC0,0xC0,0x07,0xF8,0x00,0x00,0x38,0x3F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x0F,0xE0,0xE0,0x0F,0xF0,0x00,0x00,0x30,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xE0,0x60,0x1F,0xE0,0x00,0x00,0x70,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xF0,0x70,0x3F,0xC0,0x00,0x00,0x60,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x07,0xF0,0x38,0x3F,0x80,0x00,0x00,0xE0,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x03,0xF0,0x38,0x3F,0x00,0x00,0x01,0xC0,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x03,0xF8,0x1C,0x1E,0x00,0x00,0x03,0x80,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x01,0xFC,0x0E,0x00,0x00,0x00,0x07,0x81,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x01,0xFC,0x07,0x00,0x00,0x00,0x07,0x03,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0xFE,0x03,0x80,0x00,0x00,0x1E,0x03,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0xFF,0x01,0xE0,0x00,0x00,0x3C,0x07,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x7F,0x80,0xF8,0x00,0x00,0xF8,0x0F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x7F,0x80,0x3E,0x00,0x03,0xE0,0x1F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x3F,0xE0,0x1F,0xE0,0x3F,0x80,0x3F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x1F,0xF0,0x03,0xFF,0xFE,0x00,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x0F,0xF8,0x00,0x7F,0xF0,0x00,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,0x00,0x03,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x03,0xFF,0x00,0x00,0x00,0x07,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x01,0xFF,0xC0,0x00,0x00,0x1F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0xFF,0xF0,0x00,0x00,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x7F,0xFF,0x00,0x07,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF  
-};
\ No newline at end of file
+#include "PackedImage.h"
+
+// Image 400x300, 4114 bytes PackBits coded, 15000 bytes uncompressed
+// Generated with tools/pack_image.py, do not edit
+static const uint8_t bg_parkingscreen_data[] = {
+0xCF,0x00,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0xE0,0xFD,0x00,0x00,0x03,0xD8,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0x87,0xFD,0xFF,0x01,0xF8,0x7F,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0x3F,0xFC,0xFF,0x00,0x3F,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFC,0xFB,0xFF,0x00,0x9F,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFD,0xFB,0xFF,0x00,0xCF,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xF9,0xFB,0xFF,0x00,0xEF,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFB,0xFB,0xFF,0x00,0xF7,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xF3,0xFF,0xFE,0x00,0x02,0x7F,0xFF,0xF7,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xF3,0xFF,0xFE,0x00,0x02,0x1F,0xFF,0xF7,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFE,0x00,0x02,0x07,0xFF,0xF3,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFE,0x00,0x02,0x03,0xFF,0xF3,0xFD,0xFF,0x00,0xF9,0xDE,0xFF,0x00,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFE,0x00,0x02,0x01,0xFF,0xF3,0xFD,0xFF,0x00,0xE0,0xDE,0xFF,0x00,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFD,0x00,0x01,0xFF,0xF3,0xFD,0xFF,0x00,0xE0,0xDE,0xFF,0x00,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFD,0x00,0x01,0xFF,0xF3,0xFD,0xFF,0x00,0xE0,0xDE,0xFF,0x00,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFD,0x00,0x01,0x7F,0xF3,0xFF,0xFF,0x02,0xDC,0xDF,0xF1,0xDE,0xFF,0x00,0xFE,
+0x08,0x7F,0xF7,0xFF,0x00,0x7F,0xF8,0x00,0x7F,0xF3,0xFF,0xFF,0x01,0x88,0x8B,0xDD,0xFF,0x00,0xFE,
+0x08,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xF3,0xFF,0xFF,0x02,0x8C,0x91,0xF9,0xF3,0xFF,0x00,0x87,0xED,
+0xFF,0x00,0xFE,
+0x08,0x7F,0xF7,0xFF,0x00,0x7F,0xFF,0x00,0x3F,0xF3,0xFF,0xFF,0x03,0xCF,0xFA,0x70,0xCF,0xF4,0xFF,0x00,0x03,
+0xED,0xFF,0x00,0xFE,
+0x08,0x7F,0xF7,0xFF,0x00,0x7F,0xFF,0x00,0x3F,0xF3,0xFF,0xFF,0x03,0xFC,0x6E,0x30,0x87,0xF4,0xFF,0x00,0x31,
+0xED,0xFF,0x00,0xFE,
+0x08,0x7F,0xF7,0xFF,0x00,0x7F,0xFF,0x00,0x3F,0xF3,0xFF,0xFF,0x03,0xC4,0x4F,0xB0,0x87,0xFF,0xFF,0x05,0xF8,
+0x1F,0xFC,0x00,0x0F,0xFD,0xFD,0xFF,0x02,0xFE,0x39,0x03,0xF5,0xFF,0x00,0x80,0xFE,0x00,0x00,0x01,0xFF,0xFF,
+0x00,0xFE,
+0x16,0x7F,0xF7,0xFF,0x00,0x7F,0xFF,0x00,0x3F,0xF3,0xFF,0xFC,0xC4,0x49,0xFF,0xC7,0xF9,0xFF,0xE1,0x87,0xFC,
+0x00,0x0F,0xFC,0xFD,0xFF,0x02,0xFE,0x39,0x83,0xF5,0xFF,0xFC,0x00,0xFF,0xFF,0x00,0xFE,
+0x17,0x7F,0xF7,0xFF,0x00,0x7F,0xFF,0x00,0x3F,0xF3,0xFF,0xF8,0x47,0xF8,0x7F,0xFF,0xF9,0xFF,0xCF,0xF3,0xFF,
+0xF3,0xFF,0xF8,0x7F,0xFE,0xFF,0x01,0xFE,0x39,0xF4,0xFF,0xFC,0x00,0x02,0x7F,0xFF,0xFE,
+0x17,0x7F,0xF7,0xFF,0x00,0x7F,0xFF,0x00,0x3F,0xF3,0xFF,0xF8,0x7F,0xFF,0x71,0xDF,0xF9,0xFF,0x9F,0xF9,0xFF,
+0xF3,0xFF,0xF8,0x7F,0xFE,0xFF,0x02,0xFE,0x39,0x83,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xF8,0x7F,0xFF,0xFE,
+0x17,0x7F,0xF7,0xFF,0x00,0x7F,0xFF,0x00,0x3F,0xF3,0xFF,0xF8,0xF3,0x13,0xF1,0x8F,0xF9,0xFF,0x3F,0xFC,0xFF,
+0xF3,0xFF,0xFB,0x7F,0xFE,0xFF,0x02,0xFE,0x39,0x03,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x08,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xF3,0xFF,0xFF,0x0C,0xE1,0x12,0x71,0x88,0xF9,0xFF,0x7F,0xFE,
+0xFF,0xF3,0xFF,0xF3,0x3F,0xFE,0xFF,0x02,0xFE,0x39,0xC7,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x17,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xF3,0xFF,0xFE,0x31,0xBA,0x7F,0xD8,0xF9,0xFE,0x7F,0xFE,0x7F,
+0xF3,0xFF,0xF7,0xBF,0xFE,0xFF,0x01,0xFE,0x39,0xF4,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x17,0x7F,0xF7,0xFF,0x00,0x7F,0xF8,0x00,0x7F,0xF3,0xFF,0xFE,0x1B,0xFF,0xE7,0xF8,0xF9,0xFE,0x7F,0xFE,0x7F,
+0xF3,0xFF,0xE7,0x9F,0xFE,0xFF,0x02,0xFE,0x09,0x83,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFD,0x00,0x10,0x7F,0xF3,0xFF,0xFE,0x1F,0xFF,0xE3,0x3F,0xF9,0xFE,0xFF,0xFE,0x7F,0xF3,
+0xFF,0xE7,0x9F,0xFE,0xFF,0x02,0xFE,0x09,0x83,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFD,0x00,0x10,0xFF,0xF3,0xFF,0xC7,0x3F,0x1F,0xE7,0x13,0xF9,0xFE,0xFF,0xFE,0x7F,0xF3,
+0xFF,0xCF,0xDF,0xFE,0xFF,0x01,0xFE,0x09,0xF4,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFD,0x00,0x0E,0xFF,0xF3,0xFF,0xC3,0xFD,0xBF,0x9F,0xE1,0xF9,0xFE,0xFF,0xFE,0x7F,0xF3,
+0xFF,0xFF,0xCF,0xFE,0xFF,0x01,0xFE,0x09,0xF4,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFE,0x00,0x11,0x01,0xFF,0xF3,0xFF,0xC3,0xED,0xDF,0x9C,0xF3,0xF9,0xFE,0xFF,0xFE,0x7F,
+0xF3,0xFF,0xDF,0xEF,0xFE,0xFF,0x02,0xFE,0x09,0x83,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFE,0x00,0x11,0x03,0xFF,0xF3,0xFF,0xC3,0xED,0x8E,0x5C,0xCF,0xF9,0xFE,0x7F,0xFE,0x7F,
+0xF3,0xFF,0x9F,0xEF,0xFE,0xFF,0x02,0xFE,0x09,0xC3,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFE,0x00,0x11,0x07,0xFF,0xF3,0xFF,0xE7,0xC8,0x9E,0x73,0xCF,0xF9,0xFE,0x7F,0xFE,0x7F,
+0xF3,0xFF,0x9F,0xE7,0xFE,0xFF,0x01,0xFC,0x08,0xF4,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xF7,0xFF,0xFE,0x00,0x02,0x1F,0xFF,0xF3,0xFF,0xFF,0x0C,0xCD,0xFE,0x53,0xCF,0xF9,0xFF,0x7F,0xFE,
+0xFF,0xF3,0xFF,0x3F,0xF7,0xFE,0xFF,0x02,0xF8,0x44,0x7F,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x02,0x7F,0xF7,0xFF,0xFE,0x00,0xFF,0xFF,0x00,0xF3,0xFF,0xFF,0x0C,0xCE,0xC7,0xCF,0x3F,0xF9,0xFF,0x3F,0xFC,
+0xFF,0xF3,0xFF,0x3F,0xF3,0xFE,0xFF,0x02,0xF9,0x02,0x3F,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x0C,0xCC,0x47,0xDD,0x3F,0xF9,0xFF,0x9F,0xF9,
+0xFF,0xF3,0xFF,0x7F,0xF3,0xFE,0xFF,0x02,0xF0,0x01,0x3F,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x03,0xF8,0x7F,0xFF,
+0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x0C,0xEC,0xFD,0xF5,0xFF,0xF9,0xFF,0xCF,0xF3,
+0xFF,0xF3,0xFE,0x7F,0xFB,0xFE,0xFF,0x02,0xF2,0x00,0x3F,0xF5,0xFF,0xFC,0x00,0x02,0x7F,0xFF,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x0C,0xE7,0x78,0xF7,0xFF,0xF9,0xFF,0xE1,0x87,
+0xFF,0xF3,0xFE,0x7F,0xF9,0xFE,0xFF,0x02,0xF2,0x00,0x1F,0xF5,0xFF,0xFC,0x00,0xFF,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x01,0xE6,0x38,0xFD,0xFF,0x01,0xF8,0x1F,0xFD,
+0xFF,0x00,0xFD,0xFE,0xFF,0x02,0xF2,0x00,0x1F,0xF5,0xFF,0x00,0x80,0xFE,0x00,0x00,0x01,0xFF,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x02,0xE6,0x3C,0x8F,0xF4,0xFF,0x02,0xF2,0x00,
+0x3F,0xEE,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x02,0xF1,0xEF,0x87,0xF4,0xFF,0x02,0xF0,0x01,
+0x3F,0xEE,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x03,0xF1,0xC7,0x86,0x7F,0xF5,0xFF,0x02,0xF8,
+0x02,0x3F,0xEE,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x03,0xF1,0xC7,0x8C,0x3F,0xF5,0xFF,0x02,0xF8,
+0x44,0x7F,0xEE,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x03,0xFE,0x44,0x7C,0x3F,0xF5,0xFF,0x01,0xFC,
+0x00,0xED,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x00,0xFE,0xFF,0x3C,0x00,0x3F,0xF4,0xFF,0x00,
+0x01,0xED,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFF,0xFF,0x03,0xFE,0x3C,0x3E,0x3F,0xF4,0xFF,0x00,0xEF,
+0xED,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xFE,0xFF,0x01,0x7C,0x7F,0xDE,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xD9,0xFF,0x00,0xFE,
+0x04,0x7F,0xF7,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF3,0xD9,0xFF,0x00,0xFE,
+0x04,0x7F,0xF3,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF7,0xD9,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x7F,0xFE,0xFF,0x00,0xF7,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFB,0xFB,0xFF,0x00,0xE7,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xF9,0xFB,0xFF,0x00,0xEF,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFC,0xFB,0xFF,0x00,0xCF,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFE,0x7F,0xFC,0xFF,0x00,0x9F,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0x1F,0xFD,0xFF,0x01,0xFE,0x3F,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0xC0,0xFC,0x00,0xD8,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x01,0x7F,0x80,0xD2,0x00,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xE0,0xFF,0x03,0x81,0xFF,0xFE,0x03,0xF6,0xFF,0x00,0xFE,
+0x00,0x7F,0xE0,0xFF,0x03,0x01,0xFF,0xFE,0x03,0xF6,0xFF,0x00,0xFE,
+0x00,0x7F,0xE0,0xFF,0x03,0x01,0xFF,0xFE,0x03,0xF6,0xFF,0x00,0xFE,
+0x00,0x7F,0xE0,0xFF,0x03,0x01,0xFF,0xFE,0x03,0xF6,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x02,0xF1,0x01,0x00,0xFF,0x02,0x00,0x3F,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0xC0,0xFD,0x00,0x00,0x0F,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x07,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x07,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x07,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xE1,0xFF,0x00,0x80,0xFD,0x00,0x00,0x07,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFD,0xFF,0x00,0x03,0xE6,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x02,0xF8,0x00,0x7F,0xE7,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x02,0xE0,0x00,0x1F,0xE7,0xFF,0x05,0x80,0x01,0xF0,0x3E,0x0F,0x83,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x04,0xC0,0x00,0x0F,0xF0,0x07,0xE9,0xFF,0x05,0x80,0x01,0xF0,0x3E,0x0F,0xC3,0xF7,0xFF,
+0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x05,0x80,0x00,0x07,0xF0,0x00,0x7F,0xEA,0xFF,0x05,0x80,0x01,0xF0,0x3E,0x0F,0xC3,0xF7,
+0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0xFF,0x00,0x03,0x03,0xE0,0x00,0x0F,0xEA,0xFF,0x05,0x80,0x01,0xF0,0x3E,0x0F,0xC3,0xF7,
+0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xFE,0xFF,0x00,0x03,0x01,0xE0,0x00,0x03,0xEA,0xFF,0x05,0x80,0x01,0xF0,0x3E,0x0F,
+0x83,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xFC,0xFF,0x00,0x01,0x11,0xF0,0xFF,0x00,0xEA,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,
+0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xFC,0xFF,0x00,0x01,0x78,0xF8,0xFF,0x00,0x00,0x7F,0xEB,0xFF,0x00,0x80,0xFD,0x00,
+0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xFC,0xFF,0x00,0x04,0xF8,0xFF,0xE0,0x00,0x1F,0xEB,0xFF,0x00,0x80,0xFD,0x00,0x00,
+0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x07,0xF8,0x00,0x01,0xF0,0x7F,0xFE,0x00,0x0F,0xEB,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,
+0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x07,0xF8,0x00,0x03,0xE0,0x7F,0xFF,0xC0,0x07,0xEB,0xFF,0x05,0x87,0xC1,0xF0,0x3E,0x0F,
+0x83,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x07,0xF8,0x70,0x07,0xC0,0x7F,0xFF,0xF0,0x03,0xEB,0xFF,0x05,0x87,0xC1,0xF0,0x3E,0x0F,
+0xC3,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x07,0xF8,0x78,0x0F,0x80,0x7F,0xFF,0xFC,0x01,0xEB,0xFF,0x05,0x87,0xC1,0xF0,0x3E,0x0F,
+0xC3,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x07,0xF8,0x7C,0x1F,0x00,0x7C,0x3F,0xFE,0x00,0xEB,0xFF,0x05,0x87,0xC1,0xF0,0x3E,0x0F,
+0xC3,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xF8,0xFF,0x3E,0x05,0x00,0x78,0x03,0xFF,0x00,0x7F,0xEC,0xFF,0x05,0x87,0xC1,0xF0,
+0x3E,0x0F,0x83,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x08,0xF8,0x1F,0x7C,0x00,0x7C,0x00,0xFF,0xC0,0x3F,0xEC,0xFF,0x00,0x80,0xFD,0x00,0x00,
+0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x08,0xF8,0x0F,0xF8,0x00,0x7F,0xF0,0x3F,0xE0,0x1F,0xEC,0xFF,0x00,0x80,0xFD,0x00,0x00,
+0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x08,0xF8,0x07,0xF0,0x00,0x7F,0xFE,0x0F,0xF0,0x0F,0xEC,0xFF,0x00,0x80,0xFD,0x00,0x00,
+0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x03,0xFC,0x03,0xE0,0x00,0xFF,0xFF,0x02,0x87,0xF8,0x0F,0xEC,0xFF,0x00,0x80,0xFD,0x00,
+0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x03,0xFC,0x01,0xC0,0x00,0xFF,0xFF,0x02,0xE3,0xF8,0x07,0xEC,0xFF,0x05,0x87,0xC1,0xF0,
+0x3E,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xFE,0xFF,0x00,0x00,0x01,0xFF,0xFF,0x02,0xF1,0xFC,0x07,0xEC,0xFF,0x05,0x87,0xC1,
+0xF0,0x3E,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xFE,0xFF,0x00,0x05,0x01,0xF0,0x7F,0xF8,0xFE,0x03,0xEC,0xFF,0x05,0x87,0xC1,0xF0,
+0x3E,0x00,0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0xFF,0x00,0x05,0x03,0xE0,0x7F,0xFC,0x7E,0x03,0xEC,0xFF,0x05,0x87,0xC1,0xF0,0x3E,0x00,
+0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x07,0x80,0x00,0x07,0xE0,0x7F,0xFE,0x3F,0x01,0xEC,0xFF,0x05,0x87,0xC1,0xF0,0x3E,0x00,
+0x03,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x07,0xC0,0x00,0x0F,0xE0,0x7F,0xFF,0x1F,0x01,0xEC,0xFF,0x00,0x80,0xFD,0x00,0x00,0x03,
+0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x07,0xE0,0x00,0x1F,0xE0,0x7F,0xFF,0x1F,0x80,0xEC,0xFF,0x00,0x80,0xFD,0x00,0x00,0x07,
+0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x08,0xF9,0xF8,0x00,0x7F,0xE0,0x7F,0xFF,0x8F,0x80,0xEC,0xFF,0x00,0x80,0xFD,0x00,0x00,
+0x07,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x08,0xF1,0xFF,0x03,0xFF,0xE0,0x7F,0xFF,0xCF,0xC0,0xEC,0xFF,0x00,0xC0,0xFD,0x00,0x00,
+0x0F,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xF0,0xFE,0xFF,0x05,0xE0,0x7F,0xFF,0xC7,0xC0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x01,0xE0,0x7F,0xFF,0xFF,0x05,0xE0,0x7F,0xFF,0xE7,0xC0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x01,0xC0,0x7F,0xFF,0xFF,0x05,0xE0,0x7F,0xFF,0xE7,0xE0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x01,0xC0,0x3F,0xFF,0xFF,0x05,0xE0,0x7F,0xFF,0xE3,0xE0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x01,0x80,0x1F,0xFF,0xFF,0x05,0xE0,0x7F,0xFF,0xE3,0xE0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x01,0x00,0x1F,0xFF,0xFF,0x05,0xE0,0x7F,0xFF,0xF3,0xE0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x01,0x00,0x0F,0xFF,0xFF,0x05,0xE0,0x7F,0xFF,0xF3,0xE0,0x3F,0xDD,0xFF,0x00,0xFE,
+0x04,0x7F,0xFF,0xFE,0x00,0x07,0xFF,0xFF,0x05,0xE0,0x7F,0xFF,0xF3,0xE0,0x3F,0xDD,0xFF,0x00,0xFE,
+0x04,0x7F,0xFF,0xFC,0x00,0x06,0xFF,0xFF,0x05,0xE0,0x7F,0xFF,0xF3,0xE0,0x3F,0xDD,0xFF,0x00,0xFE,
+0x0C,0x7F,0xFF,0xFC,0x00,0x04,0x7F,0xFF,0xE0,0x7F,0xFF,0xF3,0xE0,0x3F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x09,0xE0,0x7C,0x7F,0xFF,0xE0,0x7F,0xFF,0xF3,0xE0,0x3F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x09,0xE0,0x7C,0x7F,0xFF,0xC0,0x7F,0xFF,0xF3,0xE0,0x3F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x09,0xE0,0x7E,0x7F,0xFF,0xC0,0x7F,0xFF,0xF3,0xE0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x09,0xE0,0x3E,0x7F,0xFF,0x80,0x7F,0xFF,0xE3,0xE0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x04,0xE0,0x3E,0x7F,0xFE,0x00,0xFF,0xFF,0x02,0xE3,0xE0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x04,0xF0,0x3E,0x3F,0xFC,0x01,0xFF,0xFF,0x02,0xE7,0xE0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xF0,0xFF,0x3F,0x01,0xFC,0x03,0xFF,0xFF,0x02,0xE7,0xC0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xF0,0xFF,0x3F,0x01,0xF8,0x07,0xFF,0xFF,0x02,0xC7,0xC0,0x7F,0xDD,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x00,0xF0,0xFF,0x1F,0x01,0xF0,0x0F,0xFF,0xFF,0x01,0xCF,0xC0,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x04,0xF8,0x1F,0x9F,0xE0,0x1F,0xFF,0xFF,0x01,0x8F,0x80,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x04,0xF8,0x0F,0x8F,0xC0,0x3F,0xFF,0xFF,0x01,0x9F,0x80,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x04,0xF8,0x0F,0xC7,0xC0,0x7F,0xFF,0xFF,0x01,0x1F,0x81,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x03,0xFC,0x0F,0xC7,0xC0,0xFF,0xFF,0x02,0xFE,0x3F,0x01,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x03,0xFC,0x07,0xE3,0xE1,0xFF,0xFF,0x02,0xFC,0x7F,0x01,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x02,0xFE,0x03,0xF1,0xFE,0xFF,0x02,0xF8,0x7E,0x03,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFF,0xFF,0x02,0xFE,0x03,0xF8,0xFE,0xFF,0x02,0xF8,0xFC,0x03,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x02,0x01,0xFC,0x7F,0xFF,0xFF,0x02,0xE1,0xFC,0x07,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x02,0x00,0xFE,0x1F,0xFF,0xFF,0x02,0xC3,0xF8,0x07,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x02,0x80,0x7F,0x07,0xFF,0xFF,0x02,0x07,0xF0,0x0F,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x07,0x80,0x7F,0xC1,0xFF,0xFC,0x1F,0xE0,0x1F,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x07,0xC0,0x1F,0xE0,0x1F,0xC0,0x7F,0xC0,0x3F,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x07,0xE0,0x0F,0xFC,0x00,0x01,0xFF,0x80,0x3F,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x07,0xF0,0x07,0xFF,0x80,0x0F,0xFF,0x00,0x7F,0xDC,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,0xFC,0x00,0xDB,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x01,0xFC,0x00,0xFE,0xFF,0x01,0xF8,0x01,0xDB,0xFF,0x00,0xFE,
+0x00,0x7F,0xFE,0xFF,0x02,0xFE,0x00,0x3F,0xFF,0xFF,0x01,0xE0,0x03,0xDB,0xFF,0x00,0xFE,
+0x00,0x7F,0xFD,0xFF,0x01,0x00,0x0F,0xFF,0xFF,0x01,0x00,0x07,0xDB,0xFF,0x00,0xFE,
+0x00,0x7F,0xFD,0xFF,0x05,0x80,0x00,0xFF,0xF8,0x00,0x0F,0xDB,0xFF,0x00,0xFE,
+0x00,0x7F,0xFD,0xFF,0x00,0xE0,0xFD,0x00,0x00,0x3F,0xDB,0xFF,0x00,0xFE,
+0x00,0x7F,0xFD,0xFF,0x00,0xF0,0xFD,0x00,0x00,0x7F,0xDB,0xFF,0x00,0xFE,
+0x00,0x7F,0xFD,0xFF,0x00,0xFC,0xFE,0x00,0x00,0x01,0xDA,0xFF,0x00,0xFE,
+0x00,0x7F,0xFC,0xFF,0xFE,0x00,0x00,0x07,0xDA,0xFF,0x00,0xFE,
+0x00,0x7F,0xFC,0xFF,0x00,0xC0,0xFF,0x00,0x00,0x3F,0xDA,0xFF,0x00,0xFE,
+0x00,0x7F,0xFC,0xFF,0x02,0xFC,0x00,0x01,0xD9,0xFF,0x00,0xFE,
+0x00,0x7F,0xFB,0xFF,0x00,0xF0,0xD8,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0xCF,0x00,
+};
+
+static const uint16_t bg_parkingscreen_rows[] = {
+0,2,8,14,20,26,32,38,50,63,75,86,
+97,108,119,133,147,161,179,197,214,231,250,269,
+293,318,343,387,425,463,505,547,590,631,673,714,
+754,794,836,878,919,962,1005,1048,1088,1128,1170,1196,
+1222,1249,1276,1302,1328,1353,1372,1386,1400,1414,1428,1439,
+1450,1461,1473,1486,1496,1502,1508,1514,1520,1526,1532,1539,
+1545,1551,1557,1563,1569,1575,1581,1587,1593,1599,1612,1625,
+1638,1651,1667,1681,1695,1709,1723,1737,1751,1765,1779,1793,
+1807,1825,1845,1866,1889,1913,1937,1963,1988,2015,2041,2066,
+2092,2118,2144,2170,2198,2224,2250,2276,2303,2331,2360,2388,
+2414,2440,2465,2490,2516,2542,2561,2581,2601,2621,2641,2661,
+2681,2700,2719,2737,2756,2775,2794,2813,2833,2853,2874,2895,
+2915,2934,2953,2972,2991,3010,3028,3046,3064,3082,3100,3117,
+3134,3151,3168,3184,3200,3217,3233,3248,3262,3276,3290,3302,
+3316,3328,3338,3344,3350,3356,3362,3368,3374,3380,3386,3392,
+3398,3404,3410,3416,3422,3428,3434,3440,3446,3452,3458,3464,
+3470,3476,3482,3488,3494,3500,3506,3512,3518,3524,3530,3536,
+3542,3548,3554,3560,3566,3572,3578,3584,3590,3596,3602,3608,
+3614,3620,3626,3632,3638,3644,3650,3656,3662,3668,3674,3680,
+3686,3692,3698,3704,3710,3716,3722,3728,3734,3740,3746,3752,
+3758,3764,3770,3776,3782,3788,3794,3800,3806,3812,3818,3824,
+3830,3836,3842,3848,3854,3860,3866,3872,3878,3884,3890,3896,
+3902,3908,3914,3920,3926,3932,3938,3944,3950,3956,3962,3968,
+3974,3980,3986,3992,3998,4004,4010,4016,4022,4028,4034,4040,
+4046,4052,4058,4064,4070,4076,4082,4088,4094,4100,4106,4112,
+};
+
+extern const PackedImage bg_parkingscreen = {
+    400, 300, bg_parkingscreen_rows, bg_parkingscreen_data
+};
@@ -1,905 +1,418 @@
-#include <stdint.h>
-
-// Image 400x300 background
-extern const uint8_t bg_welcomescreen[] = {
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x60,0x00,0x00,0x00,0x00,0x01,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0x7F,0xFF,0xFE,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xE0,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xF8,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFC,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFE,0x00,0x04,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x04,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x04,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x04,0x00,0x00,0x02,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x0F,0xFF,0x80,0x04,0x00,0x00,0x77,0x70,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x01,0xFF,0xC0,0x04,0x00,0x00,0x77,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0xFF,0xC0,0x04,0x00,0x00,0x70,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0xFF,0xC0,0x04,0x00,0x00,0x00,0x01,0x8F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x7F,0xC0,0x04,0x00,0x00,0x33,0xB0,0xCF,0x78,0x00,0x00,0x01,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xC6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x7F,0xC0,0x04,0x00,0x00,0x7B,0xB6,0x06,0x78,0x06,0x00,0x0F,0xF0,0x03,0xFF,
-0xF0,0x03,0x00,0x00,0x00,0x00,0x01,0xC6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x7F,0xC0,0x04,0x00,0x07,0x39,0x06,0x80,0x30,0x06,0x00,0x38,0x1C,0x00,0x0C,
-0x00,0x03,0x80,0x00,0x00,0x00,0x01,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x7F,0xC0,0x04,0x00,0x07,0x90,0x01,0x8E,0x00,0x06,0x00,0x60,0x06,0x00,0x0C,
-0x00,0x07,0x80,0x00,0x00,0x00,0x01,0xC6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x07,0x80,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0xFF,0xC0,0x04,0x00,0x07,0x80,0xC0,0x0E,0x70,0x06,0x00,0xC0,0x03,0x00,0x0C,
-0x00,0x06,0x80,0x00,0x00,0x00,0x01,0xC6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0xFF,0xC0,0x04,0x00,0x03,0x0E,0xEC,0x0E,0x72,0x06,0x00,0xC0,0x03,0x00,0x0C,
-0x00,0x0C,0xC0,0x00,0x00,0x00,0x01,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0xFF,0xC0,0x04,0x00,0x00,0x9E,0xED,0x84,0x77,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x0C,0x40,0x00,0x00,0x00,0x01,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x03,0xFF,0xC0,0x04,0x00,0x01,0xCC,0x01,0x98,0x07,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x08,0x60,0x00,0x00,0x00,0x01,0xF6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x0F,0xFF,0x80,0x04,0x00,0x03,0xE0,0x00,0x1C,0xC7,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x18,0x60,0x00,0x00,0x00,0x01,0xF6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x04,0x00,0x19,0xC0,0x40,0x19,0xE0,0x06,0x01,0x00,0x00,0x80,0x0C,
-0x00,0x18,0x20,0x00,0x00,0x00,0x01,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x04,0x00,0x3C,0x00,0xE0,0x00,0xDC,0x06,0x01,0x00,0x00,0x80,0x0C,
-0x00,0x10,0x30,0x00,0x00,0x00,0x01,0xF6,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x04,0x00,0x7C,0x16,0x00,0x63,0x0C,0x06,0x01,0x00,0x00,0x80,0x0C,
-0x00,0x30,0x10,0x00,0x00,0x00,0x01,0xF6,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFE,0x00,0x04,0x00,0x3C,0x12,0x60,0x63,0x00,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x20,0x18,0x00,0x00,0x00,0x01,0xF6,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xFC,0x00,0x04,0x00,0x38,0x12,0x71,0x83,0x30,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x60,0x18,0x00,0x00,0x00,0x03,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xF8,0x00,0x04,0x00,0x00,0x37,0x21,0x8C,0x30,0x06,0x01,0x80,0x01,0x80,0x0C,
-0x00,0x60,0x08,0x00,0x00,0x00,0x07,0x7B,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xFF,0xC0,0x00,0x04,0x00,0x00,0x00,0x18,0x3C,0xC0,0x06,0x00,0xC0,0x03,0x00,0x0C,
-0x00,0xC0,0x0C,0x00,0x00,0x00,0x0E,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x03,0xE0,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xFF,0xF8,0x00,0x00,0x04,0x00,0x00,0x33,0x38,0x20,0xC0,0x06,0x00,0xC0,0x03,0x00,0x0C,
-0x00,0xC0,0x04,0x00,0x00,0x00,0x0F,0xFE,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xE0,0x00,0x00,0x00,0x07,0x80,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x33,0x18,0x0F,0x00,0x06,0x00,0x60,0x06,0x00,0x0C,
-0x00,0x80,0x06,0x00,0x00,0x00,0x0F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x01,0x07,0x0A,0x00,0x06,0x00,0x38,0x1C,0x00,0x0C,
-0x01,0x80,0x06,0x00,0x00,0x00,0x0F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x18,0xC7,0x00,0x00,0x06,0x00,0x0F,0xF0,0x00,0x0C,
-0x01,0x80,0x02,0x00,0x00,0x00,0x0F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x7F,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x19,0xC7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0xC0,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x0E,0x38,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFD,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x0E,0x38,0x7B,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xB3,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x38,0x33,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x01,0xC3,0x83,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x01,0xC3,0xC3,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x01,0xC3,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x04,0x00,0xFF,0xC0,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x38,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xF8,0x00,0x00,0x06,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0xC0,
-0x00,0x00,0x01,0x80,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,0x06,0x00,0x02,0x30,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0xC0,
-0x00,0x00,0x01,0x80,0x06,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x06,0x00,0x00,0x06,0x00,0x07,0x30,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x00,
-0x00,0x00,0x01,0x80,0x06,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x06,0x04,0x01,0x06,0x00,0x07,0x30,0x00,0x80,0x00,0x40,0x10,0x01,0x80,0x00,
-0x80,0x40,0x01,0x81,0x06,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x06,0x1F,0x8F,0xC6,0x30,0x0F,0xBF,0xC3,0xE0,0x07,0xF0,0xFC,0xFD,0x9C,0xDF,
-0xE1,0xFC,0x01,0x8F,0xCF,0x80,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xFE,0x39,0xCC,0x66,0x60,0x07,0x3C,0xC6,0x30,0x07,0x39,0x8E,0xF9,0xB8,0xDE,
-0x63,0x9C,0x01,0x9C,0xE6,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x70,0xD8,0x36,0xC0,0x07,0x38,0xCC,0x18,0x06,0x19,0x86,0xE1,0xF0,0xDC,
-0x37,0x1C,0x01,0x98,0x66,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x3E,0x60,0xD8,0x37,0xC0,0x07,0x30,0xCF,0xF8,0x06,0x18,0x0E,0xE1,0xE0,0xDC,
-0x36,0x0C,0x01,0x98,0x36,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x60,0xF8,0x37,0xC0,0x07,0x30,0xCF,0xF8,0x06,0x18,0xFE,0xC1,0xF0,0xDC,
-0x36,0x0C,0x01,0xB8,0x36,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x03,0x60,0xF8,0x36,0xE0,0x07,0x30,0xCC,0x00,0x06,0x19,0xC6,0xC1,0xB0,0xDC,
-0x36,0x0C,0x01,0x98,0x36,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x70,0xD8,0x36,0x60,0x07,0x30,0xCC,0x18,0x06,0x1B,0x86,0xC1,0x98,0xDC,
-0x36,0x0C,0x01,0x98,0x76,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x0E,0x31,0xDC,0x76,0x30,0x07,0x30,0xCE,0x38,0x07,0x3B,0x8E,0xC1,0x9C,0xDC,
-0x33,0x1C,0x01,0x9C,0x66,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xFE,0x3F,0x8F,0xE6,0x38,0x03,0xB0,0xC7,0xF0,0x07,0xF1,0xFE,0xC1,0x8C,0xDC,
-0x33,0xFC,0x01,0x8F,0xE7,0x80,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xF8,0x0F,0x07,0x86,0x18,0x01,0x90,0x41,0xE0,0x06,0xE0,0xF2,0x41,0x04,0x88,
-0x20,0xCC,0x01,0x87,0x83,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
-0x02,0x1C,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
-0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
-0x03,0xF8,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x0C,0x30,0xF7,0xDB,0xC0,0x18,0x33,0xC2,0x0C,0xB8,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x06,0x31,0xB3,0xDF,0xE0,0x18,0x77,0xF3,0x0C,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x06,0x79,0xB1,0x9C,0x60,0x0C,0x6C,0x33,0x0C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x06,0x79,0xB1,0x9C,0x70,0x0C,0x6C,0x3B,0x0C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x06,0x79,0xB1,0x98,0x30,0x0C,0xCC,0x1B,0x0C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0x4B,0x31,0x98,0x30,0x06,0xCC,0x1B,0x0C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xCF,0x31,0x98,0x30,0x06,0xCC,0x1B,0x0C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xCF,0x31,0x98,0x30,0x07,0x8C,0x3B,0x1C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x01,0xCE,0x31,0xD8,0x30,0x03,0x8F,0x73,0xBC,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x01,0x86,0x31,0xD8,0x30,0x03,0x87,0xE1,0xFC,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x0F,0xF0,0xC0,0x00,0x00,0x00,0xF1,0xFF,
-0xC0,0x00,0x00,0x00,0x60,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0xC0,0x01,0x80,0x01,0xFD,0xFF,
-0xC0,0x00,0x00,0x00,0x60,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0xC0,0x01,0x80,0x03,0x0C,0x0C,
-0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x01,0x80,0xC0,0x10,0x18,0x02,0x0C,0x0C,0xC0,0x83,0x81,0x83,0x0C,0x0C,
-0x02,0x00,0x80,0x60,0x60,0x40,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xC7,0xC3,0xF1,0xFC,0x7E,0x1F,0x8C,0x0E,0xC7,0xF7,0xC7,0xE0,0x0C,0x0C,
-0x1F,0xCF,0xE1,0xFE,0x63,0xF0,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xCC,0x67,0x39,0xCE,0xE7,0x18,0xCC,0x0C,0xCE,0x33,0x8E,0x70,0x0C,0x0C,
-0x38,0xCE,0x71,0x9E,0x67,0x38,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xD8,0x66,0x19,0x86,0xE3,0x30,0x6F,0xFC,0xCC,0x31,0x8C,0x30,0x18,0x0C,
-0x30,0xCC,0x33,0x0E,0x66,0x1C,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xD8,0x07,0xFD,0x86,0x78,0x3F,0xEF,0xF8,0xC0,0x71,0x8F,0xF0,0x38,0x0C,
-0x01,0xCC,0x33,0x06,0x67,0xFC,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xD8,0x07,0xFD,0x86,0x3E,0x3F,0xEC,0x00,0xC7,0xF1,0x9F,0xF8,0x70,0x0C,
-0x1F,0xCC,0x33,0x06,0x67,0xFC,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xD8,0x06,0x01,0x86,0x0F,0x30,0x0C,0x00,0xCE,0x31,0x9C,0x01,0xC0,0x0C,
-0x3C,0xCC,0x33,0x06,0x66,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xD8,0x36,0x09,0x86,0xC3,0x30,0x4C,0x00,0xCC,0x31,0x8C,0x31,0x80,0x0C,
-0x30,0xCC,0x33,0x0E,0x66,0x08,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xCC,0x67,0x19,0x86,0xE3,0x38,0xEC,0x00,0xCC,0x71,0x8C,0x33,0x80,0x0C,
-0x31,0xCC,0x31,0x9E,0x67,0x18,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0xCF,0xE3,0xF9,0x86,0x7F,0x1F,0xCC,0x00,0xCF,0xF9,0xC7,0xE3,0xFC,0x0C,
-0x3F,0xEC,0x30,0xFE,0x63,0xF8,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xFC,0x83,0x81,0xE1,0x04,0x3C,0x07,0x0C,0x00,0x47,0x90,0xC3,0xC3,0xFC,0x08,
-0x1E,0x48,0x30,0x26,0x41,0xE0,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x03,0x0E,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x01,0x9C,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x03,0x00,0xC0,0x03,0x80,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x30,0x00,0x03,0x00,0xC0,0x07,0x80,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x30,0x00,0x00,0x00,0xC0,0x07,0x80,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xD8,0x2F,0x87,0xF3,0xE3,0xE3,0x1F,0xC0,0x0E,0xC3,0x78,0x5E,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x01,0x9C,0x3F,0x8F,0xF3,0xE7,0xF3,0x3F,0xC0,0x0C,0xC3,0xFC,0xFF,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x01,0x8C,0x30,0xCC,0x73,0x8C,0x33,0x31,0xC0,0x0C,0xE3,0x8E,0xE1,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x01,0x8C,0x30,0xDC,0x33,0x0C,0x1B,0x60,0xC0,0x18,0x63,0x86,0xE1,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xFE,0x30,0xD8,0x33,0x0C,0x1B,0x60,0xC0,0x1F,0xE3,0x06,0xC1,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xFE,0x30,0xD8,0x33,0x0C,0x1B,0x60,0xC0,0x3F,0xF3,0x06,0xC1,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x30,0xDC,0x33,0x0C,0x1B,0x60,0xC0,0x30,0x33,0x06,0xE1,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x06,0x03,0x30,0xCC,0x33,0x0C,0x3B,0x31,0xC0,0x30,0x3B,0x8E,0xE3,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x06,0x03,0x30,0xCE,0xF3,0x07,0x73,0x3B,0xC0,0x70,0x1B,0xDC,0xF7,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x0E,0x03,0xB0,0xC7,0xF3,0x03,0xE3,0x1F,0xC0,0x60,0x1B,0xF8,0xFE,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0xE0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0xE0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0xE0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x40,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, 
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF  
-};
\ No newline at end of file
+#include "PackedImage.h"
+
+// Image 400x300, 4033 bytes PackBits coded, 15000 bytes uncompressed
+// Generated with tools/pack_image.py, do not edit
+static const uint8_t bg_welcomescreen_data[] = {
+0xCF,0x00,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0xC0,0xFC,0x00,0xD8,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0x9F,0xFD,0xFF,0x01,0xFE,0x3F,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0x3F,0xFC,0xFF,0x00,0x9F,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFE,0x7F,0xFC,0xFF,0x00,0xCF,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFC,0xFB,0xFF,0x00,0xE7,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFD,0xFB,0xFF,0x00,0xF7,0xD9,0xFF,0x00,0xFE,
+0x05,0x7F,0xFB,0xFF,0x80,0x00,0x01,0xFF,0xFF,0x00,0xF7,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFE,0x00,0x02,0x1F,0xFF,0xF3,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFE,0x00,0x02,0x07,0xFF,0xFB,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFE,0x00,0x02,0x03,0xFF,0xFB,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFE,0x00,0x02,0x01,0xFF,0xFB,0xFD,0xFF,0x00,0xF1,0xDE,0xFF,0x00,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFD,0x00,0x01,0xFF,0xFB,0xFD,0xFF,0x00,0xE0,0xDE,0xFF,0x00,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFD,0x00,0x01,0x7F,0xFB,0xFD,0xFF,0x00,0xE0,0xDE,0xFF,0x00,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFD,0x00,0x01,0x7F,0xFB,0xFF,0xFF,0x02,0xFD,0xFF,0xF0,0xDE,0xFF,0x00,0xFE,
+0x08,0x7F,0xFB,0xFF,0x00,0x3F,0xF0,0x00,0x7F,0xFB,0xFF,0xFF,0x02,0x88,0x8F,0xFB,0xDE,0xFF,0x00,0xFE,
+0x08,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0x00,0x3F,0xFB,0xFF,0xFF,0x01,0x88,0x83,0xF2,0xFF,0x00,0x87,0xED,0xFF,
+0x00,0xFE,
+0x08,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x00,0x3F,0xFB,0xFF,0xFF,0x02,0x8F,0xF0,0xF8,0xF3,0xFF,0x00,0x03,0xED,
+0xFF,0x00,0xFE,
+0x08,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x00,0x3F,0xFB,0xFE,0xFF,0x02,0xFE,0x70,0x87,0xF4,0xFF,0x00,0x31,0xED,
+0xFF,0x00,0xFE,
+0x08,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x80,0x3F,0xFB,0xFF,0xFF,0x03,0xCC,0x4F,0x30,0x87,0xFF,0xFF,0x01,0xFE,
+0x7F,0xF9,0xFF,0x02,0xFE,0x39,0x83,0xF5,0xFF,0xFD,0x00,0x00,0x01,0xFF,0xFF,0x00,0xFE,
+0x08,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x80,0x3F,0xFB,0xFF,0xFF,0x0B,0x84,0x49,0xF9,0x87,0xF9,0xFF,0xF0,0x0F,
+0xFC,0x00,0x0F,0xFC,0xFD,0xFF,0x02,0xFE,0x39,0x83,0xF6,0xFF,0x00,0xFE,0xFC,0x00,0xFF,0xFF,0x00,0xFE,
+0x17,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x80,0x3F,0xFB,0xFF,0xF8,0xC6,0xF9,0x7F,0xCF,0xF9,0xFF,0xC7,0xE3,0xFF,
+0xF3,0xFF,0xFC,0x7F,0xFE,0xFF,0x01,0xFE,0x39,0xF5,0xFF,0x00,0xFE,0xFC,0x00,0x02,0x7F,0xFF,0xFE,
+0x17,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x80,0x3F,0xFB,0xFF,0xF8,0x6F,0xFE,0x71,0xFF,0xF9,0xFF,0x9F,0xF9,0xFF,
+0xF3,0xFF,0xF8,0x7F,0xFE,0xFF,0x02,0xFE,0x39,0x83,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xF8,0x7F,0xFF,
+0xFE,
+0x17,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x00,0x3F,0xFB,0xFF,0xF8,0x7F,0x3F,0xF1,0x8F,0xF9,0xFF,0x3F,0xFC,0xFF,
+0xF3,0xFF,0xF9,0x7F,0xFE,0xFF,0x02,0xFE,0x39,0x83,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x17,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x00,0x3F,0xFB,0xFF,0xFC,0xF1,0x13,0xF1,0x8D,0xF9,0xFF,0x3F,0xFC,0xFF,
+0xF3,0xFF,0xF3,0x3F,0xFE,0xFF,0x01,0xFE,0x39,0xF5,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x08,0x7F,0xFB,0xFF,0x00,0x3F,0xFF,0x00,0x3F,0xFB,0xFF,0xFF,0x0C,0x61,0x12,0x7B,0x88,0xF9,0xFE,0x7F,0xFE,
+0x7F,0xF3,0xFF,0xF3,0xBF,0xFE,0xFF,0x01,0xFE,0x39,0xF5,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x17,0x7F,0xFB,0xFF,0x00,0x3F,0xFC,0x00,0x3F,0xFB,0xFF,0xFE,0x33,0xFE,0x67,0xF8,0xF9,0xFE,0x7F,0xFE,0x7F,
+0xF3,0xFF,0xF7,0x9F,0xFE,0xFF,0x02,0xFE,0x09,0x83,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x17,0x7F,0xFB,0xFF,0x00,0x3F,0xF0,0x00,0x7F,0xFB,0xFF,0xFC,0x1F,0xFF,0xE3,0x38,0xF9,0xFE,0x7F,0xFE,0x7F,
+0xF3,0xFF,0xE7,0x9F,0xFE,0xFF,0x02,0xFE,0x09,0x83,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x02,0x7F,0xFB,0xFF,0xFD,0x00,0x09,0x7F,0xFB,0xFF,0xE6,0x3F,0xBF,0xE6,0x1F,0xF9,0xFE,0xFF,0xFF,0x04,0x7F,
+0xF3,0xFF,0xE7,0xDF,0xFE,0xFF,0x01,0xFE,0x09,0xF5,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFD,0x00,0x09,0x7F,0xFB,0xFF,0xC3,0xFF,0x1F,0xFF,0x23,0xF9,0xFE,0xFF,0xFF,0x04,0x7F,
+0xF3,0xFF,0xEF,0xCF,0xFE,0xFF,0x02,0xFE,0x09,0xE7,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x02,0x7F,0xFB,0xFF,0xFD,0x00,0x09,0xFF,0xFB,0xFF,0x83,0xE9,0xFF,0x9C,0xF3,0xF9,0xFE,0xFF,0xFF,0x04,0x7F,
+0xF3,0xFF,0xCF,0xEF,0xFE,0xFF,0x02,0xFE,0x09,0x83,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x02,0x7F,0xFB,0xFF,0xFE,0x00,0x11,0x01,0xFF,0xFB,0xFF,0xC3,0xED,0x9F,0x9C,0xFF,0xF9,0xFE,0x7F,0xFE,0x7F,
+0xF3,0xFF,0xDF,0xE7,0xFE,0xFF,0x02,0xFE,0x09,0xC3,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x02,0x7F,0xFB,0xFF,0xFE,0x00,0x11,0x03,0xFF,0xFB,0xFF,0xC7,0xED,0x8E,0x7C,0xCF,0xF9,0xFE,0x7F,0xFE,0x7F,
+0xF3,0xFF,0x9F,0xE7,0xFE,0xFF,0x01,0xFC,0x48,0xF5,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFE,0x00,0x02,0x07,0xFF,0xFB,0xFF,0xFF,0x0C,0xC8,0xDE,0x73,0xCF,0xF9,0xFE,0x7F,0xFE,
+0x7F,0xF3,0xFF,0x9F,0xF7,0xFE,0xFF,0x02,0xF8,0x84,0x7F,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,
+0xFF,0xFE,
+0x02,0x7F,0xFB,0xFF,0xFE,0x00,0x02,0x3F,0xFF,0xFB,0xFE,0xFF,0x0B,0xE7,0xC3,0x3F,0xF9,0xFF,0x3F,0xFC,0xFF,
+0xF3,0xFF,0x3F,0xF3,0xFE,0xFF,0x02,0xF1,0x00,0x3F,0xF6,0xFF,0x01,0xFE,0x3F,0xFE,0xFF,0x03,0xFC,0x1F,0xFF,
+0xFE,
+0x02,0x7F,0xFB,0xFF,0xFF,0x00,0x00,0x07,0xFF,0xFF,0x00,0xFB,0xFF,0xFF,0x0C,0xCC,0xC7,0xDF,0x3F,0xF9,0xFF,
+0x3F,0xFC,0xFF,0xF3,0xFF,0x3F,0xFB,0xFE,0xFF,0x02,0xF0,0x01,0x3F,0xF6,0xFF,0x01,0xFE,0x1F,0xFE,0xFF,0x03,
+0xF8,0x7F,0xFF,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x0C,0xCC,0xE7,0xF0,0xFF,0xF9,0xFF,0x9F,0xF9,
+0xFF,0xF3,0xFF,0x7F,0xF9,0xFE,0xFF,0x02,0xF0,0x00,0x1F,0xF6,0xFF,0x00,0xFE,0xFC,0x00,0x02,0x7F,0xFF,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x0C,0xFE,0xF8,0xF5,0xFF,0xF9,0xFF,0xC7,0xE3,
+0xFF,0xF3,0xFE,0x7F,0xF9,0xFE,0xFF,0x02,0xF0,0x00,0x1F,0xF5,0xFF,0xFC,0x00,0xFF,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x01,0xE7,0x38,0xFF,0xFF,0x08,0xF9,0xFF,0xF0,
+0x0F,0xFF,0xF3,0xFE,0x7F,0xFD,0xFE,0xFF,0x02,0xF0,0x00,0x1F,0xF5,0xFF,0x00,0x80,0xFE,0x00,0x00,0x01,0xFF,
+0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x01,0xE6,0x38,0xF3,0xFF,0x02,0xF2,0x00,0x3F,
+0xEE,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFE,0xFF,0x01,0x3F,0x8F,0xF4,0xFF,0x02,0xF0,0x00,0x3F,
+0xEE,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x02,0xF1,0xC7,0x87,0xF4,0xFF,0x02,0xF8,0x02,
+0x3F,0xEE,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x03,0xF1,0xC7,0x84,0x3F,0xF5,0xFF,0x02,0xF8,
+0x4C,0x7F,0xEE,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x03,0xFB,0xC7,0xCC,0x3F,0xF5,0xFF,0x01,0xFC,
+0x00,0xED,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x03,0xFE,0x3C,0x7C,0x3F,0xF4,0xFF,0x00,0x01,
+0xED,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x00,0xFE,0xFF,0x3C,0x00,0x3F,0xDF,0xFF,0x00,
+0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFF,0xFF,0x02,0xFE,0x3C,0x7F,0xDE,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xFE,0xFF,0x00,0xFE,0xDD,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xD9,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xFB,0xD9,0xFF,0x00,0xFE,
+0x04,0x7F,0xFB,0xFF,0x00,0x3F,0xFE,0xFF,0x00,0xF3,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xF9,0xFB,0xFF,0x00,0xF7,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFD,0xFB,0xFF,0x00,0xE7,0xD9,0xFF,0x00,0xFE,
+0x01,0x7F,0xFC,0xFB,0xFF,0x00,0xEF,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFE,0x7F,0xFC,0xFF,0x00,0xCF,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0x3F,0xFC,0xFF,0x00,0x1F,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0xC7,0xFD,0xFF,0x01,0xFC,0x7F,0xD9,0xFF,0x00,0xFE,
+0x02,0x7F,0xFF,0xF0,0xFD,0x00,0x00,0x01,0xD8,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x01,0x7F,0x80,0xD2,0x00,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x01,0xFC,0x07,0xFF,0xFF,0x00,0xF9,0xFF,0xFF,0x00,0xCF,0xFC,0xFF,0x02,0xFE,0x7F,0x3F,
+0xFF,0xFF,0x01,0xFE,0x7F,0xFE,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x01,0xF8,0x03,0xFF,0xFF,0x03,0xF9,0xFF,0xFD,0xCF,0xFC,0xFF,0x02,0xFE,0x7F,0x3F,0xFF,
+0xFF,0x02,0xFE,0x7F,0xF9,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x01,0xF8,0xF9,0xFF,0xFF,0x03,0xF9,0xFF,0xF8,0xCF,0xFC,0xFF,0x01,0xFE,0x7F,0xFE,0xFF,
+0x02,0xFE,0x7F,0xF9,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x14,0xF8,0xF9,0xFB,0xFE,0xF9,0xFF,0xF8,0xCF,0xFF,0x7F,0xFF,0xBF,0xEF,0xFE,0x7F,0xFF,
+0x7F,0xBF,0xFE,0x7E,0xF9,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x17,0xF8,0xF9,0xE0,0x70,0x39,0xCF,0xF0,0x40,0x3C,0x1F,0xF8,0x0F,0x03,0x02,0x63,0x20,
+0x1E,0x03,0xFE,0x70,0x30,0x7F,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x14,0xF8,0x01,0xC6,0x33,0x99,0x9F,0xF8,0xC3,0x39,0xCF,0xF8,0xC6,0x71,0x06,0x47,0x21,
+0x9C,0x63,0xFE,0x63,0x19,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x14,0xF8,0x03,0x8F,0x27,0xC9,0x3F,0xF8,0xC7,0x33,0xE7,0xF9,0xE6,0x79,0x1E,0x0F,0x23,
+0xC8,0xE3,0xFE,0x67,0x99,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x14,0xF8,0xC1,0x9F,0x27,0xC8,0x3F,0xF8,0xCF,0x30,0x07,0xF9,0xE7,0xF1,0x1E,0x1F,0x23,
+0xC9,0xF3,0xFE,0x67,0xC9,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0xFF,0xF8,0x12,0x9F,0x07,0xC8,0x3F,0xF8,0xCF,0x30,0x07,0xF9,0xE7,0x01,0x3E,0x0F,0x23,
+0xC9,0xF3,0xFE,0x47,0xC9,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x14,0xF8,0xFC,0x9F,0x07,0xC9,0x1F,0xF8,0xCF,0x33,0xFF,0xF9,0xE6,0x39,0x3E,0x4F,0x23,
+0xC9,0xF3,0xFE,0x67,0xC9,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0xFF,0xF8,0x12,0x8F,0x27,0xC9,0x9F,0xF8,0xCF,0x33,0xE7,0xF9,0xE4,0x79,0x3E,0x67,0x23,
+0xC9,0xF3,0xFE,0x67,0x89,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x14,0xF8,0xF1,0xCE,0x23,0x89,0xCF,0xF8,0xCF,0x31,0xC7,0xF8,0xC4,0x71,0x3E,0x63,0x23,
+0xCC,0xE3,0xFE,0x63,0x99,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x17,0xF8,0x01,0xC0,0x70,0x19,0xC7,0xFC,0x4F,0x38,0x0F,0xF8,0x0E,0x01,0x3E,0x73,0x23,
+0xCC,0x03,0xFE,0x70,0x18,0x7F,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x14,0xFC,0x07,0xF0,0xF8,0x79,0xE7,0xFE,0x6F,0xBE,0x1F,0xF9,0x1F,0x0D,0xBE,0xFB,0x77,
+0xDF,0x33,0xFE,0x78,0x7C,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xDE,0xFF,0x00,0xF9,0xFC,0xFF,0x01,0xFD,0xE3,0xFC,0xFF,0x00,0xFE,
+0x00,0x7F,0xDE,0xFF,0x00,0xF9,0xFC,0xFF,0x01,0xFC,0xE7,0xFC,0xFF,0x00,0xFE,
+0x00,0x7F,0xDE,0xFF,0x00,0xF9,0xFC,0xFF,0x01,0xFC,0x07,0xFC,0xFF,0x00,0xFE,
+0x00,0x7F,0xD7,0xFF,0x00,0x3F,0xFC,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xE6,0xFF,0x01,0xCE,0x67,0xEE,0xFF,0x00,0xFE,
+0x00,0x7F,0xE6,0xFF,0x01,0xEE,0x67,0xEE,0xFF,0x00,0xFE,
+0x00,0x7F,0xE6,0xFF,0x01,0xFE,0x67,0xEE,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xF3,0xCF,0x08,0x24,0x3F,0xE7,0xCC,0x3D,0xF3,0x47,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xF9,0xCE,0x4C,0x20,0x1F,0xE7,0x88,0x0C,0xF3,0x07,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xF9,0x86,0x4E,0x63,0x9F,0xF3,0x93,0xCC,0xF3,0x3F,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xF9,0x86,0x4E,0x63,0x8F,0xF3,0x93,0xC4,0xF3,0x3F,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xF9,0x86,0x4E,0x67,0xCF,0xF3,0x33,0xE4,0xF3,0x3F,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xFC,0xB4,0xCE,0x67,0xCF,0xF9,0x33,0xE4,0xF3,0x3F,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xFC,0x30,0xCE,0x67,0xCF,0xF9,0x33,0xE4,0xF3,0x3F,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xFC,0x30,0xCE,0x67,0xCF,0xF8,0x73,0xC4,0xE3,0x3F,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xFE,0x31,0xCE,0x27,0xCF,0xFC,0x70,0x8C,0x43,0x3F,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x09,0xFE,0x79,0xCE,0x27,0xCF,0xFC,0x78,0x1E,0x03,0x3F,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE3,0xFF,0x00,0xFC,0xF0,0xFF,0x00,0xFE,
+0x00,0x7F,0xE3,0xFF,0x00,0xFC,0xF0,0xFF,0x00,0xFE,
+0x00,0x7F,0xE3,0xFF,0x00,0xE1,0xF0,0xFF,0x00,0xFE,
+0x00,0x7F,0xE3,0xFF,0x00,0xF3,0xF0,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x02,0xFC,0xFF,0x7F,0xFC,0xFF,0x02,0xF0,0x0F,0x3F,0xFE,0xFF,0x02,0x0E,0x00,0x3F,0xFE,
+0xFF,0x00,0x9F,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x02,0xF8,0xFF,0x3F,0xFC,0xFF,0x08,0xF0,0x03,0x3F,0xFE,0x7F,0xFE,0x02,0x00,0x3F,0xFE,
+0xFF,0x00,0x9F,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x00,0xF8,0xFA,0xFF,0xFF,0xF3,0x03,0x3F,0xFE,0x7F,0xFC,0xFF,0xF3,0xFD,0xFF,0x00,0x9F,
+0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x07,0xF8,0xFF,0xFE,0x7F,0x3F,0xEF,0xE7,0xFD,0xFF,0xF3,0x03,0x3F,0x7C,0x7E,0x7C,0xFF,
+0xF3,0x02,0xFD,0xFF,0x7F,0xFF,0x9F,0x02,0xBF,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x0D,0xF8,0xFF,0x38,0x3C,0x0E,0x03,0x81,0xE0,0x73,0xF1,0x38,0x08,0x38,0x1F,0xFF,0xF3,
+0x07,0xE0,0x30,0x1E,0x01,0x9C,0x0F,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x0D,0xF8,0xFF,0x33,0x98,0xC6,0x31,0x18,0xE7,0x33,0xF3,0x31,0xCC,0x71,0x8F,0xFF,0xF3,
+0x07,0xC7,0x31,0x8E,0x61,0x98,0xC7,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x17,0xF8,0xFF,0x27,0x99,0xE6,0x79,0x1C,0xCF,0x90,0x03,0x33,0xCE,0x73,0xCF,0xE7,0xF3,
+0xCF,0x33,0xCC,0xF1,0x99,0xE3,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x17,0xF8,0xFF,0x27,0xF8,0x02,0x79,0x87,0xC0,0x10,0x07,0x3F,0x8E,0x70,0x0F,0xC7,0xF3,
+0xFE,0x33,0xCC,0xF9,0x98,0x03,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x17,0xF8,0xFF,0x27,0xF8,0x02,0x79,0xC1,0xC0,0x13,0xFF,0x38,0x0E,0x60,0x07,0x8F,0xF3,
+0xE0,0x33,0xCC,0xF9,0x98,0x03,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x14,0xF8,0xFF,0x27,0xF9,0xFE,0x79,0xF0,0xCF,0xF3,0xFF,0x31,0xCE,0x63,0xFE,0x3F,0xF3,
+0xC3,0x33,0xCC,0xF9,0x99,0xFF,0xFF,0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x17,0xF8,0xFF,0x27,0xC9,0xF6,0x79,0x3C,0xCF,0xB3,0xFF,0x33,0xCE,0x73,0xCE,0x7F,0xF3,
+0xCF,0x33,0xCC,0xF1,0x99,0xF7,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x17,0xF8,0xFF,0x33,0x98,0xE6,0x79,0x1C,0xC7,0x13,0xFF,0x33,0x8E,0x73,0xCC,0x7F,0xF3,
+0xCE,0x33,0xCE,0x61,0x98,0xE7,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x17,0xF8,0x03,0x30,0x1C,0x06,0x79,0x80,0xE0,0x33,0xFF,0x30,0x06,0x38,0x1C,0x03,0xF3,
+0xC0,0x13,0xCF,0x01,0x9C,0x07,0xFF,0xFE,
+0x00,0x7F,0xE8,0xFF,0x0B,0xFC,0x03,0x7C,0x7E,0x1E,0xFB,0xC3,0xF8,0xF3,0xFF,0xB8,0x6F,0xFF,0x3C,0x09,0x03,
+0xF7,0xE1,0xB7,0xCF,0xD9,0xBE,0x1F,0xFF,0xFE,
+0x00,0x7F,0xD6,0xFF,0x01,0xFC,0xF1,0xFE,0xFF,0x00,0xFE,
+0x00,0x7F,0xD6,0xFF,0x01,0xFE,0x63,0xFE,0xFF,0x00,0xFE,
+0x00,0x7F,0xD6,0xFF,0x01,0xFE,0x07,0xFE,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xE7,0xFF,0x00,0xDF,0xFD,0xFF,0x00,0xFD,0xFF,0xFF,0x00,0xFC,0xF4,0xFF,0x00,0xFE,
+0x00,0x7F,0xE7,0xFF,0x00,0x8F,0xFF,0xFF,0x06,0xCF,0xFF,0xFC,0xFF,0x3F,0xFC,0x7F,0xF5,0xFF,0x00,0xFE,
+0x00,0x7F,0xE7,0xFF,0x00,0x0F,0xFF,0xFF,0x06,0xCF,0xFF,0xFC,0xFF,0x3F,0xF8,0x7F,0xF5,0xFF,0x00,0xFE,
+0x00,0x7F,0xE7,0xFF,0x00,0x07,0xFF,0xFF,0x00,0xCF,0xFE,0xFF,0x02,0x3F,0xF8,0x7F,0xF5,0xFF,0x00,0xFE,
+0x00,0x7F,0xE7,0xFF,0x03,0x27,0xD0,0x78,0x0C,0xFF,0x1C,0x05,0xE0,0x3F,0xF1,0x3C,0x87,0xA1,0xF7,0xFF,0x00,
+0xFE,
+0x00,0x7F,0xE8,0xFF,0x0C,0xFE,0x63,0xC0,0x70,0x0C,0x18,0x0C,0xC0,0x3F,0xF3,0x3C,0x03,0x00,0xF7,0xFF,0x00,
+0xFE,
+0x00,0x7F,0xE8,0xFF,0x0D,0xFE,0x73,0xCF,0x33,0x8C,0x73,0xCC,0xCE,0x3F,0xF3,0x1C,0x71,0x1E,0x7F,0xF8,0xFF,
+0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x0D,0xFE,0x73,0xCF,0x23,0xCC,0xF3,0xE4,0x9F,0x3F,0xE7,0x9C,0x79,0x1E,0x7F,0xF8,0xFF,
+0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x0D,0xFC,0x01,0xCF,0x27,0xCC,0xF3,0xE4,0x9F,0x3F,0xE0,0x1C,0xF9,0x3E,0x7F,0xF8,0xFF,
+0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x0D,0xFC,0x01,0xCF,0x27,0xCC,0xF3,0xE4,0x9F,0x3F,0xC0,0x0C,0xF9,0x3E,0x7F,0xF8,0xFF,
+0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0xFF,0xF8,0x0B,0xCF,0x23,0xCC,0xF3,0xE4,0x9F,0x3F,0xCF,0xCC,0xF9,0x1E,0x7F,0xF8,0xFF,
+0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x0D,0xF9,0xFC,0xCF,0x33,0xCC,0xF3,0xC4,0xCE,0x3F,0xCF,0xC4,0x71,0x1C,0x7F,0xF8,0xFF,
+0x00,0xFE,
+0x00,0x7F,0xE8,0xFF,0x0C,0xF9,0xFC,0xCF,0x31,0x0C,0xF8,0x8C,0xC4,0x3F,0x8F,0xE4,0x23,0x08,0xF7,0xFF,0x00,
+0xFE,
+0x00,0x7F,0xE8,0xFF,0x0C,0xF1,0xFC,0x4F,0x38,0x0C,0xFC,0x1C,0xE0,0x3F,0x9F,0xE4,0x07,0x01,0xF7,0xFF,0x00,
+0xFE,
+0x00,0x7F,0xDE,0xFF,0x02,0xFC,0xFF,0x1F,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xDE,0xFF,0x02,0xFC,0xFF,0x1F,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xDE,0xFF,0x02,0xFC,0xFF,0x1F,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xDE,0xFF,0x02,0xFE,0xFF,0xBF,0xF7,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0x00,0x7F,0xD1,0xFF,0x00,0xFE,
+0xCF,0x00,
+};
+
+static const uint16_t bg_welcomescreen_rows[] = {
+0,2,8,14,20,26,32,38,44,54,67,79,
+91,102,113,128,142,156,170,188,205,222,241,261,
+284,308,332,370,411,451,494,537,579,622,665,708,
+750,793,836,879,921,965,1008,1054,1096,1136,1181,1206,
+1231,1257,1284,1310,1335,1357,1377,1395,1409,1423,1437,1448,
+1459,1470,1482,1494,1507,1519,1525,1531,1537,1543,1549,1556,
+1562,1568,1574,1580,1586,1592,1598,1604,1610,1616,1622,1628,
+1634,1640,1646,1652,1658,1664,1670,1676,1682,1688,1694,1700,
+1706,1712,1718,1724,1730,1736,1742,1748,1754,1760,1766,1772,
+1778,1784,1790,1796,1802,1808,1814,1820,1826,1832,1838,1844,
+1850,1856,1862,1868,1874,1880,1886,1892,1898,1904,1910,1916,
+1922,1928,1934,1940,1946,1976,2006,2035,2065,2094,2124,2154,
+2184,2214,2244,2274,2304,2333,2363,2378,2393,2408,2418,2424,
+2430,2436,2442,2448,2459,2470,2481,2500,2519,2538,2557,2576,
+2595,2614,2633,2652,2671,2681,2691,2701,2711,2717,2723,2729,
+2735,2741,2769,2797,2822,2854,2884,2914,2943,2972,3001,3031,
+3060,3089,3118,3148,3159,3170,3181,3187,3193,3199,3205,3211,
+3229,3249,3269,3289,3311,3333,3356,3379,3402,3425,3448,3471,
+3493,3515,3527,3539,3551,3563,3569,3575,3581,3587,3593,3599,
+3605,3611,3617,3623,3629,3635,3641,3647,3653,3659,3665,3671,
+3677,3683,3689,3695,3701,3707,3713,3719,3725,3731,3737,3743,
+3749,3755,3761,3767,3773,3779,3785,3791,3797,3803,3809,3815,
+3821,3827,3833,3839,3845,3851,3857,3863,3869,3875,3881,3887,
+3893,3899,3905,3911,3917,3923,3929,3935,3941,3947,3953,3959,
+3965,3971,3977,3983,3989,3995,4001,4007,4013,4019,4025,4031,
+};
+
+extern const PackedImage bg_welcomescreen = {
+    400, 300, bg_welcomescreen_rows, bg_welcomescreen_data
+};
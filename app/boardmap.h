@@ -44,6 +44,9 @@
 #define EPAPER_WS42_RST         PC_3
 #define EPAPER_WS42_BUSY        PB_7
 #define EPAPER_WS42_PWR         NC
+#define EPAPER_WS42_SPI_FREQ    10000000
+#define EPAPER_WS42_FULL_REFRESH_INTERVAL  10  // fast status updates between full refreshes
+#define EPAPER_WS42_CLEAR_INTERVAL         0   // screen changes between clearings, 0 never clears
 
 // I-NUCLEO-LRWAN1 UART configuration
 #define LRWAN1_UART_TX          PA_9
@@ -0,0 +1,418 @@
+#include "fonts.h"
+
+// Font 24x16, 26 characters "ABCDEFGHIJKLMNOPQRSTUVWXYZ", 27 glyphs in 602 bytes, 45312 bytes unpacked
+// Generated with tools/pack_font.py from EPD_4R2/Fonts/EuroFont9664.c, do not edit
+static const uint8_t PackedEuroFont2416_Table[] = {
+0x3C,
+0x3C,
+0x3C,
+0x3E,
+0x76,
+0x66,
+0x66,
+0x66,
+0x67,
+0xFF,
+0xFF,
+0xC3,
+0xC3,
+0xC3,
+0xFC,0x00,
+0xFF,0x00,
+0xC7,0x00,
+0xC7,0x00,
+0xC7,0x00,
+0xCE,0x00,
+0xFE,0x00,
+0xC7,0x00,
+0xC3,0x00,
+0xC3,0x80,
+0xC3,0x80,
+0xFF,0x00,
+0xFF,0x00,
+0xFC,0x00,
+0x7F,0x00,
+0xFF,0x00,
+0xC3,0x00,
+0xC3,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC3,0x80,
+0xC3,0x80,
+0xFF,0x00,
+0x7F,0x00,
+0x3C,0x00,
+0x7F,0x00,
+0x7F,0x80,
+0x71,0x80,
+0x71,0x80,
+0x71,0x80,
+0x71,0x80,
+0x71,0x80,
+0x71,0x80,
+0x71,0x80,
+0x71,0x80,
+0x71,0x80,
+0x7F,0x80,
+0xFF,0x80,
+0x7F,0x00,
+0xFF,0x00,
+0xFF,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xFE,0x00,
+0xFC,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xFF,0x00,
+0xFF,0x80,
+0xFF,0x80,
+0xFF,
+0xFF,
+0xC0,
+0xC0,
+0xC0,
+0xC0,
+0xC0,
+0xFE,
+0xFE,
+0xC0,
+0xC0,
+0xC0,
+0xC0,
+0xC0,
+0x7E,0x00,
+0xFF,0x00,
+0xC3,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xCF,0x00,
+0xCF,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xE7,0x80,
+0xFF,0x80,
+0x79,0x00,
+0xC3,0x00,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xFF,0x80,
+0xFF,0x80,
+0xFF,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x00,
+0x78,
+0x78,
+0x30,
+0x30,
+0x30,
+0x30,
+0x30,
+0x30,
+0x30,
+0x30,
+0x30,
+0x7C,
+0xFE,
+0xFC,
+0x0F,0x80,
+0x0F,0x80,
+0x01,0x80,
+0x01,0x80,
+0x01,0x80,
+0x01,0x80,
+0x01,0x80,
+0x01,0x80,
+0x01,0x80,
+0x61,0x80,
+0xE1,0x80,
+0x7F,0x80,
+0x7F,0x80,
+0x3F,0x00,
+0xC3,
+0xC3,
+0xC6,
+0xCC,
+0xDC,
+0xD8,
+0xF8,
+0xF8,
+0xFC,
+0xCC,
+0xCE,
+0xC7,
+0xC7,
+0xC3,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC1,0x00,
+0xC3,0x80,
+0xFF,0x80,
+0xFF,0x80,
+0xFF,0x00,
+0xC3,0x00,
+0xC3,0x80,
+0xE3,0x80,
+0xE7,0x80,
+0xF7,0x80,
+0xFF,0x80,
+0xDB,0x80,
+0xDB,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC1,0x00,
+0xC1,0x00,
+0xC3,0x80,
+0xE3,0x80,
+0xF3,0x80,
+0xF3,0x80,
+0xFB,0x80,
+0xDB,0x80,
+0xDF,0x80,
+0xCF,0x80,
+0xCF,0x80,
+0xC7,0x80,
+0xC7,0x80,
+0xC3,0x80,
+0xC1,0x00,
+0x3C,0x00,
+0x7E,0x00,
+0x67,0x00,
+0xE3,0x00,
+0xC3,0x00,
+0xC3,0x00,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x00,
+0xE7,0x00,
+0x7F,0x00,
+0x3E,0x00,
+0xFE,0x00,
+0xFF,0x00,
+0xE3,0x00,
+0xE3,0x80,
+0xE3,0x80,
+0xE3,0x80,
+0xE3,0x00,
+0xFF,0x00,
+0xFE,0x00,
+0xE0,0x00,
+0xE0,0x00,
+0xE0,0x00,
+0xE0,0x00,
+0x60,0x00,
+0x3E,0x00,
+0xFF,0x00,
+0xE3,0x00,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xCB,0x80,
+0xDF,0x00,
+0xCF,0x00,
+0xFE,0x00,
+0x7F,0x00,
+0x3F,0x00,
+0xFF,
+0xFF,
+0xC7,
+0xC7,
+0xC7,
+0xC7,
+0xFE,
+0xF8,
+0xDC,
+0xCC,
+0xCE,
+0xC6,
+0xC7,
+0xC3,
+0x3E,0x00,
+0x7F,0x00,
+0xE3,0x00,
+0xE3,0x00,
+0xE0,0x00,
+0x78,0x00,
+0x3C,0x00,
+0x1E,0x00,
+0x07,0x00,
+0x03,0x00,
+0xC3,0x80,
+0xE3,0x00,
+0xFF,0x00,
+0x7E,0x00,
+0xFF,0x00,
+0xFF,0x80,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0x18,0x00,
+0xC3,0x00,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xC3,0x80,
+0xE7,0x80,
+0xFF,0x80,
+0x7B,0x00,
+0xC1,
+0xC3,
+0xC3,
+0xE3,
+0xE3,
+0x66,
+0x66,
+0x66,
+0x76,
+0x76,
+0x3C,
+0x3C,
+0x3C,
+0x38,
+0xC1,
+0xC1,
+0xC3,
+0xC3,
+0xC3,
+0xE3,
+0xFB,
+0xFB,
+0x7F,
+0x7F,
+0x7E,
+0x66,
+0x66,
+0x66,
+0xC3,
+0x63,
+0x67,
+0x76,
+0x3E,
+0x3C,
+0x1C,
+0x3C,
+0x3E,
+0x76,
+0x66,
+0x67,
+0xC3,
+0xC3,
+0xC1,
+0xC3,
+0xE3,
+0x63,
+0x66,
+0x76,
+0x36,
+0x3C,
+0x1C,
+0x1C,
+0x1C,
+0x1C,
+0x1C,
+0x18,
+0xFF,0x00,
+0xFF,0x00,
+0x07,0x00,
+0x06,0x00,
+0x0E,0x00,
+0x1C,0x00,
+0x1C,0x00,
+0x38,0x00,
+0x30,0x00,
+0x70,0x00,
+0xE0,0x00,
+0xFF,0x00,
+0xFF,0x80,
+0xFF,0x00,
+};
+
+static const sGLYPH PackedEuroFont2416_Glyphs[] = {
+    {0, 0, 0, 0, 0, 4},
+    {0, 1, 1, 8, 14, 10},
+    {14, 1, 1, 9, 14, 11},
+    {42, 1, 1, 9, 14, 11},
+    {70, 1, 1, 9, 14, 11},
+    {98, 1, 1, 9, 14, 11},
+    {126, 1, 1, 8, 14, 10},
+    {140, 1, 1, 9, 14, 11},
+    {168, 1, 1, 9, 14, 11},
+    {196, 1, 1, 7, 14, 9},
+    {210, 1, 1, 9, 14, 11},
+    {238, 1, 1, 8, 14, 10},
+    {252, 1, 1, 9, 14, 11},
+    {280, 1, 1, 9, 14, 11},
+    {308, 1, 1, 9, 14, 11},
+    {336, 1, 1, 9, 14, 11},
+    {364, 1, 1, 9, 14, 11},
+    {392, 1, 1, 9, 14, 11},
+    {420, 1, 1, 8, 14, 10},
+    {434, 1, 1, 9, 14, 11},
+    {462, 1, 1, 9, 14, 11},
+    {490, 1, 1, 9, 14, 11},
+    {518, 1, 1, 8, 14, 10},
+    {532, 1, 1, 8, 14, 10},
+    {546, 1, 1, 8, 14, 10},
+    {560, 1, 1, 8, 14, 10},
+    {574, 1, 1, 9, 14, 11},
+};
+
+static const uint8_t PackedEuroFont2416_Codes[] = {
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'
+};
+
+static const uint8_t PackedEuroFont2416_Index[] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26
+};
+
+sFONT PackedEuroFont2416 = {
+ PackedEuroFont2416_Table,
+ 24, // width 
+ 16, // Height
+ PackedEuroFont2416_Glyphs,
+ PackedEuroFont2416_Codes,
+ PackedEuroFont2416_Index,
+ 26  // characters
+};
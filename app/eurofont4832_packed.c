@@ -0,0 +1,1110 @@
+#include "fonts.h"
+
+// Font 48x32, 39 characters " -0123456789:ABCDEFGHIJKLMNOPQRSTUVWXYZ", 39 glyphs in 3104 bytes, 45312 bytes unpacked
+// Generated with tools/pack_font.py from EPD_4R2/Fonts/EuroFont9664.c, do not edit
+static const uint8_t PackedEuroFont4832_Table[] = {
+0xFF,0xFF,0xE0,
+0xFF,0xFF,0xE0,
+0xFF,0xFF,0xE0,
+0xFF,0xFF,0xE0,
+0x1F,0xFC,0x00,
+0x3F,0xFE,0x00,
+0x7F,0xFF,0x00,
+0xFF,0xFF,0x00,
+0xF8,0x0E,0x00,
+0xF8,0x0C,0x00,
+0xF8,0x09,0x80,
+0xF8,0x03,0x80,
+0xF8,0x07,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0x7F,0xFF,0x00,
+0x3F,0xFE,0x00,
+0x1F,0xFC,0x00,
+0x01,0xF0,0x00,
+0x03,0xF8,0x00,
+0x07,0xF8,0x00,
+0x0F,0xF8,0x00,
+0x1F,0xF8,0x00,
+0x7F,0xF8,0x00,
+0xFE,0xF8,0x00,
+0xFC,0xF8,0x00,
+0xF8,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x7F,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0x7F,0xFF,0x80,
+0x07,0xF8,0x00,
+0x1F,0xFC,0x00,
+0x3F,0xFE,0x00,
+0x3F,0xFF,0x00,
+0x7F,0xFF,0x80,
+0x7C,0x0F,0x80,
+0x7C,0x0F,0x80,
+0x7C,0x0F,0x80,
+0x00,0x0F,0x80,
+0x00,0x1F,0x00,
+0x00,0x1F,0x00,
+0x00,0x3F,0x00,
+0x00,0x7E,0x00,
+0x00,0x7C,0x00,
+0x00,0xFC,0x00,
+0x01,0xF8,0x00,
+0x03,0xF0,0x00,
+0x07,0xE0,0x00,
+0x0F,0xC0,0x00,
+0x1F,0x80,0x00,
+0x3F,0x00,0x00,
+0x7E,0x00,0x00,
+0xFC,0x00,0x00,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x00,
+0x3F,0xFF,0x00,
+0x7F,0xFF,0x80,
+0x7F,0xFF,0x80,
+0x7F,0xFF,0x80,
+0x00,0x0F,0x80,
+0x00,0x0F,0x80,
+0x00,0x1F,0x80,
+0x00,0x3F,0x00,
+0x00,0x7E,0x00,
+0x00,0xFC,0x00,
+0x01,0xF8,0x00,
+0x03,0xF0,0x00,
+0x03,0xF0,0x00,
+0x03,0xFE,0x00,
+0x03,0xFF,0x00,
+0x01,0xFF,0x80,
+0x00,0x0F,0x80,
+0x00,0x0F,0x80,
+0x00,0x0F,0x80,
+0x70,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x1F,0x80,
+0x7F,0xFF,0x00,
+0x7F,0xFF,0x00,
+0x3F,0xFE,0x00,
+0x1F,0xFC,0x00,
+0x0F,0xF0,0x00,
+0x00,0x3C,0x00,
+0x00,0x7C,0x00,
+0x00,0x7C,0x00,
+0x00,0xF8,0x00,
+0x00,0xF8,0x00,
+0x01,0xF0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x07,0xC0,0x00,
+0x07,0xC0,0x00,
+0x0F,0x80,0x00,
+0x1F,0x00,0x00,
+0x1F,0x00,0x00,
+0x3E,0x3E,0x00,
+0x3E,0x3E,0x00,
+0x7C,0x3E,0x00,
+0xF8,0x3E,0x00,
+0xF8,0x3E,0x00,
+0xFF,0xFF,0x00,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x00,
+0x00,0x3E,0x00,
+0x00,0x3E,0x00,
+0x00,0x3E,0x00,
+0x00,0x3E,0x00,
+0x00,0x3C,0x00,
+0x7F,0xFF,0x00,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x70,0x00,
+0xFB,0xFC,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFF,0x00,
+0xFF,0xFF,0x00,
+0x7C,0x1F,0x80,
+0x00,0x0F,0x80,
+0x00,0x0F,0x80,
+0x00,0x0F,0x80,
+0x00,0x0F,0x80,
+0x00,0x0F,0x80,
+0x00,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x1F,0x80,
+0xFF,0xFF,0x00,
+0xFF,0xFF,0x00,
+0x7F,0xFE,0x00,
+0x3F,0xFC,0x00,
+0x1F,0xF0,0x00,
+0x00,0xF0,0x00,
+0x01,0xF0,0x00,
+0x03,0xF0,0x00,
+0x03,0xE0,0x00,
+0x07,0xC0,0x00,
+0x0F,0xC0,0x00,
+0x0F,0x80,0x00,
+0x1F,0x80,0x00,
+0x1F,0x00,0x00,
+0x3E,0x00,0x00,
+0x3F,0xF8,0x00,
+0x7F,0xFE,0x00,
+0x7F,0xFE,0x00,
+0x7F,0xFF,0x00,
+0xFC,0x1F,0x00,
+0xF8,0x1F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x1F,0x00,
+0x7C,0x1F,0x00,
+0x7F,0xFE,0x00,
+0x3F,0xFE,0x00,
+0x1F,0xFC,0x00,
+0x0F,0xF8,0x00,
+0x03,0xE0,0x00,
+0x7F,0xFF,0x00,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xF8,0x1F,0x80,
+0xF8,0x1F,0x80,
+0xF8,0x3F,0x00,
+0x00,0x3E,0x00,
+0x00,0x7E,0x00,
+0x00,0x7C,0x00,
+0x00,0xFC,0x00,
+0x00,0xF8,0x00,
+0x01,0xF8,0x00,
+0x01,0xF0,0x00,
+0x03,0xF0,0x00,
+0x03,0xE0,0x00,
+0x07,0xE0,0x00,
+0x07,0xC0,0x00,
+0x0F,0x80,0x00,
+0x1F,0x80,0x00,
+0x1F,0x80,0x00,
+0x1F,0x80,0x00,
+0x1F,0x80,0x00,
+0x1F,0x80,0x00,
+0x1F,0x80,0x00,
+0x1F,0x80,0x00,
+0x0F,0x00,0x00,
+0x07,0xF0,0x00,
+0x1F,0xFC,0x00,
+0x3F,0xFE,0x00,
+0x3F,0xFE,0x00,
+0x7C,0x3E,0x00,
+0x7C,0x1F,0x00,
+0x7C,0x1F,0x00,
+0x7C,0x1F,0x00,
+0x7C,0x1F,0x00,
+0x7C,0x3E,0x00,
+0x3F,0xFE,0x00,
+0x1F,0xFC,0x00,
+0x1F,0xFC,0x00,
+0x3F,0xFE,0x00,
+0x7E,0x3F,0x00,
+0x7C,0x1F,0x00,
+0xF8,0x1F,0x00,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x1F,0x80,
+0xFC,0x1F,0x00,
+0x7F,0xFF,0x00,
+0x7F,0xFE,0x00,
+0x3F,0xFC,0x00,
+0x1F,0xF8,0x00,
+0x07,0xF0,0x00,
+0x07,0xF0,0x00,
+0x1F,0xFC,0x00,
+0x3F,0xFE,0x00,
+0x7F,0xFE,0x00,
+0x7F,0xFF,0x00,
+0xFC,0x1F,0x00,
+0xF8,0x1F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xFC,0x1F,0x80,
+0xFF,0x9F,0x00,
+0x7F,0x9F,0x00,
+0x3F,0x3F,0x00,
+0x1E,0x7E,0x00,
+0x04,0x7C,0x00,
+0x00,0xFC,0x00,
+0x01,0xF8,0x00,
+0x01,0xF0,0x00,
+0x03,0xF0,0x00,
+0x07,0xE0,0x00,
+0x0F,0xC0,0x00,
+0x0F,0xC0,0x00,
+0x1F,0x80,0x00,
+0x3F,0x00,0x00,
+0x1F,0x00,0x00,
+0x02,0x40,0x00,
+0x0C,0x10,0x00,
+0x10,0x08,0x00,
+0x20,0x04,0x00,
+0x20,0x04,0x00,
+0x20,0x02,0x00,
+0x60,0x02,0x00,
+0x20,0x02,0x00,
+0x20,0x04,0x00,
+0x20,0x04,0x00,
+0x10,0x08,0x00,
+0x08,0x10,0x00,
+0x03,0xE0,0x00,
+0x00,0x00,0x00,
+0x00,0x00,0x00,
+0x03,0xC0,0x00,
+0x0C,0x10,0x00,
+0x10,0x04,0x00,
+0x00,0x02,0x00,
+0x40,0x02,0x00,
+0x80,0x01,0x00,
+0x80,0x01,0x00,
+0x80,0x00,0x80,
+0x80,0x00,0x80,
+0x80,0x00,0x80,
+0x80,0x01,0x00,
+0x80,0x01,0x00,
+0x40,0x01,0x00,
+0x40,0x02,0x00,
+0x20,0x04,0x00,
+0x18,0x08,0x00,
+0x07,0xE0,0x00,
+0x03,0xF8,0x00,
+0x07,0xF8,0x00,
+0x07,0xFC,0x00,
+0x07,0xFC,0x00,
+0x07,0xFC,0x00,
+0x0F,0xFC,0x00,
+0x0F,0xBC,0x00,
+0x0F,0x3E,0x00,
+0x0F,0x3E,0x00,
+0x0F,0x3E,0x00,
+0x1F,0x3E,0x00,
+0x1F,0x1E,0x00,
+0x1E,0x1F,0x00,
+0x1E,0x1F,0x00,
+0x1E,0x1F,0x00,
+0x3E,0x1F,0x00,
+0x3E,0x1F,0x00,
+0x3E,0x0F,0x80,
+0x3F,0xFF,0x80,
+0x3F,0xFF,0x80,
+0x7F,0xFF,0x80,
+0x7F,0xFF,0x80,
+0x7C,0x07,0xC0,
+0x78,0x07,0xC0,
+0x78,0x07,0xC0,
+0x78,0x07,0xC0,
+0xF8,0x07,0xC0,
+0x70,0x03,0xC0,
+0x7F,0xF8,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFF,0x00,
+0xFF,0xFF,0x00,
+0xF8,0x1F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x00,
+0xF8,0x1F,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFC,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFF,0x00,
+0xF8,0x0F,0x80,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x0F,0xC0,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x00,
+0xFF,0xFE,0x00,
+0x7F,0xF8,0x00,
+0x1F,0xFF,0x00,
+0x3F,0xFF,0x80,
+0x7F,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x07,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x03,0xC0,
+0xF8,0x07,0xC0,
+0xFC,0x07,0xC0,
+0x7C,0x07,0xC0,
+0x7E,0x0F,0xC0,
+0x7F,0xFF,0x80,
+0x3F,0xFF,0x80,
+0x1F,0xFF,0x00,
+0x0F,0xFE,0x00,
+0x03,0xF0,0x00,
+0xFF,0xFC,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFF,0x00,
+0xFF,0xFF,0x80,
+0x3E,0x0F,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x0F,0xC0,
+0x7F,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x00,
+0xFF,0xFE,0x00,
+0x7F,0xF8,0x00,
+0xFF,0xFF,0x00,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xFF,0xF8,0x00,
+0xFF,0xF8,0x00,
+0xFF,0xF8,0x00,
+0xFF,0xF0,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0x80,
+0x3F,0xFF,0xC0,
+0x7F,0xFF,0xC0,
+0x7F,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFC,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xFF,0xFC,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFE,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0x78,0x00,0x00,
+0x1F,0xFE,0x00,
+0x3F,0xFF,0x00,
+0x7F,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x07,0x80,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0xFF,0xC0,
+0xF8,0xFF,0xC0,
+0xF8,0xFF,0xC0,
+0xF8,0x7F,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xFC,0x0F,0xC0,
+0x7F,0xFF,0xC0,
+0x7F,0xFF,0xC0,
+0x3F,0xFB,0xC0,
+0x1F,0xF3,0xC0,
+0x0F,0xE1,0xC0,
+0x78,0x03,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0x78,0x03,0xC0,
+0x1F,0xE0,
+0x1F,0xF0,
+0x1F,0xF0,
+0x0F,0xE0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x07,0xC0,
+0x7F,0xFC,
+0xFF,0xFC,
+0xFF,0xFC,
+0xFF,0xFC,
+0x7F,0xFC,
+0x03,0xFF,0xC0,
+0x03,0xFF,0xC0,
+0x03,0xFF,0xC0,
+0x03,0xFF,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0x00,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xFF,0xFF,0xC0,
+0x7F,0xFF,0x80,
+0x7F,0xFF,0x00,
+0x3F,0xFF,0x00,
+0x0F,0xFC,0x00,
+0x78,0x03,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0x80,
+0xF8,0x0F,0x00,
+0xF8,0x1F,0x00,
+0xF8,0x3E,0x00,
+0xF8,0x7C,0x00,
+0xF8,0x78,0x00,
+0xF8,0xF8,0x00,
+0xF9,0xF0,0x00,
+0xFB,0xE0,0x00,
+0xFB,0xE0,0x00,
+0xFF,0xC0,0x00,
+0xFF,0xE0,0x00,
+0xFF,0xE0,0x00,
+0xFF,0xF0,0x00,
+0xFF,0xF0,0x00,
+0xFD,0xF8,0x00,
+0xFC,0xFC,0x00,
+0xF8,0x7C,0x00,
+0xF8,0x7E,0x00,
+0xF8,0x3E,0x00,
+0xF8,0x3F,0x00,
+0xF8,0x1F,0x00,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0xC0,
+0xF8,0x07,0xC0,
+0x70,0x03,0xC0,
+0xF0,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x00,0x00,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x00,
+0x78,0x03,0xC0,
+0xF8,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x0F,0xC0,
+0xFE,0x0F,0xC0,
+0xFE,0x1F,0xC0,
+0xFF,0x1F,0xC0,
+0xFF,0x3F,0xC0,
+0xFF,0xBF,0xC0,
+0xFB,0xBB,0xC0,
+0xFB,0xFB,0xC0,
+0xFB,0xF3,0xC0,
+0xF9,0xF3,0xC0,
+0xF9,0xE3,0xC0,
+0xF8,0xE3,0xC0,
+0xF8,0x43,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0x78,0x03,0xC0,
+0x78,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xF8,0x03,0xC0,
+0xFC,0x03,0xC0,
+0xFE,0x03,0xC0,
+0xFE,0x03,0xC0,
+0xFF,0x03,0xC0,
+0xFF,0x03,0xC0,
+0xFF,0x83,0xC0,
+0xFF,0x83,0xC0,
+0xFF,0xC3,0xC0,
+0xFF,0xE3,0xC0,
+0xFB,0xE3,0xC0,
+0xFB,0xF3,0xC0,
+0xF9,0xF3,0xC0,
+0xF8,0xFB,0xC0,
+0xF8,0xFF,0xC0,
+0xF8,0x7F,0xC0,
+0xF8,0x7F,0xC0,
+0xF8,0x3F,0xC0,
+0xF8,0x3F,0xC0,
+0xF8,0x1F,0xC0,
+0xF8,0x0F,0xC0,
+0xF8,0x0F,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x03,0xC0,
+0x70,0x03,0xC0,
+0x01,0xF0,0x00,
+0x07,0xF8,0x00,
+0x0F,0xFC,0x00,
+0x1F,0xFE,0x00,
+0x1F,0x3F,0x00,
+0x3E,0x1F,0x00,
+0x3E,0x0F,0x80,
+0x3C,0x0F,0x80,
+0x7C,0x07,0x80,
+0x7C,0x07,0xC0,
+0x7C,0x07,0xC0,
+0x7C,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xFC,0x07,0xC0,
+0x7C,0x07,0xC0,
+0x7C,0x07,0xC0,
+0x7E,0x0F,0xC0,
+0x7F,0xFF,0x80,
+0x3F,0xFF,0x80,
+0x1F,0xFF,0x00,
+0x0F,0xFE,0x00,
+0x07,0xF8,0x00,
+0x7F,0xFC,0x00,
+0xFF,0xFE,0x00,
+0xFF,0xFF,0x00,
+0x7F,0xFF,0x80,
+0x3E,0x0F,0x80,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x3E,0x0F,0xC0,
+0x3E,0x0F,0x80,
+0x3F,0xFF,0x80,
+0x3F,0xFF,0x00,
+0x3F,0xFE,0x00,
+0x3F,0xFC,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3C,0x00,0x00,
+0x07,0xF8,0x00,
+0x1F,0xFE,0x00,
+0x3F,0xFF,0x00,
+0x7F,0xFF,0x80,
+0x7E,0x0F,0xC0,
+0xFC,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xF9,0xE7,0xC0,
+0xF8,0xF7,0xC0,
+0xF8,0xFF,0x80,
+0xF8,0x7F,0x80,
+0x7C,0x3F,0x00,
+0x7C,0x3F,0x00,
+0x7F,0xFF,0x00,
+0x3F,0xFF,0x80,
+0x1F,0xFF,0x80,
+0x0F,0xFF,0xC0,
+0x03,0xFF,0xC0,
+0x7F,0xFF,0x00,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xFF,0xFF,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xFB,0xFF,0x00,
+0xFB,0xFE,0x00,
+0xFB,0xF8,0x00,
+0xFB,0xF0,0x00,
+0xFB,0xE0,0x00,
+0xF9,0xF0,0x00,
+0xF9,0xF8,0x00,
+0xF8,0xF8,0x00,
+0xF8,0xFC,0x00,
+0xF8,0x7C,0x00,
+0xF8,0x3E,0x00,
+0xF8,0x3F,0x00,
+0xF8,0x1F,0x00,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x07,0xC0,
+0x78,0x03,0xC0,
+0x03,0xFC,0x00,
+0x0F,0xFF,0x00,
+0x1F,0xFF,0x80,
+0x3F,0xFF,0x80,
+0x3E,0x07,0xC0,
+0x3E,0x07,0xC0,
+0x7C,0x07,0xC0,
+0x7E,0x03,0x80,
+0x3E,0x00,0x00,
+0x3F,0x00,0x00,
+0x3F,0x80,0x00,
+0x1F,0xE0,0x00,
+0x0F,0xF0,0x00,
+0x07,0xFC,0x00,
+0x03,0xFE,0x00,
+0x00,0xFF,0x00,
+0x00,0x7F,0x80,
+0x00,0x1F,0xC0,
+0x00,0x0F,0xC0,
+0x00,0x07,0xC0,
+0x78,0x07,0xC0,
+0xF8,0x07,0xC0,
+0xFC,0x07,0xC0,
+0x7F,0x3F,0xC0,
+0x7F,0xFF,0x80,
+0x3F,0xFF,0x00,
+0x1F,0xFE,0x00,
+0x0F,0xF8,0x00,
+0x7F,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0x7F,0xFF,0xC0,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xF0,0x00,
+0x01,0xE0,0x00,
+0x78,0x03,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0xFC,0x07,0xC0,
+0x7C,0x07,0xC0,
+0x7C,0x0F,0xC0,
+0x7C,0x1F,0xC0,
+0x7F,0xFF,0xC0,
+0x7F,0xFF,0xC0,
+0x3F,0xFF,0xC0,
+0x1F,0xF7,0xC0,
+0x0F,0xC3,0xC0,
+0x78,0x03,0xC0,
+0xF8,0x03,0xC0,
+0x78,0x03,0xC0,
+0x7C,0x07,0xC0,
+0x7C,0x07,0xC0,
+0x7C,0x07,0x80,
+0x7C,0x07,0x80,
+0x7C,0x07,0x80,
+0x3C,0x0F,0x80,
+0x3E,0x0F,0x00,
+0x3E,0x0F,0x00,
+0x3E,0x0F,0x00,
+0x3E,0x0F,0x00,
+0x1E,0x1E,0x00,
+0x1F,0x1E,0x00,
+0x1F,0x1E,0x00,
+0x1F,0x1E,0x00,
+0x1F,0x3C,0x00,
+0x0F,0x3C,0x00,
+0x0F,0xBC,0x00,
+0x0F,0xBC,0x00,
+0x0F,0xBC,0x00,
+0x0F,0xF8,0x00,
+0x0F,0xF8,0x00,
+0x07,0xF8,0x00,
+0x07,0xF8,0x00,
+0x07,0xF0,0x00,
+0x03,0xE0,0x00,
+0xF0,0x03,0x80,
+0xF8,0x07,0x80,
+0xF8,0x07,0x80,
+0xF8,0x07,0x80,
+0xF8,0x07,0x80,
+0xF8,0x07,0x80,
+0xF8,0x07,0x80,
+0xF8,0x0F,0x00,
+0xF8,0x0F,0x00,
+0xF8,0x0F,0x00,
+0xF8,0x0F,0x00,
+0xF9,0xCF,0x00,
+0x79,0xCF,0x00,
+0x79,0xCF,0x00,
+0x79,0xCF,0x00,
+0x7B,0xDF,0x00,
+0x7B,0xDE,0x00,
+0x7F,0xFE,0x00,
+0x7F,0xFE,0x00,
+0x7F,0xFE,0x00,
+0x7F,0xFE,0x00,
+0x7F,0x7E,0x00,
+0x3E,0x7E,0x00,
+0x3E,0x3E,0x00,
+0x3E,0x3C,0x00,
+0x3C,0x3C,0x00,
+0x3C,0x3C,0x00,
+0x38,0x1C,0x00,
+0xF8,0x07,0x80,
+0xF8,0x0F,0x80,
+0x7C,0x0F,0x00,
+0x7C,0x1F,0x00,
+0x3E,0x1E,0x00,
+0x3E,0x3E,0x00,
+0x1E,0x3C,0x00,
+0x1F,0x7C,0x00,
+0x1F,0xFC,0x00,
+0x0F,0xF8,0x00,
+0x0F,0xF8,0x00,
+0x07,0xF0,0x00,
+0x07,0xF0,0x00,
+0x07,0xF0,0x00,
+0x07,0xF0,0x00,
+0x0F,0xF8,0x00,
+0x0F,0xF8,0x00,
+0x0F,0xF8,0x00,
+0x1F,0x7C,0x00,
+0x1E,0x7C,0x00,
+0x3E,0x3E,0x00,
+0x3C,0x3E,0x00,
+0x7C,0x3F,0x00,
+0x78,0x1F,0x00,
+0xF8,0x1F,0x00,
+0xF0,0x0F,0x80,
+0xF0,0x0F,0x80,
+0xE0,0x07,0x80,
+0xF0,0x03,0x80,
+0xF0,0x07,0x80,
+0xF8,0x07,0x80,
+0xF8,0x0F,0x80,
+0xF8,0x0F,0x00,
+0x7C,0x0F,0x00,
+0x7C,0x1F,0x00,
+0x7C,0x1E,0x00,
+0x3E,0x1E,0x00,
+0x3E,0x3E,0x00,
+0x3E,0x3C,0x00,
+0x1F,0x3C,0x00,
+0x1F,0x7C,0x00,
+0x1F,0x78,0x00,
+0x0F,0xF8,0x00,
+0x0F,0xF8,0x00,
+0x07,0xF0,0x00,
+0x07,0xF0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x03,0xE0,0x00,
+0x01,0xC0,0x00,
+0x7F,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0x7F,0xFF,0xC0,
+0x00,0x0F,0x80,
+0x00,0x1F,0x80,
+0x00,0x1F,0x00,
+0x00,0x3F,0x00,
+0x00,0x7E,0x00,
+0x00,0x7C,0x00,
+0x00,0xFC,0x00,
+0x00,0xF8,0x00,
+0x01,0xF0,0x00,
+0x03,0xF0,0x00,
+0x03,0xE0,0x00,
+0x07,0xE0,0x00,
+0x0F,0xC0,0x00,
+0x0F,0x80,0x00,
+0x1F,0x80,0x00,
+0x3F,0x00,0x00,
+0x3E,0x00,0x00,
+0x7E,0x00,0x00,
+0xFC,0x00,0x00,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0xFF,0xFF,0xC0,
+0x7F,0xFF,0xC0,
+};
+
+static const sGLYPH PackedEuroFont4832_Glyphs[] = {
+    {0, 0, 0, 0, 0, 8},
+    {0, 1, 13, 19, 4, 21},
+    {12, 1, 2, 17, 28, 19},
+    {96, 1, 2, 17, 28, 19},
+    {180, 1, 2, 17, 28, 19},
+    {264, 1, 2, 17, 28, 19},
+    {348, 1, 2, 17, 28, 19},
+    {432, 1, 2, 17, 28, 19},
+    {516, 1, 2, 17, 28, 19},
+    {600, 1, 2, 17, 28, 19},
+    {684, 1, 2, 17, 28, 19},
+    {768, 1, 2, 17, 28, 19},
+    {852, 1, 0, 17, 32, 19},
+    {948, 1, 2, 18, 28, 20},
+    {1032, 1, 2, 18, 28, 20},
+    {1116, 1, 2, 18, 28, 20},
+    {1200, 1, 2, 18, 28, 20},
+    {1284, 1, 2, 18, 28, 20},
+    {1368, 1, 2, 18, 28, 20},
+    {1452, 1, 2, 18, 28, 20},
+    {1536, 1, 2, 18, 28, 20},
+    {1620, 1, 2, 14, 28, 16},
+    {1676, 1, 2, 18, 28, 20},
+    {1760, 1, 2, 18, 28, 20},
+    {1844, 1, 2, 18, 28, 20},
+    {1928, 1, 2, 18, 28, 20},
+    {2012, 1, 2, 18, 28, 20},
+    {2096, 1, 2, 18, 28, 20},
+    {2180, 1, 2, 18, 28, 20},
+    {2264, 1, 2, 18, 28, 20},
+    {2348, 1, 2, 18, 28, 20},
+    {2432, 1, 2, 18, 28, 20},
+    {2516, 1, 2, 18, 28, 20},
+    {2600, 1, 2, 18, 28, 20},
+    {2684, 1, 2, 18, 28, 20},
+    {2768, 1, 2, 17, 28, 19},
+    {2852, 1, 2, 17, 28, 19},
+    {2936, 1, 2, 17, 28, 19},
+    {3020, 1, 2, 18, 28, 20},
+};
+
+static const uint8_t PackedEuroFont4832_Codes[] = {
+    ' ', '-', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'
+};
+
+static const uint8_t PackedEuroFont4832_Index[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38
+};
+
+sFONT PackedEuroFont4832 = {
+ PackedEuroFont4832_Table,
+ 48, // width 
+ 32, // Height
+ PackedEuroFont4832_Glyphs,
+ PackedEuroFont4832_Codes,
+ PackedEuroFont4832_Index,
+ 39  // characters
+};
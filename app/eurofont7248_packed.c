@@ -0,0 +1,1600 @@
+#include "fonts.h"
+
+// Font 72x48, 39 characters " -0123456789:ABCDEFGHIJKLMNOPQRSTUVWXYZ", 39 glyphs in 5972 bytes, 45312 bytes unpacked
+// Generated with tools/pack_font.py from EPD_4R2/Fonts/EuroFont9664.c, do not edit
+static const uint8_t PackedEuroFont7248_Table[] = {
+0x3F,0xFF,0xFF,0xF0,
+0x7F,0xFF,0xFF,0xF0,
+0xFF,0xFF,0xFF,0xF0,
+0xFF,0xFF,0xFF,0xF0,
+0xFF,0xFF,0xFF,0xF0,
+0xFF,0xFF,0xFF,0xF0,
+0x7F,0xFF,0xFF,0xF0,
+0x03,0xFF,0xE0,0x00,
+0x1F,0xFF,0xFC,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x7F,0xFF,0xFF,0x00,
+0x7F,0xFF,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,
+0xFE,0x00,0x3E,0x00,
+0xFE,0x00,0x3C,0x00,
+0xFE,0x00,0x38,0x80,
+0xFE,0x00,0x31,0x80,
+0xFE,0x00,0x07,0x80,
+0xFE,0x00,0x0F,0x80,
+0xFE,0x00,0x1F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFF,0x00,0x3F,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0x00,
+0x7F,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFC,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0xFF,0xC0,0x00,
+0x01,0xFF,0xC0,0x00,
+0x03,0xFF,0xC0,0x00,
+0x07,0xFF,0xC0,0x00,
+0x0F,0xFF,0xC0,0x00,
+0x1F,0xFF,0xC0,0x00,
+0x7F,0xFF,0xC0,0x00,
+0xFF,0xFF,0xC0,0x00,
+0xFF,0x9F,0xC0,0x00,
+0xFF,0x1F,0xC0,0x00,
+0xFE,0x1F,0xC0,0x00,
+0xFC,0x1F,0xC0,0x00,
+0xF8,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0x00,0x3F,0x80,0x00,
+0x03,0xFF,0xF8,0x00,
+0x07,0xFF,0xFC,0x00,
+0x0F,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0x80,
+0x3F,0xC0,0xFF,0x80,
+0x3F,0x80,0x3F,0x80,
+0x7F,0x80,0x3F,0x80,
+0x7F,0x80,0x3F,0x80,
+0x3F,0x00,0x3F,0x80,
+0x00,0x00,0x3F,0x80,
+0x00,0x00,0x7F,0x00,
+0x00,0x00,0x7F,0x00,
+0x00,0x00,0xFF,0x00,
+0x00,0x00,0xFE,0x00,
+0x00,0x01,0xFE,0x00,
+0x00,0x03,0xFE,0x00,
+0x00,0x03,0xFC,0x00,
+0x00,0x07,0xF8,0x00,
+0x00,0x0F,0xF8,0x00,
+0x00,0x1F,0xF0,0x00,
+0x00,0x3F,0xE0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0xFF,0x80,0x00,
+0x01,0xFF,0x00,0x00,
+0x03,0xFE,0x00,0x00,
+0x07,0xFC,0x00,0x00,
+0x0F,0xF8,0x00,0x00,
+0x1F,0xF0,0x00,0x00,
+0x3F,0xE0,0x00,0x00,
+0x7F,0xC0,0x00,0x00,
+0x7F,0xC0,0x00,0x00,
+0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,
+0x7F,0xFF,0xFF,
+0x7F,0xFF,0xFF,
+0x7F,0xFF,0xFF,
+0x7F,0xFF,0xFF,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0xFF,
+0x00,0x01,0xFE,
+0x00,0x03,0xFC,
+0x00,0x07,0xF8,
+0x00,0x0F,0xF0,
+0x00,0x1F,0xE0,
+0x00,0x3F,0xC0,
+0x00,0x7F,0x80,
+0x00,0xFF,0x00,
+0x00,0xFF,0x00,
+0x00,0xFF,0xF0,
+0x00,0xFF,0xF8,
+0x00,0xFF,0xFC,
+0x00,0xFF,0xFE,
+0x00,0x00,0xFF,
+0x00,0x00,0xFF,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0xFC,0x00,0x7F,
+0xFE,0x00,0x7F,
+0xFE,0x00,0x7F,
+0xFE,0x00,0xFF,
+0xFE,0x00,0xFF,
+0xFF,0x03,0xFE,
+0xFF,0xFF,0xFE,
+0xFF,0xFF,0xFC,
+0x7F,0xFF,0xFC,
+0x3F,0xFF,0xF8,
+0x1F,0xFF,0xF0,
+0x0F,0xFF,0xE0,
+0x00,0xFE,0x00,
+0x00,0x00,0xF8,0x00,
+0x00,0x01,0xFC,0x00,
+0x00,0x03,0xF8,0x00,
+0x00,0x07,0xF8,0x00,
+0x00,0x07,0xF0,0x00,
+0x00,0x0F,0xF0,0x00,
+0x00,0x0F,0xE0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x1F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x7F,0x80,0x00,
+0x00,0x7F,0x00,0x00,
+0x00,0xFF,0x00,0x00,
+0x01,0xFE,0x00,0x00,
+0x01,0xFC,0x00,0x00,
+0x01,0xFC,0x00,0x00,
+0x03,0xF8,0x00,0x00,
+0x07,0xF0,0x00,0x00,
+0x0F,0xF0,0x00,0x00,
+0x0F,0xE1,0xF8,0x00,
+0x1F,0xE1,0xFC,0x00,
+0x1F,0xC1,0xFC,0x00,
+0x3F,0x81,0xFC,0x00,
+0x3F,0x81,0xFC,0x00,
+0x7F,0x01,0xFC,0x00,
+0x7F,0x01,0xFC,0x00,
+0xFE,0x01,0xFC,0x00,
+0xFF,0x01,0xFC,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0x00,
+0x00,0x01,0xFC,0x00,
+0x00,0x01,0xFC,0x00,
+0x00,0x01,0xFC,0x00,
+0x00,0x01,0xFC,0x00,
+0x00,0x01,0xFC,0x00,
+0x00,0x01,0xFC,0x00,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFE,0x00,0x00,
+0xFE,0x00,0x00,
+0xFE,0x00,0x00,
+0xFE,0x00,0x00,
+0xFE,0x00,0x00,
+0xFE,0x00,0x00,
+0xFE,0x00,0x00,
+0xFE,0x00,0x00,
+0xFE,0x0F,0x80,
+0xFE,0x7F,0xE0,
+0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFC,
+0xFF,0xFF,0xFC,
+0xFF,0xFF,0xFE,
+0xFF,0xC3,0xFE,
+0xFF,0x80,0xFF,
+0x00,0x00,0xFF,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0x00,0x00,0x7F,
+0xFC,0x00,0x7F,
+0xFE,0x00,0xFF,
+0xFE,0x00,0xFF,
+0xFF,0x03,0xFE,
+0xFF,0xFF,0xFE,
+0xFF,0xFF,0xFC,
+0xFF,0xFF,0xFC,
+0xFF,0xFF,0xF8,
+0x7F,0xFF,0xF0,
+0x3F,0xFF,0xE0,
+0x03,0xFC,0x00,
+0x00,0x07,0x80,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x7F,0x80,0x00,
+0x00,0xFF,0x00,0x00,
+0x01,0xFF,0x00,0x00,
+0x01,0xFE,0x00,0x00,
+0x01,0xFC,0x00,0x00,
+0x03,0xFC,0x00,0x00,
+0x07,0xF8,0x00,0x00,
+0x07,0xF8,0x00,0x00,
+0x0F,0xF0,0x00,0x00,
+0x0F,0xE0,0x00,0x00,
+0x1F,0xE0,0x00,0x00,
+0x1F,0xFF,0xE0,0x00,
+0x1F,0xFF,0xF8,0x00,
+0x3F,0xFF,0xFC,0x00,
+0x7F,0xFF,0xFE,0x00,
+0x7F,0xFF,0xFF,0x00,
+0x7F,0xF7,0xFF,0x00,
+0x7F,0x80,0xFF,0x00,
+0x7F,0x00,0x7F,0x00,
+0x7F,0x00,0x7F,0x80,
+0x7F,0x00,0x7F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFF,0x00,0x3F,0x80,
+0x7F,0x00,0x7F,0x00,
+0x7F,0x00,0x7F,0x00,
+0x7F,0x80,0xFF,0x00,
+0x7F,0xF7,0xFE,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFC,0x00,
+0x1F,0xFF,0xF8,0x00,
+0x0F,0xFF,0xF0,0x00,
+0x07,0xFF,0xE0,0x00,
+0x01,0xFF,0xC0,0x00,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,
+0xFE,0x00,0xFF,
+0xFE,0x01,0xFF,
+0xFE,0x01,0xFE,
+0xFE,0x01,0xFE,
+0x00,0x03,0xFC,
+0x00,0x03,0xFC,
+0x00,0x07,0xF8,
+0x00,0x0F,0xF8,
+0x00,0x0F,0xF0,
+0x00,0x0F,0xE0,
+0x00,0x1F,0xE0,
+0x00,0x1F,0xE0,
+0x00,0x3F,0xC0,
+0x00,0x7F,0x80,
+0x00,0x7F,0x80,
+0x00,0xFF,0x00,
+0x00,0xFF,0x00,
+0x01,0xFE,0x00,
+0x01,0xFE,0x00,
+0x03,0xFC,0x00,
+0x03,0xFC,0x00,
+0x07,0xF8,0x00,
+0x0F,0xF8,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x0F,0xF0,0x00,
+0x07,0xE0,0x00,
+0x00,0x3C,0x00,0x00,
+0x03,0xFF,0xE0,0x00,
+0x07,0xFF,0xF8,0x00,
+0x0F,0xFF,0xFC,0x00,
+0x1F,0xFF,0xFC,0x00,
+0x3F,0xF7,0xFE,0x00,
+0x3F,0xC1,0xFE,0x00,
+0x3F,0x80,0xFE,0x00,
+0x3F,0x80,0xFE,0x00,
+0x7F,0x80,0xFE,0x00,
+0x7F,0x80,0xFE,0x00,
+0x7F,0x80,0xFE,0x00,
+0x3F,0x80,0xFE,0x00,
+0x3F,0x80,0xFE,0x00,
+0x3F,0xC1,0xFE,0x00,
+0x1F,0xE3,0xFC,0x00,
+0x1F,0xFF,0xF8,0x00,
+0x0F,0xFF,0xF0,0x00,
+0x0F,0xFF,0xF0,0x00,
+0x0F,0xFF,0xF8,0x00,
+0x1F,0xFF,0xFC,0x00,
+0x3F,0xC3,0xFE,0x00,
+0x7F,0x80,0xFF,0x00,
+0x7F,0x00,0x7F,0x00,
+0x7F,0x00,0x7F,0x00,
+0xFF,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFF,0x00,0x3F,0x80,
+0xFF,0x00,0x7F,0x80,
+0x7F,0x00,0x7F,0x80,
+0x7F,0x00,0xFF,0x00,
+0x7F,0xF7,0xFF,0x00,
+0x7F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFC,0x00,
+0x0F,0xFF,0xF8,0x00,
+0x07,0xFF,0xF0,0x00,
+0x03,0xFF,0xE0,0x00,
+0x00,0x3C,0x00,0x00,
+0x03,0xFF,0xF0,0x00,
+0x07,0xFF,0xF8,0x00,
+0x0F,0xFF,0xFC,0x00,
+0x1F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x7F,0xFF,0xFE,0x00,
+0x7F,0xE1,0xFF,0x00,
+0x7F,0x00,0xFF,0x00,
+0x7F,0x00,0x7F,0x80,
+0xFF,0x00,0x3F,0x80,
+0xFF,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFF,0x00,0x3F,0x80,
+0xFF,0x00,0x3F,0x80,
+0x7F,0x00,0x7F,0x80,
+0x7F,0xE0,0x7F,0x00,
+0x7F,0xFC,0x7F,0x00,
+0x7F,0xFC,0xFF,0x00,
+0x3F,0xF8,0xFF,0x00,
+0x1F,0xF1,0xFE,0x00,
+0x0F,0xE3,0xFE,0x00,
+0x07,0xC7,0xFC,0x00,
+0x00,0x07,0xF8,0x00,
+0x00,0x0F,0xF8,0x00,
+0x00,0x0F,0xF0,0x00,
+0x00,0x1F,0xF0,0x00,
+0x00,0x3F,0xE0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0x80,0x00,
+0x00,0xFF,0x80,0x00,
+0x01,0xFF,0x00,0x00,
+0x01,0xFE,0x00,0x00,
+0x03,0xFE,0x00,0x00,
+0x07,0xFC,0x00,0x00,
+0x07,0xFC,0x00,0x00,
+0x0F,0xF8,0x00,0x00,
+0x0F,0xF0,0x00,0x00,
+0x00,0xE3,0x80,0x00,
+0x01,0x00,0x20,0x00,
+0x02,0x00,0x10,0x00,
+0x04,0x00,0x00,0x00,
+0x08,0x00,0x08,0x00,
+0x18,0x00,0x04,0x00,
+0x10,0x00,0x04,0x00,
+0x10,0x00,0x04,0x00,
+0x10,0x00,0x04,0x00,
+0x10,0x00,0x04,0x00,
+0x10,0x00,0x04,0x00,
+0x10,0x00,0x04,0x00,
+0x08,0x00,0x04,0x00,
+0x0C,0x00,0x08,0x00,
+0x04,0x00,0x18,0x00,
+0x02,0x00,0x30,0x00,
+0x01,0x80,0x60,0x00,
+0x00,0x41,0x80,0x00,
+0x00,0x1C,0x00,0x00,
+0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,
+0x00,0x3F,0x00,0x00,
+0x01,0x80,0xE0,0x00,
+0x06,0x00,0x30,0x00,
+0x08,0x00,0x08,0x00,
+0x10,0x00,0x04,0x00,
+0x30,0x00,0x02,0x00,
+0x20,0x00,0x03,0x00,
+0x40,0x00,0x01,0x00,
+0x40,0x00,0x01,0x80,
+0x80,0x00,0x00,0x80,
+0x80,0x00,0x00,0x80,
+0x80,0x00,0x00,0x80,
+0x80,0x00,0x00,0x80,
+0x80,0x00,0x00,0x80,
+0x80,0x00,0x00,0x80,
+0x80,0x00,0x00,0x80,
+0x40,0x00,0x00,0x80,
+0x40,0x00,0x01,0x00,
+0x20,0x00,0x03,0x00,
+0x30,0x00,0x02,0x00,
+0x10,0x00,0x04,0x00,
+0x0C,0x00,0x08,0x00,
+0x06,0x00,0x10,0x00,
+0x01,0xC0,0xE0,0x00,
+0x00,0x7F,0x00,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0xFF,0xE0,0x00,
+0x01,0xFF,0xE0,0x00,
+0x01,0xFF,0xF0,0x00,
+0x01,0xFF,0xF0,0x00,
+0x01,0xFF,0xF0,0x00,
+0x01,0xFF,0xF0,0x00,
+0x03,0xFB,0xF8,0x00,
+0x03,0xF3,0xF8,0x00,
+0x03,0xF3,0xF8,0x00,
+0x03,0xF3,0xF8,0x00,
+0x07,0xF3,0xF8,0x00,
+0x07,0xF1,0xF8,0x00,
+0x07,0xF1,0xF8,0x00,
+0x07,0xF1,0xFC,0x00,
+0x07,0xE1,0xFC,0x00,
+0x07,0xE1,0xFC,0x00,
+0x07,0xE0,0xFC,0x00,
+0x0F,0xE0,0xFE,0x00,
+0x0F,0xC0,0xFE,0x00,
+0x0F,0xC0,0xFE,0x00,
+0x0F,0xC0,0x7E,0x00,
+0x0F,0xC0,0x7F,0x00,
+0x1F,0x80,0x7F,0x00,
+0x1F,0x80,0x7F,0x00,
+0x1F,0x80,0x7F,0x00,
+0x1F,0x80,0x7F,0x00,
+0x3F,0x80,0x7F,0x00,
+0x3F,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0x80,
+0x3F,0x00,0x3F,0xC0,
+0x7F,0x00,0x1F,0xC0,
+0x7E,0x00,0x1F,0xC0,
+0x7E,0x00,0x1F,0xC0,
+0x7E,0x00,0x1F,0xC0,
+0xFE,0x00,0x0F,0xE0,
+0xFC,0x00,0x0F,0xE0,
+0x7C,0x00,0x0F,0xE0,
+0x7F,0xFF,0x00,0x00,
+0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0x00,
+0xFF,0x07,0xFF,0x00,
+0xFE,0x01,0xFF,0x00,
+0xFE,0x00,0xFF,0x00,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x00,
+0xFE,0x00,0x7F,0x00,
+0xFE,0x00,0x7F,0x00,
+0xFE,0x00,0x7F,0x00,
+0xFE,0x00,0x7E,0x00,
+0xFE,0x07,0xFC,0x00,
+0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0x00,
+0xFE,0x00,0xFF,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x1F,0xC0,
+0xFE,0x00,0x1F,0xC0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x1F,0xE0,
+0xFE,0x00,0x3F,0xE0,
+0xFE,0x00,0x7F,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xF0,0x00,
+0x07,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0x80,
+0xFF,0x80,0x7F,0x80,
+0xFF,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x00,
+0xFE,0x00,0x3F,0x00,
+0xFE,0x00,0x3F,0x00,
+0xFE,0x00,0x3F,0x00,
+0xFE,0x00,0x1E,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x1F,0xE0,
+0x7F,0x00,0x3F,0xE0,
+0x7F,0x80,0x7F,0xC0,
+0x7F,0xFF,0xFF,0xC0,
+0x3F,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0x80,
+0x1F,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFE,0x00,
+0x07,0xFF,0xFC,0x00,
+0x01,0xFF,0xF0,0x00,
+0x7F,0xFF,0xF0,0x00,
+0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xC0,
+0x7F,0xE0,0x7F,0xC0,
+0x1F,0xC0,0x1F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x0F,0xE0,
+0x1F,0xC0,0x1F,0xE0,
+0x1F,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFE,0x00,
+0x7F,0xFF,0xFC,0x00,
+0x7F,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xE0,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0x07,0xFF,0xFF,0xC0,
+0x3F,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0x80,0x00,0x00,
+0xFF,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xF8,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0x07,0xFF,0xF8,0x00,
+0x1F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFF,0x00,
+0x7F,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0x80,
+0xFF,0x80,0x7F,0x80,
+0xFF,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x3F,0x80,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x07,0xFF,0xC0,
+0xFE,0x0F,0xFF,0xE0,
+0xFE,0x1F,0xFF,0xE0,
+0xFE,0x1F,0xFF,0xE0,
+0xFE,0x0F,0xFF,0xE0,
+0xFE,0x07,0xFF,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x1F,0xE0,
+0x7F,0xC0,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xEF,0xE0,
+0x1F,0xFF,0xC7,0xE0,
+0x0F,0xFF,0x03,0xE0,
+0x01,0xFC,0x00,0x00,
+0x7C,0x00,0x0F,0xC0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFF,0x00,0x1F,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0x07,0xFF,0x00,
+0x07,0xFF,0x80,
+0x07,0xFF,0x80,
+0x07,0xFF,0x80,
+0x07,0xFF,0x00,
+0x07,0xFE,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x01,0xFC,0x00,
+0x3F,0xFF,0xE0,
+0xFF,0xFF,0xF0,
+0xFF,0xFF,0xF8,
+0xFF,0xFF,0xF8,
+0xFF,0xFF,0xF8,
+0xFF,0xFF,0xF8,
+0x7F,0xFF,0xF8,
+0x00,0x3F,0xFF,0xE0,
+0x00,0x7F,0xFF,0xE0,
+0x00,0x7F,0xFF,0xE0,
+0x00,0x7F,0xFF,0xE0,
+0x00,0x7F,0xFF,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x00,0x00,0x0F,0xE0,
+0x7E,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0x7F,0x00,0x0F,0xE0,
+0x7F,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xC0,
+0x3F,0xFF,0xFF,0xC0,
+0x1F,0xFF,0xFF,0x80,
+0x0F,0xFF,0xFF,0x00,
+0x07,0xFF,0xFE,0x00,
+0x7C,0x00,0x07,0xC0,
+0xFC,0x00,0x0F,0xE0,
+0xFC,0x00,0x1F,0xC0,
+0xFC,0x00,0x1F,0xC0,
+0xFC,0x00,0x3F,0x80,
+0xFC,0x00,0x7F,0x00,
+0xFC,0x00,0x7E,0x00,
+0xFC,0x00,0xFC,0x00,
+0xFC,0x01,0xF8,0x00,
+0xFC,0x03,0xF8,0x00,
+0xFC,0x07,0xF0,0x00,
+0xFC,0x0F,0xE0,0x00,
+0xFC,0x1F,0xE0,0x00,
+0xFC,0x1F,0xC0,0x00,
+0xFC,0x3F,0xC0,0x00,
+0xFC,0x7F,0x80,0x00,
+0xFC,0x7F,0x00,0x00,
+0xFC,0xFE,0x00,0x00,
+0xFF,0xFE,0x00,0x00,
+0xFF,0xFE,0x00,0x00,
+0xFF,0xFE,0x00,0x00,
+0xFF,0xFF,0x00,0x00,
+0xFF,0xFF,0x80,0x00,
+0xFF,0xFF,0x80,0x00,
+0xFF,0xFF,0xC0,0x00,
+0xFF,0xFF,0xC0,0x00,
+0xFF,0x9F,0xE0,0x00,
+0xFF,0x1F,0xF0,0x00,
+0xFE,0x0F,0xF0,0x00,
+0xFE,0x07,0xF8,0x00,
+0xFC,0x07,0xF8,0x00,
+0xFC,0x03,0xFC,0x00,
+0xFC,0x03,0xFE,0x00,
+0xFC,0x01,0xFE,0x00,
+0xFC,0x00,0xFF,0x00,
+0xFC,0x00,0xFF,0x00,
+0xFC,0x00,0x7F,0x00,
+0xFC,0x00,0x7F,0x80,
+0xFC,0x00,0x3F,0xC0,
+0xFC,0x00,0x3F,0xE0,
+0xFC,0x00,0x1F,0xE0,
+0x7C,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x00,0x00,
+0xFE,0x00,0x0F,0xC0,
+0xFE,0x00,0x1F,0xC0,
+0xFE,0x00,0x1F,0xC0,
+0xFE,0x00,0x1F,0xC0,
+0xFE,0x00,0x1F,0xC0,
+0xFE,0x00,0x1F,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0x80,
+0x7C,0x00,0x07,0xC0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFF,0x00,0x1F,0xE0,
+0xFF,0x00,0x1F,0xE0,
+0xFF,0x80,0x3F,0xE0,
+0xFF,0x80,0x3F,0xE0,
+0xFF,0x80,0x7F,0xE0,
+0xFF,0xC0,0x7F,0xE0,
+0xFF,0xC0,0x7F,0xE0,
+0xFF,0xE0,0xFF,0xE0,
+0xFF,0xE0,0xFF,0xE0,
+0xFF,0xF1,0xFF,0xE0,
+0xFF,0xF1,0xFF,0xE0,
+0xFF,0xF1,0xFF,0xE0,
+0xFE,0xFB,0xEF,0xE0,
+0xFE,0xFF,0xEF,0xE0,
+0xFE,0x7F,0xCF,0xE0,
+0xFE,0x7F,0xCF,0xE0,
+0xFE,0x3F,0x8F,0xE0,
+0xFE,0x3F,0x8F,0xE0,
+0xFE,0x1F,0x0F,0xE0,
+0xFE,0x1F,0x0F,0xE0,
+0xFE,0x1E,0x0F,0xE0,
+0xFE,0x0E,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0x7C,0x00,0x07,0xC0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x80,0x0F,0xE0,
+0xFF,0x80,0x0F,0xE0,
+0xFF,0xC0,0x0F,0xE0,
+0xFF,0xC0,0x0F,0xE0,
+0xFF,0xE0,0x0F,0xE0,
+0xFF,0xF0,0x0F,0xE0,
+0xFF,0xF0,0x0F,0xE0,
+0xFF,0xF0,0x0F,0xE0,
+0xFF,0xF8,0x0F,0xE0,
+0xFF,0xFC,0x0F,0xE0,
+0xFF,0xFE,0x0F,0xE0,
+0xFF,0xFE,0x0F,0xE0,
+0xFC,0xFE,0x0F,0xE0,
+0xFC,0xFF,0x0F,0xE0,
+0xFC,0x7F,0x0F,0xE0,
+0xFC,0x7F,0x8F,0xE0,
+0xFC,0x3F,0xCF,0xE0,
+0xFC,0x1F,0xCF,0xE0,
+0xFC,0x1F,0xEF,0xE0,
+0xFC,0x0F,0xEF,0xE0,
+0xFC,0x0F,0xFF,0xE0,
+0xFC,0x07,0xFF,0xE0,
+0xFC,0x03,0xFF,0xE0,
+0xFC,0x03,0xFF,0xE0,
+0xFC,0x03,0xFF,0xE0,
+0xFC,0x01,0xFF,0xE0,
+0xFC,0x00,0xFF,0xE0,
+0xFC,0x00,0xFF,0xE0,
+0xFC,0x00,0x7F,0xE0,
+0xFC,0x00,0x7F,0xE0,
+0xFC,0x00,0x3F,0xE0,
+0xFC,0x00,0x3F,0xE0,
+0xFC,0x00,0x1F,0xE0,
+0xFC,0x00,0x0F,0xE0,
+0xFC,0x00,0x0F,0xE0,
+0xFC,0x00,0x0F,0xE0,
+0x00,0x1E,0x00,0x00,
+0x00,0xFF,0xE0,0x00,
+0x01,0xFF,0xF0,0x00,
+0x03,0xFF,0xF8,0x00,
+0x07,0xFF,0xFC,0x00,
+0x07,0xFF,0xFC,0x00,
+0x0F,0xF1,0xFE,0x00,
+0x0F,0xC0,0xFF,0x00,
+0x1F,0xC0,0x7F,0x00,
+0x3F,0x80,0x7F,0x00,
+0x3F,0x80,0x3F,0x80,
+0x3F,0x80,0x3F,0x80,
+0x3F,0x00,0x3F,0x80,
+0x7F,0x00,0x1F,0xC0,
+0x7F,0x00,0x1F,0xC0,
+0x7F,0x00,0x1F,0xC0,
+0x7F,0x00,0x1F,0xC0,
+0x7F,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0x7F,0x00,0x1F,0xE0,
+0x7F,0x00,0x1F,0xC0,
+0x7F,0x80,0x3F,0xC0,
+0x7F,0x80,0x7F,0xC0,
+0x3F,0xC0,0xFF,0x80,
+0x3F,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFE,0x00,
+0x07,0xFF,0xFC,0x00,
+0x03,0xFF,0xF8,0x00,
+0x00,0x7F,0xC0,0x00,
+0x7F,0xFF,0xC0,0x00,
+0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0x00,
+0x3F,0xC3,0xFF,0x80,
+0x3F,0x80,0x7F,0x80,
+0x3F,0x80,0x3F,0xC0,
+0x3F,0x80,0x1F,0xC0,
+0x3F,0x80,0x1F,0xE0,
+0x3F,0x80,0x0F,0xE0,
+0x3F,0x80,0x0F,0xE0,
+0x3F,0x80,0x0F,0xE0,
+0x3F,0x80,0x0F,0xE0,
+0x3F,0x80,0x0F,0xE0,
+0x3F,0x80,0x0F,0xE0,
+0x3F,0x80,0x1F,0xE0,
+0x3F,0x80,0x1F,0xE0,
+0x3F,0x80,0x3F,0xC0,
+0x3F,0x80,0x3F,0xC0,
+0x3F,0x80,0x7F,0x80,
+0x3F,0x80,0xFF,0x80,
+0x3F,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFC,0x00,
+0x3F,0xFF,0xE0,0x00,
+0x3F,0xC0,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x00,0x1F,0x00,0x00,
+0x03,0xFF,0xFC,0x00,
+0x0F,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0x80,
+0x7F,0xF3,0xFF,0xC0,
+0x7F,0xC0,0x3F,0xC0,
+0x7F,0x00,0x1F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x1F,0x0F,0xE0,
+0xFE,0x3F,0x8F,0xE0,
+0xFE,0x1F,0x8F,0xC0,
+0xFE,0x1F,0xCF,0xC0,
+0xFE,0x0F,0xEF,0x80,
+0xFE,0x07,0xFF,0x80,
+0xFE,0x07,0xFF,0x00,
+0x7F,0x03,0xFF,0x00,
+0x7F,0x01,0xFE,0x00,
+0x7F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0x80,
+0x0F,0xFF,0xFF,0xC0,
+0x03,0xFF,0xFF,0xE0,
+0x01,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0xFF,0x00,
+0xFE,0x7F,0xFE,0x00,
+0xFE,0xFF,0xFC,0x00,
+0xFE,0xFF,0xF8,0x00,
+0xFE,0xFF,0xC0,0x00,
+0xFE,0xFF,0x80,0x00,
+0xFE,0xFF,0x00,0x00,
+0xFE,0xFF,0x80,0x00,
+0xFE,0x7F,0x80,0x00,
+0xFE,0x3F,0xC0,0x00,
+0xFE,0x1F,0xC0,0x00,
+0xFE,0x1F,0xE0,0x00,
+0xFE,0x0F,0xE0,0x00,
+0xFE,0x0F,0xF0,0x00,
+0xFE,0x07,0xF8,0x00,
+0xFE,0x03,0xF8,0x00,
+0xFE,0x03,0xFC,0x00,
+0xFE,0x01,0xFE,0x00,
+0xFE,0x00,0xFE,0x00,
+0xFE,0x00,0xFF,0x00,
+0xFE,0x00,0x7F,0x00,
+0xFE,0x00,0x7F,0x80,
+0xFE,0x00,0x3F,0xC0,
+0xFE,0x00,0x3F,0xE0,
+0xFE,0x00,0x1F,0xE0,
+0x00,0x1F,0xC0,0x00,
+0x01,0xFF,0xFC,0x00,
+0x03,0xFF,0xFE,0x00,
+0x07,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFF,0x80,
+0x1F,0xF8,0xFF,0xC0,
+0x3F,0xE0,0x3F,0xC0,
+0x3F,0xC0,0x1F,0xC0,
+0x3F,0x80,0x0F,0xC0,
+0x3F,0x80,0x0F,0xC0,
+0x3F,0x80,0x0F,0xC0,
+0x3F,0x80,0x00,0x00,
+0x3F,0x80,0x00,0x00,
+0x3F,0xC0,0x00,0x00,
+0x3F,0xF0,0x00,0x00,
+0x1F,0xF8,0x00,0x00,
+0x0F,0xFE,0x00,0x00,
+0x07,0xFF,0x00,0x00,
+0x07,0xFF,0xC0,0x00,
+0x03,0xFF,0xE0,0x00,
+0x00,0xFF,0xF0,0x00,
+0x00,0x7F,0xF8,0x00,
+0x00,0x3F,0xFE,0x00,
+0x00,0x0F,0xFF,0x00,
+0x00,0x07,0xFF,0x00,
+0x00,0x01,0xFF,0x80,
+0x00,0x00,0x7F,0xC0,
+0x00,0x00,0x3F,0xC0,
+0x00,0x00,0x1F,0xE0,
+0x00,0x00,0x1F,0xE0,
+0x7C,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x80,0x1F,0xC0,
+0x7F,0xF1,0xFF,0xC0,
+0x7F,0xFF,0xFF,0xC0,
+0x3F,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFE,0x00,
+0x0F,0xFF,0xF8,0x00,
+0x00,0xFF,0xC0,0x00,
+0x7F,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xC0,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x80,0x00,
+0x00,0x3F,0x00,0x00,
+0x7E,0x00,0x0F,0xC0,
+0x7F,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x0F,0xE0,
+0xFF,0x00,0x1F,0xE0,
+0xFF,0x00,0x1F,0xE0,
+0x7F,0x00,0x1F,0xE0,
+0x7F,0x00,0x3F,0xE0,
+0x7F,0x80,0x7F,0xE0,
+0x7F,0xE3,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xE0,
+0x1F,0xFF,0xCF,0xE0,
+0x1F,0xFF,0x8F,0xE0,
+0x0F,0xFF,0x0F,0xE0,
+0x01,0xF8,0x00,0x00,
+0x7C,0x00,0x07,0xC0,
+0xFE,0x00,0x07,0xE0,
+0xFE,0x00,0x0F,0xE0,
+0xFE,0x00,0x0F,0xC0,
+0x7E,0x00,0x0F,0xC0,
+0x7F,0x00,0x0F,0xC0,
+0x7F,0x00,0x0F,0xC0,
+0x7F,0x00,0x0F,0x80,
+0x3F,0x00,0x1F,0x80,
+0x3F,0x80,0x1F,0x80,
+0x3F,0x80,0x1F,0x80,
+0x3F,0x80,0x1F,0x00,
+0x3F,0x80,0x3F,0x00,
+0x3F,0x80,0x3F,0x00,
+0x3F,0x80,0x3F,0x00,
+0x1F,0x80,0x7F,0x00,
+0x1F,0xC0,0x7E,0x00,
+0x1F,0xC0,0x7E,0x00,
+0x1F,0xC0,0x7E,0x00,
+0x1F,0xC0,0x7E,0x00,
+0x0F,0xE0,0x7C,0x00,
+0x0F,0xE0,0x7C,0x00,
+0x0F,0xE0,0xFC,0x00,
+0x0F,0xE0,0xF8,0x00,
+0x07,0xF0,0xF8,0x00,
+0x07,0xF0,0xF8,0x00,
+0x07,0xF1,0xF8,0x00,
+0x07,0xF1,0xF8,0x00,
+0x07,0xF1,0xF8,0x00,
+0x07,0xF1,0xF8,0x00,
+0x07,0xF3,0xF0,0x00,
+0x07,0xF3,0xF0,0x00,
+0x03,0xFB,0xF0,0x00,
+0x03,0xFF,0xE0,0x00,
+0x03,0xFF,0xE0,0x00,
+0x03,0xFF,0xE0,0x00,
+0x01,0xFF,0xC0,0x00,
+0x01,0xFF,0xC0,0x00,
+0x01,0xFF,0xC0,0x00,
+0x00,0xFF,0x80,0x00,
+0x00,0xFF,0x00,0x00,
+0xFC,0x00,0x07,0x80,
+0xFC,0x00,0x0F,0xC0,
+0xFE,0x00,0x0F,0xC0,
+0xFE,0x00,0x0F,0x80,
+0xFE,0x00,0x1F,0x80,
+0xFE,0x00,0x1F,0x80,
+0xFE,0x00,0x1F,0x80,
+0xFE,0x00,0x1F,0x80,
+0xFE,0x00,0x1F,0x80,
+0xFE,0x00,0x1F,0x80,
+0x7E,0x00,0x1F,0x00,
+0x7E,0x00,0x1F,0x00,
+0x7E,0x00,0x1F,0x00,
+0x7E,0x00,0x1F,0x00,
+0x7E,0x00,0x1F,0x00,
+0x7F,0x00,0x1F,0x00,
+0x7F,0x0C,0x3F,0x00,
+0x7F,0x1C,0x3E,0x00,
+0x7F,0x3C,0x3E,0x00,
+0x7F,0x3E,0x3E,0x00,
+0x7F,0x3E,0x3E,0x00,
+0x7F,0x3E,0x3E,0x00,
+0x7F,0x3E,0x7E,0x00,
+0x7F,0x3E,0x7E,0x00,
+0x7F,0x3E,0x7E,0x00,
+0x3F,0x7E,0x7E,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFC,0x00,
+0x3F,0xE7,0xFC,0x00,
+0x3F,0xE3,0xFC,0x00,
+0x3F,0xE3,0xFC,0x00,
+0x1F,0xE3,0xFC,0x00,
+0x1F,0xC1,0xFC,0x00,
+0x1F,0xC1,0xFC,0x00,
+0x1F,0xC1,0xF8,0x00,
+0x1F,0x80,0xF8,0x00,
+0x1F,0x80,0xF8,0x00,
+0x1F,0x80,0xF8,0x00,
+0x3F,0x00,0x07,0xC0,
+0x3F,0x00,0x0F,0xC0,
+0x3F,0x80,0x0F,0xC0,
+0x3F,0x80,0x1F,0x80,
+0x1F,0xC0,0x1F,0x80,
+0x1F,0xC0,0x3F,0x00,
+0x1F,0xE0,0x7F,0x00,
+0x0F,0xE0,0x7F,0x00,
+0x07,0xE0,0x7E,0x00,
+0x07,0xF0,0xFE,0x00,
+0x07,0xF0,0xFC,0x00,
+0x07,0xF9,0xFC,0x00,
+0x03,0xFB,0xF8,0x00,
+0x01,0xFF,0xF8,0x00,
+0x01,0xFF,0xF8,0x00,
+0x01,0xFF,0xF0,0x00,
+0x00,0xFF,0xE0,0x00,
+0x00,0xFF,0xE0,0x00,
+0x00,0xFF,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0xFF,0xE0,0x00,
+0x00,0xFF,0xE0,0x00,
+0x00,0xFF,0xF0,0x00,
+0x01,0xFF,0xF0,0x00,
+0x01,0xFF,0xF8,0x00,
+0x03,0xFB,0xF8,0x00,
+0x03,0xF3,0xF8,0x00,
+0x07,0xF3,0xFC,0x00,
+0x07,0xF1,0xFC,0x00,
+0x07,0xE1,0xFE,0x00,
+0x0F,0xC0,0xFE,0x00,
+0x0F,0xC0,0x7F,0x00,
+0x1F,0x80,0x7F,0x00,
+0x1F,0x80,0x7F,0x00,
+0x3F,0x80,0x7F,0x80,
+0x3F,0x00,0x3F,0x80,
+0x7F,0x00,0x3F,0xC0,
+0x7E,0x00,0x1F,0xC0,
+0x7E,0x00,0x1F,0xE0,
+0xFC,0x00,0x0F,0xE0,
+0x7C,0x00,0x03,0xC0,
+0xFE,0x00,0x07,0xE0,
+0x7F,0x00,0x0F,0xE0,
+0x7F,0x00,0x0F,0xC0,
+0x7F,0x00,0x0F,0xC0,
+0x3F,0x80,0x0F,0xC0,
+0x3F,0x80,0x1F,0x80,
+0x3F,0x80,0x1F,0x80,
+0x3F,0x80,0x3F,0x00,
+0x1F,0xC0,0x3F,0x00,
+0x1F,0xC0,0x3F,0x00,
+0x1F,0xC0,0x7F,0x00,
+0x0F,0xE0,0x7E,0x00,
+0x0F,0xE0,0x7E,0x00,
+0x07,0xE0,0x7E,0x00,
+0x07,0xF0,0xFC,0x00,
+0x07,0xF0,0xFC,0x00,
+0x07,0xF1,0xF8,0x00,
+0x03,0xF1,0xF8,0x00,
+0x03,0xF9,0xF8,0x00,
+0x03,0xFB,0xF8,0x00,
+0x01,0xFF,0xF0,0x00,
+0x01,0xFF,0xF0,0x00,
+0x00,0xFF,0xF0,0x00,
+0x00,0xFF,0xE0,0x00,
+0x00,0x7F,0xE0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0x80,0x00,
+0x7F,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0x00,0x00,0x7F,0xC0,
+0x00,0x00,0x3F,0xC0,
+0x00,0x00,0x7F,0x80,
+0x00,0x00,0x7F,0x00,
+0x00,0x00,0xFF,0x00,
+0x00,0x01,0xFE,0x00,
+0x00,0x01,0xFE,0x00,
+0x00,0x03,0xFC,0x00,
+0x00,0x07,0xF8,0x00,
+0x00,0x0F,0xF8,0x00,
+0x00,0x0F,0xF0,0x00,
+0x00,0x1F,0xE0,0x00,
+0x00,0x1F,0xE0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x3F,0xC0,0x00,
+0x00,0x7F,0x80,0x00,
+0x00,0xFF,0x80,0x00,
+0x01,0xFF,0x00,0x00,
+0x01,0xFE,0x00,0x00,
+0x03,0xFC,0x00,0x00,
+0x03,0xFC,0x00,0x00,
+0x07,0xF8,0x00,0x00,
+0x07,0xF0,0x00,0x00,
+0x0F,0xF0,0x00,0x00,
+0x1F,0xF0,0x00,0x00,
+0x3F,0xE0,0x00,0x00,
+0x3F,0xC0,0x00,0x00,
+0x7F,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+};
+
+static const sGLYPH PackedEuroFont7248_Glyphs[] = {
+    {0, 0, 0, 0, 0, 12},
+    {0, 1, 19, 28, 7, 30},
+    {28, 1, 3, 25, 41, 27},
+    {192, 1, 3, 25, 41, 27},
+    {356, 1, 3, 25, 41, 27},
+    {520, 1, 4, 24, 41, 26},
+    {643, 1, 3, 25, 41, 27},
+    {807, 1, 4, 24, 41, 26},
+    {930, 1, 3, 25, 41, 27},
+    {1094, 1, 4, 24, 41, 26},
+    {1217, 1, 3, 25, 41, 27},
+    {1381, 1, 3, 25, 41, 27},
+    {1545, 1, 1, 25, 47, 27},
+    {1733, 1, 3, 27, 41, 29},
+    {1897, 1, 3, 27, 41, 29},
+    {2061, 1, 3, 27, 41, 29},
+    {2225, 1, 3, 27, 41, 29},
+    {2389, 1, 3, 26, 41, 28},
+    {2553, 1, 3, 27, 41, 29},
+    {2717, 1, 3, 27, 42, 29},
+    {2885, 1, 3, 27, 41, 29},
+    {3049, 1, 3, 21, 41, 23},
+    {3172, 1, 3, 27, 41, 29},
+    {3336, 1, 3, 27, 41, 29},
+    {3500, 1, 3, 26, 41, 28},
+    {3664, 1, 3, 27, 41, 29},
+    {3828, 1, 3, 27, 41, 29},
+    {3992, 1, 3, 27, 42, 29},
+    {4160, 1, 3, 27, 41, 29},
+    {4324, 1, 3, 27, 41, 29},
+    {4488, 1, 3, 27, 41, 29},
+    {4652, 1, 3, 27, 42, 29},
+    {4820, 1, 3, 27, 41, 29},
+    {4984, 1, 3, 27, 42, 29},
+    {5152, 1, 3, 27, 41, 29},
+    {5316, 1, 3, 26, 41, 28},
+    {5480, 1, 3, 27, 41, 29},
+    {5644, 1, 3, 27, 41, 29},
+    {5808, 1, 3, 27, 41, 29},
+};
+
+static const uint8_t PackedEuroFont7248_Codes[] = {
+    ' ', '-', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'
+};
+
+static const uint8_t PackedEuroFont7248_Index[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38
+};
+
+sFONT PackedEuroFont7248 = {
+ PackedEuroFont7248_Table,
+ 72, // width 
+ 48, // Height
+ PackedEuroFont7248_Glyphs,
+ PackedEuroFont7248_Codes,
+ PackedEuroFont7248_Index,
+ 39  // characters
+};
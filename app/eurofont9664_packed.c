@@ -0,0 +1,2185 @@
+#include "fonts.h"
+
+// Font 96x64, 40 characters " !-0123456789:ABCDEFGHIJKLMNOPQRSTUVWXYZ", 40 glyphs in 10307 bytes, 45312 bytes unpacked
+// Generated with tools/pack_font.py from EPD_4R2/Fonts/EuroFont9664.c, do not edit
+static const uint8_t PackedEuroFont9664_Table[] = {
+0x7F,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFD,0xFF,0xF8,
+0xFF,0xFD,0xFF,0xF8,
+0xFF,0x9F,0xEF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFD,0xFF,0xFD,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFB,0xFF,0xFE,0x78,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFD,0xFF,0xFF,0xF8,
+0xFD,0xFF,0xFD,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0x9F,0xEF,0xF8,
+0xFF,0xFD,0xFF,0xF8,
+0xFF,0xFD,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xE0,0x7F,0xF8,
+0xFF,0xE0,0x3F,0xF8,
+0xFF,0xEF,0x9F,0xF8,
+0xFF,0xEF,0x9F,0xF8,
+0xFF,0xEF,0xDF,0xF8,
+0xFF,0xEF,0xDF,0xF8,
+0xFF,0xEF,0xDF,0xF8,
+0xFF,0xEF,0xDF,0xF8,
+0xFF,0xEF,0xDF,0xF8,
+0xFF,0xEF,0x9F,0xF8,
+0xFF,0xEF,0x1F,0xF8,
+0xFF,0xE0,0x3F,0xF8,
+0xFF,0xE1,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0x7F,0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xFF,0xF8,
+0x00,0xFF,0xFF,0x80,0x00,
+0x07,0xFF,0xFF,0xF8,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x1F,0xFF,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFF,0xFF,0x00,
+0x7F,0xFF,0xFF,0xFF,0x00,
+0x7F,0xFF,0xFF,0xFF,0x80,
+0xFF,0xE0,0x03,0xFF,0x00,
+0xFF,0x80,0x00,0xFE,0x00,
+0xFF,0x80,0x00,0xFC,0x00,
+0xFF,0x80,0x00,0xF8,0x00,
+0xFF,0x80,0x00,0xF0,0x80,
+0xFF,0x80,0x00,0xE1,0x80,
+0xFF,0x80,0x00,0x07,0x80,
+0xFF,0x80,0x00,0x0F,0x80,
+0xFF,0x80,0x00,0x1F,0x80,
+0xFF,0x80,0x00,0x3F,0x80,
+0xFF,0x80,0x00,0x7F,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0xE0,0x01,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x07,0xFF,0xFF,0xF0,0x00,
+0x00,0x03,0xFE,0x00,0x00,
+0x00,0x0F,0xFF,0x00,0x00,
+0x00,0x1F,0xFF,0x00,0x00,
+0x00,0x3F,0xFF,0x00,0x00,
+0x00,0x7F,0xFF,0x00,0x00,
+0x00,0xFF,0xFF,0x00,0x00,
+0x01,0xFF,0xFF,0x00,0x00,
+0x03,0xFF,0xFF,0x00,0x00,
+0x07,0xFF,0xFF,0x00,0x00,
+0x0F,0xFF,0xFF,0x00,0x00,
+0x7F,0xFF,0xFF,0x00,0x00,
+0xFF,0xFF,0xFF,0x00,0x00,
+0xFF,0xF9,0xFF,0x00,0x00,
+0xFF,0xF1,0xFF,0x00,0x00,
+0xFF,0xE1,0xFF,0x00,0x00,
+0xFF,0xC1,0xFF,0x00,0x00,
+0xFF,0x81,0xFF,0x00,0x00,
+0xFF,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x07,0xFF,0x80,0x00,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x3F,0xFF,0xC0,0x00,
+0x00,0xFF,0xFF,0xF0,0x00,
+0x03,0xFF,0xFF,0xF8,0x00,
+0x07,0xFF,0xFF,0xFC,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFF,0x80,
+0x1F,0xFC,0x07,0xFF,0x80,
+0x1F,0xF8,0x01,0xFF,0x80,
+0x3F,0xF0,0x00,0xFF,0x80,
+0x3F,0xF0,0x00,0xFF,0x80,
+0x3F,0xF0,0x00,0xFF,0x80,
+0x3F,0xE0,0x00,0xFF,0x80,
+0x1F,0xE0,0x00,0xFF,0x80,
+0x00,0x00,0x00,0xFF,0x80,
+0x00,0x00,0x01,0xFF,0x80,
+0x00,0x00,0x01,0xFF,0x00,
+0x00,0x00,0x01,0xFF,0x00,
+0x00,0x00,0x03,0xFF,0x00,
+0x00,0x00,0x07,0xFE,0x00,
+0x00,0x00,0x07,0xFE,0x00,
+0x00,0x00,0x0F,0xFE,0x00,
+0x00,0x00,0x1F,0xFC,0x00,
+0x00,0x00,0x1F,0xFC,0x00,
+0x00,0x00,0x3F,0xF8,0x00,
+0x00,0x00,0x7F,0xF0,0x00,
+0x00,0x00,0xFF,0xF0,0x00,
+0x00,0x01,0xFF,0xE0,0x00,
+0x00,0x03,0xFF,0xC0,0x00,
+0x00,0x07,0xFF,0x80,0x00,
+0x00,0x0F,0xFF,0x00,0x00,
+0x00,0x1F,0xFE,0x00,0x00,
+0x00,0x3F,0xFC,0x00,0x00,
+0x00,0x7F,0xF8,0x00,0x00,
+0x00,0xFF,0xF0,0x00,0x00,
+0x01,0xFF,0xE0,0x00,0x00,
+0x03,0xFF,0xC0,0x00,0x00,
+0x07,0xFF,0x80,0x00,0x00,
+0x0F,0xFF,0x00,0x00,0x00,
+0x1F,0xFE,0x00,0x00,0x00,
+0x3F,0xFC,0x00,0x00,0x00,
+0x7F,0xF8,0x00,0x00,0x00,
+0x7F,0xF8,0x00,0x00,0x00,
+0xFF,0xF0,0x00,0x00,0x00,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0xFF,
+0x3F,0xFF,0xFF,0xFF,
+0x3F,0xFF,0xFF,0xFF,
+0x3F,0xFF,0xFF,0xFF,
+0x3F,0xFF,0xFF,0xFF,
+0x3F,0xFF,0xFF,0xFF,
+0x3F,0xFF,0xFF,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x03,0xFF,
+0x00,0x00,0x07,0xFF,
+0x00,0x00,0x0F,0xFE,
+0x00,0x00,0x1F,0xFC,
+0x00,0x00,0x3F,0xF8,
+0x00,0x00,0x7F,0xF0,
+0x00,0x00,0xFF,0xE0,
+0x00,0x01,0xFF,0xC0,
+0x00,0x03,0xFF,0x80,
+0x00,0x07,0xFF,0x00,
+0x00,0x0F,0xFE,0x00,
+0x00,0x1F,0xFC,0x00,
+0x00,0x1F,0xFC,0x00,
+0x00,0x1F,0xFE,0x00,
+0x00,0x1F,0xFF,0xF0,
+0x00,0x1F,0xFF,0xF8,
+0x00,0x1F,0xFF,0xFC,
+0x00,0x1F,0xFF,0xFE,
+0x00,0x0F,0xFF,0xFF,
+0x00,0x00,0x03,0xFF,
+0x00,0x00,0x03,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0xFF,0x00,0x01,0xFF,
+0xFF,0x80,0x01,0xFF,
+0xFF,0x80,0x01,0xFF,
+0xFF,0x80,0x01,0xFF,
+0xFF,0x80,0x03,0xFF,
+0xFF,0x80,0x03,0xFF,
+0xFF,0xC0,0x07,0xFF,
+0xFF,0xF0,0x3F,0xFE,
+0x7F,0xFF,0xFF,0xFE,
+0x7F,0xFF,0xFF,0xFC,
+0x7F,0xFF,0xFF,0xFC,
+0x3F,0xFF,0xFF,0xF8,
+0x1F,0xFF,0xFF,0xF0,
+0x0F,0xFF,0xFF,0xE0,
+0x07,0xFF,0xFF,0xC0,
+0x01,0xFF,0xFF,0x00,
+0x00,0x1F,0xF0,0x00,
+0x00,0x00,0x07,0xF0,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x1F,0xF8,0x00,
+0x00,0x00,0x1F,0xF0,0x00,
+0x00,0x00,0x3F,0xF0,0x00,
+0x00,0x00,0x3F,0xE0,0x00,
+0x00,0x00,0x7F,0xC0,0x00,
+0x00,0x00,0xFF,0xC0,0x00,
+0x00,0x00,0xFF,0x80,0x00,
+0x00,0x01,0xFF,0x80,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x03,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x0F,0xFC,0x00,0x00,
+0x00,0x0F,0xF8,0x00,0x00,
+0x00,0x1F,0xF8,0x00,0x00,
+0x00,0x3F,0xF0,0x00,0x00,
+0x00,0x3F,0xE0,0x00,0x00,
+0x00,0x7F,0xE0,0x00,0x00,
+0x00,0x7F,0xC0,0x00,0x00,
+0x00,0xFF,0xC0,0x00,0x00,
+0x01,0xFF,0x80,0x00,0x00,
+0x01,0xFF,0x00,0x00,0x00,
+0x03,0xFF,0x00,0x00,0x00,
+0x03,0xFE,0x00,0x00,0x00,
+0x07,0xFE,0x0F,0xF8,0x00,
+0x0F,0xFC,0x0F,0xF8,0x00,
+0x0F,0xF8,0x0F,0xF8,0x00,
+0x1F,0xF8,0x0F,0xF8,0x00,
+0x1F,0xF0,0x0F,0xF8,0x00,
+0x3F,0xF0,0x0F,0xF8,0x00,
+0x7F,0xE0,0x0F,0xF8,0x00,
+0x7F,0xC0,0x0F,0xF8,0x00,
+0x7F,0xC0,0x0F,0xF8,0x00,
+0xFF,0x80,0x0F,0xF8,0x00,
+0xFF,0xC0,0x0F,0xF8,0x00,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0xFF,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0x00,0x00,0x0F,0xF8,0x00,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0x00,0x00,
+0xFF,0x80,0xFE,0x00,
+0xFF,0x87,0xFF,0xC0,
+0xFF,0x9F,0xFF,0xF0,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xFC,
+0xFF,0xFF,0xFF,0xFC,
+0xFF,0xFF,0xFF,0xFE,
+0xFF,0xFC,0x1F,0xFE,
+0xFF,0xF0,0x07,0xFF,
+0x00,0x00,0x03,0xFF,
+0x00,0x00,0x03,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0x00,0x00,0x01,0xFF,
+0xFF,0x80,0x01,0xFF,
+0xFF,0x80,0x03,0xFF,
+0xFF,0x80,0x03,0xFF,
+0xFF,0x80,0x07,0xFF,
+0xFF,0xE0,0x3F,0xFE,
+0xFF,0xFF,0xFF,0xFE,
+0xFF,0xFF,0xFF,0xFC,
+0xFF,0xFF,0xFF,0xFC,
+0x7F,0xFF,0xFF,0xF8,
+0x7F,0xFF,0xFF,0xF0,
+0x3F,0xFF,0xFF,0xE0,
+0x1F,0xFF,0xFF,0xC0,
+0x07,0xFF,0xFF,0x00,
+0x00,0xFF,0xE0,0x00,
+0x00,0x00,0x7E,0x00,0x00,
+0x00,0x01,0xFF,0x00,0x00,
+0x00,0x03,0xFF,0x00,0x00,
+0x00,0x03,0xFF,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x0F,0xFE,0x00,0x00,
+0x00,0x0F,0xFC,0x00,0x00,
+0x00,0x1F,0xF8,0x00,0x00,
+0x00,0x3F,0xF8,0x00,0x00,
+0x00,0x3F,0xF0,0x00,0x00,
+0x00,0x7F,0xF0,0x00,0x00,
+0x00,0x7F,0xE0,0x00,0x00,
+0x00,0xFF,0xC0,0x00,0x00,
+0x01,0xFF,0xC0,0x00,0x00,
+0x01,0xFF,0x80,0x00,0x00,
+0x03,0xFF,0x80,0x00,0x00,
+0x03,0xFF,0x00,0x00,0x00,
+0x07,0xFE,0x00,0x00,0x00,
+0x07,0xFE,0x00,0x00,0x00,
+0x0F,0xFC,0x00,0x00,0x00,
+0x0F,0xFD,0xFF,0x80,0x00,
+0x0F,0xFF,0xFF,0xE0,0x00,
+0x1F,0xFF,0xFF,0xF8,0x00,
+0x1F,0xFF,0xFF,0xFC,0x00,
+0x3F,0xFF,0xFF,0xFC,0x00,
+0x3F,0xFF,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFF,0xFF,0x00,
+0x3F,0xFF,0x3F,0xFF,0x00,
+0x7F,0xF0,0x03,0xFF,0x00,
+0x7F,0xE0,0x03,0xFF,0x00,
+0x7F,0xC0,0x01,0xFF,0x80,
+0x7F,0xC0,0x01,0xFF,0x80,
+0x7F,0xC0,0x01,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0x7F,0xC0,0x01,0xFF,0x80,
+0x7F,0xC0,0x01,0xFF,0x00,
+0x7F,0xE0,0x03,0xFF,0x00,
+0x3F,0xF0,0x03,0xFF,0x00,
+0x3F,0xF8,0x07,0xFE,0x00,
+0x3F,0xFF,0x7F,0xFE,0x00,
+0x1F,0xFF,0xFF,0xFC,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x0F,0xFF,0xFF,0xF8,0x00,
+0x07,0xFF,0xFF,0xF0,0x00,
+0x03,0xFF,0xFF,0xE0,0x00,
+0x01,0xFF,0xFF,0xC0,0x00,
+0x00,0x7F,0xFF,0x80,0x00,
+0x00,0x1F,0xFC,0x00,0x00,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0xFF,0xFF,0xFF,
+0xFF,0x80,0x07,0xFF,
+0xFF,0x80,0x03,0xFF,
+0xFF,0x80,0x07,0xFF,
+0xFF,0x80,0x07,0xFF,
+0xFF,0x80,0x0F,0xFE,
+0xFF,0x80,0x0F,0xFE,
+0x00,0x00,0x1F,0xFC,
+0x00,0x00,0x1F,0xF8,
+0x00,0x00,0x3F,0xF8,
+0x00,0x00,0x3F,0xF0,
+0x00,0x00,0x7F,0xF0,
+0x00,0x00,0x7F,0xE0,
+0x00,0x00,0xFF,0xE0,
+0x00,0x00,0xFF,0xC0,
+0x00,0x01,0xFF,0xC0,
+0x00,0x01,0xFF,0x80,
+0x00,0x03,0xFF,0x80,
+0x00,0x07,0xFF,0x00,
+0x00,0x07,0xFE,0x00,
+0x00,0x0F,0xFE,0x00,
+0x00,0x0F,0xFC,0x00,
+0x00,0x1F,0xFC,0x00,
+0x00,0x1F,0xF8,0x00,
+0x00,0x3F,0xF8,0x00,
+0x00,0x3F,0xF0,0x00,
+0x00,0x7F,0xF0,0x00,
+0x00,0x7F,0xE0,0x00,
+0x00,0xFF,0xE0,0x00,
+0x00,0xFF,0xC0,0x00,
+0x01,0xFF,0x80,0x00,
+0x03,0xFF,0x80,0x00,
+0x03,0xFF,0x80,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x03,0xFF,0x00,0x00,
+0x01,0xFE,0x00,0x00,
+0x00,0x03,0xE0,0x00,0x00,
+0x00,0x7F,0xFF,0x00,0x00,
+0x01,0xFF,0xFF,0xC0,0x00,
+0x03,0xFF,0xFF,0xF0,0x00,
+0x07,0xFF,0xFF,0xF8,0x00,
+0x0F,0xFF,0xFF,0xF8,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x1F,0xFF,0x7F,0xFC,0x00,
+0x1F,0xF8,0x0F,0xFC,0x00,
+0x1F,0xF0,0x07,0xFE,0x00,
+0x1F,0xF0,0x07,0xFE,0x00,
+0x1F,0xF0,0x03,0xFE,0x00,
+0x3F,0xF0,0x03,0xFE,0x00,
+0x3F,0xF0,0x03,0xFE,0x00,
+0x3F,0xF0,0x03,0xFE,0x00,
+0x3F,0xF0,0x03,0xFE,0x00,
+0x1F,0xF0,0x03,0xFE,0x00,
+0x1F,0xF0,0x07,0xFE,0x00,
+0x1F,0xF0,0x07,0xFC,0x00,
+0x1F,0xF8,0x0F,0xFC,0x00,
+0x0F,0xFC,0x1F,0xF8,0x00,
+0x0F,0xFF,0xFF,0xF8,0x00,
+0x07,0xFF,0xFF,0xF0,0x00,
+0x03,0xFF,0xFF,0xE0,0x00,
+0x03,0xFF,0xFF,0xE0,0x00,
+0x03,0xFF,0xFF,0xF0,0x00,
+0x07,0xFF,0xFF,0xF8,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x1F,0xFC,0x1F,0xFE,0x00,
+0x3F,0xF0,0x07,0xFE,0x00,
+0x3F,0xE0,0x03,0xFF,0x00,
+0x7F,0xE0,0x01,0xFF,0x00,
+0x7F,0xC0,0x01,0xFF,0x00,
+0x7F,0xC0,0x01,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0xC0,0x01,0xFF,0x80,
+0x7F,0xC0,0x01,0xFF,0x80,
+0x7F,0xE0,0x01,0xFF,0x80,
+0x7F,0xE0,0x03,0xFF,0x00,
+0x7F,0xF8,0x07,0xFF,0x00,
+0x3F,0xFF,0x7F,0xFF,0x00,
+0x3F,0xFF,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0xFC,0x00,
+0x0F,0xFF,0xFF,0xF8,0x00,
+0x07,0xFF,0xFF,0xF0,0x00,
+0x03,0xFF,0xFF,0xE0,0x00,
+0x00,0xFF,0xFF,0xC0,0x00,
+0x00,0x3F,0xFF,0x00,0x00,
+0x00,0x03,0xE0,0x00,0x00,
+0x00,0x3F,0xFF,0x00,0x00,
+0x01,0xFF,0xFF,0xE0,0x00,
+0x03,0xFF,0xFF,0xF0,0x00,
+0x07,0xFF,0xFF,0xF8,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x1F,0xFF,0xFF,0xFC,0x00,
+0x1F,0xFF,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFF,0xFE,0x00,
+0x3F,0xFE,0x1F,0xFF,0x00,
+0x7F,0xF0,0x07,0xFF,0x00,
+0x7F,0xE0,0x03,0xFF,0x00,
+0x7F,0xE0,0x01,0xFF,0x80,
+0x7F,0xC0,0x01,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0x7F,0xE0,0x01,0xFF,0x80,
+0x7F,0xF0,0x01,0xFF,0x80,
+0x7F,0xFE,0x01,0xFF,0x00,
+0x7F,0xFF,0xE3,0xFF,0x00,
+0x3F,0xFF,0xC3,0xFF,0x00,
+0x3F,0xFF,0xC7,0xFF,0x00,
+0x1F,0xFF,0x87,0xFE,0x00,
+0x0F,0xFF,0x0F,0xFE,0x00,
+0x07,0xFE,0x1F,0xFC,0x00,
+0x03,0xFC,0x3F,0xFC,0x00,
+0x00,0x70,0x3F,0xF8,0x00,
+0x00,0x00,0x7F,0xF0,0x00,
+0x00,0x00,0xFF,0xF0,0x00,
+0x00,0x00,0xFF,0xE0,0x00,
+0x00,0x01,0xFF,0xC0,0x00,
+0x00,0x03,0xFF,0xC0,0x00,
+0x00,0x03,0xFF,0x80,0x00,
+0x00,0x07,0xFF,0x00,0x00,
+0x00,0x0F,0xFF,0x00,0x00,
+0x00,0x0F,0xFE,0x00,0x00,
+0x00,0x1F,0xFC,0x00,0x00,
+0x00,0x3F,0xFC,0x00,0x00,
+0x00,0x7F,0xF8,0x00,0x00,
+0x00,0x7F,0xF0,0x00,0x00,
+0x00,0xFF,0xF0,0x00,0x00,
+0x01,0xFF,0xE0,0x00,0x00,
+0x01,0xFF,0xC0,0x00,0x00,
+0x03,0xFF,0xC0,0x00,0x00,
+0x07,0xFF,0x80,0x00,0x00,
+0x07,0xFF,0x00,0x00,0x00,
+0x07,0xFF,0x00,0x00,0x00,
+0x00,0x1E,0x78,0x00,0x00,
+0x00,0x70,0x06,0x00,0x00,
+0x00,0xC0,0x01,0x80,0x00,
+0x01,0x80,0x00,0xC0,0x00,
+0x03,0x00,0x00,0x40,0x00,
+0x06,0x00,0x00,0x20,0x00,
+0x04,0x00,0x00,0x30,0x00,
+0x0C,0x00,0x00,0x10,0x00,
+0x08,0x00,0x00,0x18,0x00,
+0x08,0x00,0x00,0x08,0x00,
+0x08,0x00,0x00,0x08,0x00,
+0x18,0x00,0x00,0x08,0x00,
+0x18,0x00,0x00,0x08,0x00,
+0x08,0x00,0x00,0x08,0x00,
+0x08,0x00,0x00,0x08,0x00,
+0x08,0x00,0x00,0x18,0x00,
+0x08,0x00,0x00,0x10,0x00,
+0x04,0x00,0x00,0x10,0x00,
+0x06,0x00,0x00,0x20,0x00,
+0x02,0x00,0x00,0x60,0x00,
+0x01,0x00,0x00,0xC0,0x00,
+0x00,0x80,0x01,0x80,0x00,
+0x00,0x60,0x03,0x00,0x00,
+0x00,0x18,0x1C,0x00,0x00,
+0x00,0x07,0xE0,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,
+0x00,0x0F,0xF8,0x00,0x00,
+0x00,0x70,0x07,0x00,0x00,
+0x01,0x80,0x01,0x80,0x00,
+0x03,0x00,0x00,0x60,0x00,
+0x04,0x00,0x00,0x30,0x00,
+0x08,0x00,0x00,0x18,0x00,
+0x10,0x00,0x00,0x08,0x00,
+0x30,0x00,0x00,0x04,0x00,
+0x20,0x00,0x00,0x06,0x00,
+0x40,0x00,0x00,0x02,0x00,
+0x40,0x00,0x00,0x03,0x00,
+0xC0,0x00,0x00,0x01,0x00,
+0x80,0x00,0x00,0x01,0x00,
+0x80,0x00,0x00,0x01,0x80,
+0x80,0x00,0x00,0x00,0x80,
+0x80,0x00,0x00,0x00,0x80,
+0x80,0x00,0x00,0x00,0x80,
+0x80,0x00,0x00,0x00,0x80,
+0x80,0x00,0x00,0x01,0x80,
+0x80,0x00,0x00,0x01,0x80,
+0x80,0x00,0x00,0x01,0x00,
+0xC0,0x00,0x00,0x01,0x00,
+0x40,0x00,0x00,0x03,0x00,
+0x60,0x00,0x00,0x02,0x00,
+0x20,0x00,0x00,0x06,0x00,
+0x30,0x00,0x00,0x04,0x00,
+0x18,0x00,0x00,0x08,0x00,
+0x08,0x00,0x00,0x10,0x00,
+0x06,0x00,0x00,0x20,0x00,
+0x03,0x00,0x00,0x40,0x00,
+0x00,0xC0,0x01,0x80,0x00,
+0x00,0x38,0x0E,0x00,0x00,
+0x00,0x0F,0xF0,0x00,0x00,
+0x00,0x0F,0xFF,0x00,0x00,
+0x00,0x3F,0xFF,0x80,0x00,
+0x00,0x3F,0xFF,0x80,0x00,
+0x00,0x7F,0xFF,0x80,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0xFF,0xBF,0xE0,0x00,
+0x00,0xFF,0x3F,0xE0,0x00,
+0x00,0xFF,0x3F,0xE0,0x00,
+0x00,0xFF,0x1F,0xE0,0x00,
+0x00,0xFF,0x1F,0xE0,0x00,
+0x01,0xFF,0x1F,0xF0,0x00,
+0x01,0xFE,0x1F,0xF0,0x00,
+0x01,0xFE,0x1F,0xF0,0x00,
+0x01,0xFE,0x0F,0xF0,0x00,
+0x01,0xFE,0x0F,0xF0,0x00,
+0x03,0xFE,0x0F,0xF8,0x00,
+0x03,0xFC,0x0F,0xF8,0x00,
+0x03,0xFC,0x0F,0xF8,0x00,
+0x03,0xFC,0x0F,0xF8,0x00,
+0x03,0xFC,0x07,0xF8,0x00,
+0x07,0xFC,0x07,0xFC,0x00,
+0x07,0xF8,0x07,0xFC,0x00,
+0x07,0xF8,0x07,0xFC,0x00,
+0x07,0xF8,0x07,0xFC,0x00,
+0x07,0xF8,0x03,0xFC,0x00,
+0x07,0xF8,0x03,0xFE,0x00,
+0x0F,0xF8,0x03,0xFE,0x00,
+0x0F,0xF0,0x03,0xFE,0x00,
+0x0F,0xF0,0x03,0xFE,0x00,
+0x0F,0xF0,0x03,0xFE,0x00,
+0x0F,0xF0,0x01,0xFF,0x00,
+0x1F,0xF0,0x01,0xFF,0x00,
+0x1F,0xF0,0x03,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x3F,0xE0,0x00,0xFF,0xC0,
+0x3F,0xC0,0x00,0x7F,0xC0,
+0x7F,0xC0,0x00,0x7F,0xC0,
+0x7F,0x80,0x00,0x7F,0xC0,
+0x7F,0x80,0x00,0x7F,0xC0,
+0x7F,0x80,0x00,0x7F,0xC0,
+0x7F,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x00,0x00,0x3F,0xE0,
+0xFF,0x00,0x00,0x3F,0xE0,
+0x7F,0x00,0x00,0x3F,0xE0,
+0x7F,0xFF,0xF8,0x00,0x00,
+0xFF,0xFF,0xFF,0x80,0x00,
+0xFF,0xFF,0xFF,0xE0,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0xFE,0x00,
+0xFF,0xC0,0x7F,0xFF,0x00,
+0xFF,0x80,0x0F,0xFF,0x00,
+0xFF,0x80,0x07,0xFF,0x00,
+0xFF,0x80,0x03,0xFF,0x00,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x00,
+0xFF,0x80,0x01,0xFF,0x00,
+0xFF,0x80,0x01,0xFF,0x00,
+0xFF,0x80,0x01,0xFF,0x00,
+0xFF,0x80,0x03,0xFE,0x00,
+0xFF,0x80,0x03,0xFE,0x00,
+0xFF,0x80,0x0F,0xFC,0x00,
+0xFF,0xC0,0x7F,0xF8,0x00,
+0xFF,0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xFF,0xE0,0x00,
+0xFF,0xFF,0xFF,0xE0,0x00,
+0xFF,0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFF,0xFE,0x00,
+0xFF,0xC0,0x07,0xFF,0x00,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0x7F,0xC0,
+0xFF,0x80,0x00,0x7F,0xC0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x7F,0xE0,
+0xFF,0x80,0x00,0xFF,0xE0,
+0xFF,0x80,0x01,0xFF,0xC0,
+0xFF,0x80,0x03,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xE0,0x00,
+0xFF,0xFF,0xFF,0x80,0x00,
+0x01,0xFF,0xFF,0xFC,0x00,
+0x07,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xF0,0x01,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x00,
+0xFF,0x80,0x00,0xFF,0x00,
+0xFF,0x80,0x00,0xFF,0x00,
+0xFF,0x80,0x00,0xFF,0x00,
+0xFF,0x80,0x00,0xFF,0x00,
+0xFF,0x80,0x00,0xFF,0x00,
+0xFF,0x80,0x00,0x7E,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0x7F,0xE0,0x00,0xFF,0xE0,
+0x7F,0xF0,0x01,0xFF,0xC0,
+0x7F,0xF8,0x03,0xFF,0xC0,
+0x7F,0xFF,0xFF,0xFF,0xC0,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x07,0xFF,0xFF,0xFC,0x00,
+0x03,0xFF,0xFF,0xF8,0x00,
+0x00,0xFF,0xFF,0xE0,0x00,
+0x00,0x3F,0xFF,0x00,0x00,
+0x7F,0xFF,0xFF,0xC0,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0xC0,
+0x7F,0xFC,0x03,0xFF,0xC0,
+0x1F,0xF8,0x00,0xFF,0xE0,
+0x0F,0xF8,0x00,0x7F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x3F,0xE0,
+0x0F,0xF8,0x00,0x7F,0xE0,
+0x0F,0xF8,0x00,0xFF,0xE0,
+0x1F,0xFF,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0x7F,0xFF,0xFF,0xE0,0x00,
+0x7F,0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xC0,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0xC0,0x00,0x00,0x00,
+0xFF,0xFF,0xFF,0xC0,0x00,
+0xFF,0xFF,0xFF,0xC0,0x00,
+0xFF,0xFF,0xFF,0xC0,0x00,
+0xFF,0xFF,0xFF,0xC0,0x00,
+0xFF,0xFF,0xFF,0xC0,0x00,
+0xFF,0xFF,0xFF,0xC0,0x00,
+0xFF,0xFF,0xFF,0x80,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0x03,0xFF,0xFF,0xFF,0xC0,
+0x1F,0xFF,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xF0,0x00,0x00,0x00,
+0xFF,0xC0,0x00,0x00,0x00,
+0xFF,0xC0,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xF8,0x00,
+0xFF,0xFF,0xFF,0xF0,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0x01,0xFF,0xFF,0xE0,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x1F,0xFF,0xFF,0xFE,0x00,
+0x3F,0xFF,0xFF,0xFF,0x00,
+0x7F,0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xF0,0x01,0xFF,0x80,
+0xFF,0xC0,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0x80,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0xFF,0xFF,0xE0,
+0xFF,0x81,0xFF,0xFF,0xE0,
+0xFF,0x81,0xFF,0xFF,0xE0,
+0xFF,0x81,0xFF,0xFF,0xE0,
+0xFF,0x81,0xFF,0xFF,0xE0,
+0xFF,0x80,0xFF,0xFF,0xE0,
+0xFF,0x80,0x7F,0xFF,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0xFF,0xF0,0x01,0xFF,0xE0,
+0x7F,0xFC,0x07,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xBF,0xE0,
+0x1F,0xFF,0xFF,0x9F,0xE0,
+0x0F,0xFF,0xFF,0x1F,0xE0,
+0x07,0xFF,0xFC,0x0F,0xE0,
+0x01,0xFF,0xF8,0x07,0xE0,
+0x00,0x7F,0xC0,0x00,0x00,
+0x7F,0x00,0x00,0x1F,0xC0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0x03,0xFF,0xF8,0x00,
+0x03,0xFF,0xFC,0x00,
+0x03,0xFF,0xFC,0x00,
+0x03,0xFF,0xFC,0x00,
+0x03,0xFF,0xFC,0x00,
+0x03,0xFF,0xFC,0x00,
+0x03,0xFF,0xF8,0x00,
+0x01,0xFF,0xF0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x00,0x7F,0xC0,0x00,
+0x3F,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xE0,
+0x00,0x07,0xFF,0xFF,0xE0,
+0x00,0x0F,0xFF,0xFF,0xE0,
+0x00,0x0F,0xFF,0xFF,0xE0,
+0x00,0x0F,0xFF,0xFF,0xE0,
+0x00,0x0F,0xFF,0xFF,0xE0,
+0x00,0x0F,0xFF,0xFF,0xE0,
+0x00,0x0F,0xFF,0xFF,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x00,0x00,0x00,0x3F,0xE0,
+0x7F,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0x7F,0xE0,0x00,0x7F,0xE0,
+0x7F,0xFF,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xFF,0xC0,
+0x3F,0xFF,0xFF,0xFF,0xC0,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFF,0xFF,0x00,
+0x07,0xFF,0xFF,0xFC,0x00,
+0x01,0xFF,0xFF,0xF8,0x00,
+0x7F,0x00,0x00,0x0F,0xC0,
+0xFF,0x00,0x00,0x1F,0xE0,
+0xFF,0x00,0x00,0x3F,0xE0,
+0xFF,0x00,0x00,0x7F,0xC0,
+0xFF,0x00,0x00,0x7F,0xC0,
+0xFF,0x00,0x00,0xFF,0x80,
+0xFF,0x00,0x01,0xFF,0x00,
+0xFF,0x00,0x03,0xFE,0x00,
+0xFF,0x00,0x03,0xFE,0x00,
+0xFF,0x00,0x07,0xFC,0x00,
+0xFF,0x00,0x0F,0xF8,0x00,
+0xFF,0x00,0x1F,0xF0,0x00,
+0xFF,0x00,0x3F,0xF0,0x00,
+0xFF,0x00,0x3F,0xE0,0x00,
+0xFF,0x00,0x7F,0xC0,0x00,
+0xFF,0x00,0xFF,0x80,0x00,
+0xFF,0x01,0xFF,0x80,0x00,
+0xFF,0x01,0xFF,0x00,0x00,
+0xFF,0x03,0xFE,0x00,0x00,
+0xFF,0x07,0xFE,0x00,0x00,
+0xFF,0x0F,0xFC,0x00,0x00,
+0xFF,0x0F,0xF8,0x00,0x00,
+0xFF,0x1F,0xF0,0x00,0x00,
+0xFF,0x3F,0xF0,0x00,0x00,
+0xFF,0xFF,0xE0,0x00,0x00,
+0xFF,0xFF,0xE0,0x00,0x00,
+0xFF,0xFF,0xF0,0x00,0x00,
+0xFF,0xFF,0xF0,0x00,0x00,
+0xFF,0xFF,0xF8,0x00,0x00,
+0xFF,0xFF,0xFC,0x00,0x00,
+0xFF,0xFF,0xFC,0x00,0x00,
+0xFF,0xFF,0xFE,0x00,0x00,
+0xFF,0xFF,0xFE,0x00,0x00,
+0xFF,0xFF,0xFF,0x00,0x00,
+0xFF,0xF3,0xFF,0x00,0x00,
+0xFF,0xE3,0xFF,0x80,0x00,
+0xFF,0xC1,0xFF,0xC0,0x00,
+0xFF,0xC1,0xFF,0xC0,0x00,
+0xFF,0x80,0xFF,0xE0,0x00,
+0xFF,0x80,0x7F,0xE0,0x00,
+0xFF,0x00,0x7F,0xF0,0x00,
+0xFF,0x00,0x3F,0xF0,0x00,
+0xFF,0x00,0x3F,0xF8,0x00,
+0xFF,0x00,0x1F,0xFC,0x00,
+0xFF,0x00,0x0F,0xFC,0x00,
+0xFF,0x00,0x0F,0xFE,0x00,
+0xFF,0x00,0x07,0xFE,0x00,
+0xFF,0x00,0x07,0xFF,0x00,
+0xFF,0x00,0x03,0xFF,0x00,
+0xFF,0x00,0x01,0xFF,0x80,
+0xFF,0x00,0x01,0xFF,0xC0,
+0xFF,0x00,0x00,0xFF,0xC0,
+0xFF,0x00,0x00,0xFF,0xE0,
+0xFF,0x00,0x00,0x7F,0xE0,
+0xFF,0x00,0x00,0x3F,0xE0,
+0x7F,0x00,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x00,0x00,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0x7F,0x00,0x00,0x0F,0xC0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0xFF,0xE0,0x00,0x7F,0xE0,
+0xFF,0xE0,0x00,0xFF,0xE0,
+0xFF,0xE0,0x00,0xFF,0xE0,
+0xFF,0xF0,0x01,0xFF,0xE0,
+0xFF,0xF0,0x01,0xFF,0xE0,
+0xFF,0xF8,0x01,0xFF,0xE0,
+0xFF,0xF8,0x03,0xFF,0xE0,
+0xFF,0xFC,0x03,0xFF,0xE0,
+0xFF,0xFC,0x07,0xFF,0xE0,
+0xFF,0xFC,0x07,0xFF,0xE0,
+0xFF,0xFE,0x0F,0xFF,0xE0,
+0xFF,0xFE,0x0F,0xFF,0xE0,
+0xFF,0xFF,0x0F,0xFF,0xE0,
+0xFF,0xFF,0x1F,0xFF,0xE0,
+0xFF,0xBF,0x9F,0x9F,0xE0,
+0xFF,0x9F,0xBF,0x9F,0xE0,
+0xFF,0x9F,0xFF,0x1F,0xE0,
+0xFF,0x8F,0xFF,0x1F,0xE0,
+0xFF,0x8F,0xFE,0x1F,0xE0,
+0xFF,0x8F,0xFE,0x1F,0xE0,
+0xFF,0x87,0xFC,0x1F,0xE0,
+0xFF,0x87,0xFC,0x1F,0xE0,
+0xFF,0x83,0xF8,0x1F,0xE0,
+0xFF,0x83,0xF8,0x1F,0xE0,
+0xFF,0x81,0xF0,0x1F,0xE0,
+0xFF,0x81,0xF0,0x1F,0xE0,
+0xFF,0x80,0xF0,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0x7F,0x00,0x00,0x0F,0xC0,
+0xFF,0x00,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0xC0,0x00,0x1F,0xE0,
+0xFF,0xE0,0x00,0x1F,0xE0,
+0xFF,0xE0,0x00,0x1F,0xE0,
+0xFF,0xF0,0x00,0x1F,0xE0,
+0xFF,0xF0,0x00,0x1F,0xE0,
+0xFF,0xF8,0x00,0x1F,0xE0,
+0xFF,0xF8,0x00,0x1F,0xE0,
+0xFF,0xFC,0x00,0x1F,0xE0,
+0xFF,0xFE,0x00,0x1F,0xE0,
+0xFF,0xFE,0x00,0x1F,0xE0,
+0xFF,0xFF,0x00,0x1F,0xE0,
+0xFF,0xFF,0x00,0x1F,0xE0,
+0xFF,0xFF,0x80,0x1F,0xE0,
+0xFF,0xFF,0x80,0x1F,0xE0,
+0xFF,0xFF,0xC0,0x1F,0xE0,
+0xFF,0xFF,0xE0,0x1F,0xE0,
+0xFF,0xFF,0xE0,0x1F,0xE0,
+0xFF,0xFF,0xF0,0x1F,0xE0,
+0xFF,0x3F,0xF0,0x1F,0xE0,
+0xFF,0x1F,0xF8,0x1F,0xE0,
+0xFF,0x1F,0xF8,0x1F,0xE0,
+0xFF,0x0F,0xFC,0x1F,0xE0,
+0xFF,0x0F,0xFC,0x1F,0xE0,
+0xFF,0x07,0xFE,0x1F,0xE0,
+0xFF,0x03,0xFF,0x1F,0xE0,
+0xFF,0x03,0xFF,0x1F,0xE0,
+0xFF,0x01,0xFF,0x9F,0xE0,
+0xFF,0x01,0xFF,0x9F,0xE0,
+0xFF,0x00,0xFF,0xFF,0xE0,
+0xFF,0x00,0xFF,0xFF,0xE0,
+0xFF,0x00,0x7F,0xFF,0xE0,
+0xFF,0x00,0x3F,0xFF,0xE0,
+0xFF,0x00,0x3F,0xFF,0xE0,
+0xFF,0x00,0x1F,0xFF,0xE0,
+0xFF,0x00,0x1F,0xFF,0xE0,
+0xFF,0x00,0x0F,0xFF,0xE0,
+0xFF,0x00,0x0F,0xFF,0xE0,
+0xFF,0x00,0x07,0xFF,0xE0,
+0xFF,0x00,0x07,0xFF,0xE0,
+0xFF,0x00,0x03,0xFF,0xE0,
+0xFF,0x00,0x01,0xFF,0xE0,
+0xFF,0x00,0x01,0xFF,0xE0,
+0xFF,0x00,0x00,0xFF,0xE0,
+0xFF,0x00,0x00,0xFF,0xE0,
+0xFF,0x00,0x00,0x7F,0xE0,
+0xFF,0x00,0x00,0x7F,0xE0,
+0xFF,0x00,0x00,0x3F,0xE0,
+0xFF,0x00,0x00,0x1F,0xE0,
+0xFF,0x00,0x00,0x1F,0xE0,
+0xFF,0x00,0x00,0x1F,0xE0,
+0x00,0x01,0xF0,0x00,0x00,
+0x00,0x0F,0xFE,0x00,0x00,
+0x00,0x3F,0xFF,0x80,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0xFF,0xFF,0xE0,0x00,
+0x01,0xFF,0xFF,0xF0,0x00,
+0x03,0xFF,0xFF,0xF8,0x00,
+0x03,0xFF,0xFF,0xF8,0x00,
+0x07,0xFF,0x1F,0xFC,0x00,
+0x07,0xFC,0x07,0xFE,0x00,
+0x0F,0xF8,0x03,0xFE,0x00,
+0x0F,0xF8,0x03,0xFF,0x00,
+0x1F,0xF0,0x01,0xFF,0x00,
+0x1F,0xF0,0x01,0xFF,0x00,
+0x1F,0xE0,0x00,0xFF,0x80,
+0x3F,0xE0,0x00,0xFF,0x80,
+0x3F,0xE0,0x00,0xFF,0x80,
+0x3F,0xC0,0x00,0x7F,0xC0,
+0x7F,0xC0,0x00,0x7F,0xC0,
+0x7F,0xC0,0x00,0x7F,0xC0,
+0x7F,0xC0,0x00,0x7F,0xC0,
+0x7F,0xC0,0x00,0x7F,0xC0,
+0x7F,0xC0,0x00,0x3F,0xE0,
+0x7F,0xC0,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0x7F,0xC0,0x00,0x7F,0xE0,
+0x7F,0xC0,0x00,0x7F,0xE0,
+0x7F,0xE0,0x00,0x7F,0xC0,
+0x7F,0xE0,0x00,0xFF,0xC0,
+0x7F,0xF0,0x01,0xFF,0xC0,
+0x3F,0xF8,0x01,0xFF,0xC0,
+0x3F,0xFC,0x07,0xFF,0x80,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x07,0xFF,0xFF,0xFC,0x00,
+0x03,0xFF,0xFF,0xF8,0x00,
+0x01,0xFF,0xFF,0xF0,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x0F,0xFE,0x00,0x00,
+0x7F,0xFF,0xFF,0x00,0x00,
+0xFF,0xFF,0xFF,0xE0,0x00,
+0xFF,0xFF,0xFF,0xF0,0x00,
+0xFF,0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0xFE,0x00,
+0xFF,0xFF,0xFF,0xFF,0x00,
+0x3F,0xF8,0x1F,0xFF,0x80,
+0x1F,0xF0,0x03,0xFF,0x80,
+0x1F,0xF0,0x01,0xFF,0xC0,
+0x1F,0xF0,0x00,0xFF,0xC0,
+0x1F,0xF0,0x00,0x7F,0xC0,
+0x1F,0xF0,0x00,0x7F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x3F,0xE0,
+0x1F,0xF0,0x00,0x7F,0xE0,
+0x1F,0xF0,0x00,0x7F,0xE0,
+0x1F,0xF0,0x00,0xFF,0xC0,
+0x1F,0xF0,0x00,0xFF,0xC0,
+0x1F,0xF0,0x01,0xFF,0xC0,
+0x1F,0xF0,0x03,0xFF,0x80,
+0x1F,0xF0,0x07,0xFF,0x80,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0xFC,0x00,
+0x1F,0xFF,0xFF,0xF8,0x00,
+0x1F,0xFF,0xFF,0xE0,0x00,
+0x1F,0xFF,0xFF,0x80,0x00,
+0x1F,0xF8,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x1F,0xF0,0x00,0x00,0x00,
+0x00,0x03,0xF8,0x00,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x01,0xFF,0xFF,0xF8,0x00,
+0x07,0xFF,0xFF,0xFC,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x7F,0xFF,0x1F,0xFF,0xC0,
+0x7F,0xF8,0x01,0xFF,0xC0,
+0x7F,0xE0,0x00,0xFF,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x83,0xF8,0x3F,0xE0,
+0xFF,0x87,0xFC,0x3F,0xE0,
+0xFF,0x83,0xFC,0x3F,0xE0,
+0xFF,0x81,0xFE,0x3F,0xC0,
+0xFF,0x81,0xFF,0x3F,0xC0,
+0xFF,0x80,0xFF,0xBF,0x80,
+0xFF,0x80,0x7F,0xFF,0x80,
+0xFF,0x80,0x7F,0xFF,0x00,
+0xFF,0xC0,0x3F,0xFE,0x00,
+0x7F,0xC0,0x1F,0xFE,0x00,
+0x7F,0xC0,0x1F,0xFC,0x00,
+0x7F,0xE0,0x0F,0xFC,0x00,
+0x3F,0xFF,0xFF,0xFC,0x00,
+0x3F,0xFF,0xFF,0xFE,0x00,
+0x1F,0xFF,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFF,0xFF,0x80,
+0x07,0xFF,0xFF,0xFF,0xC0,
+0x01,0xFF,0xFF,0xFF,0xE0,
+0x00,0xFF,0xFF,0xFF,0xE0,
+0x00,0x3F,0xFF,0xFF,0xE0,
+0x7F,0xFF,0xFF,0xFC,0x00,
+0xFF,0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0xFF,0x00,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0xFF,0x80,
+0xFF,0xC0,0x03,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x03,0xFF,0x00,
+0xFF,0x80,0x07,0xFE,0x00,
+0xFF,0x9F,0xFF,0xFC,0x00,
+0xFF,0x9F,0xFF,0xF8,0x00,
+0xFF,0x9F,0xFF,0xF0,0x00,
+0xFF,0x9F,0xFF,0xC0,0x00,
+0xFF,0x9F,0xFF,0x00,0x00,
+0xFF,0x9F,0xFE,0x00,0x00,
+0xFF,0x9F,0xF8,0x00,0x00,
+0xFF,0x9F,0xF8,0x00,0x00,
+0xFF,0x9F,0xFC,0x00,0x00,
+0xFF,0x8F,0xFC,0x00,0x00,
+0xFF,0x87,0xFE,0x00,0x00,
+0xFF,0x87,0xFF,0x00,0x00,
+0xFF,0x83,0xFF,0x00,0x00,
+0xFF,0x81,0xFF,0x80,0x00,
+0xFF,0x81,0xFF,0x80,0x00,
+0xFF,0x80,0xFF,0xC0,0x00,
+0xFF,0x80,0xFF,0xE0,0x00,
+0xFF,0x80,0x7F,0xE0,0x00,
+0xFF,0x80,0x3F,0xF0,0x00,
+0xFF,0x80,0x3F,0xF0,0x00,
+0xFF,0x80,0x1F,0xF8,0x00,
+0xFF,0x80,0x1F,0xFC,0x00,
+0xFF,0x80,0x0F,0xFC,0x00,
+0xFF,0x80,0x07,0xFE,0x00,
+0xFF,0x80,0x07,0xFF,0x00,
+0xFF,0x80,0x03,0xFF,0x00,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x01,0xFF,0x80,
+0xFF,0x80,0x00,0xFF,0xC0,
+0xFF,0x80,0x00,0xFF,0xE0,
+0xFF,0x80,0x00,0x7F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0x00,0x01,0xFE,0x00,0x00,
+0x00,0x1F,0xFF,0xE0,0x00,
+0x00,0x7F,0xFF,0xF8,0x00,
+0x01,0xFF,0xFF,0xFE,0x00,
+0x03,0xFF,0xFF,0xFF,0x00,
+0x07,0xFF,0xFF,0xFF,0x00,
+0x0F,0xFF,0xFF,0xFF,0x80,
+0x0F,0xFF,0x87,0xFF,0xC0,
+0x1F,0xFC,0x00,0xFF,0xC0,
+0x1F,0xF8,0x00,0x7F,0xC0,
+0x1F,0xF0,0x00,0x3F,0xC0,
+0x3F,0xF0,0x00,0x3F,0xC0,
+0x3F,0xE0,0x00,0x3F,0xE0,
+0x3F,0xE0,0x00,0x3F,0xC0,
+0x3F,0xF0,0x00,0x1F,0xC0,
+0x3F,0xF0,0x00,0x00,0x00,
+0x3F,0xF0,0x00,0x00,0x00,
+0x1F,0xF8,0x00,0x00,0x00,
+0x1F,0xFC,0x00,0x00,0x00,
+0x1F,0xFF,0x00,0x00,0x00,
+0x0F,0xFF,0x80,0x00,0x00,
+0x0F,0xFF,0xC0,0x00,0x00,
+0x07,0xFF,0xF0,0x00,0x00,
+0x03,0xFF,0xF8,0x00,0x00,
+0x03,0xFF,0xFE,0x00,0x00,
+0x01,0xFF,0xFF,0x00,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x3F,0xFF,0xE0,0x00,
+0x00,0x1F,0xFF,0xF0,0x00,
+0x00,0x0F,0xFF,0xFC,0x00,
+0x00,0x03,0xFF,0xFE,0x00,
+0x00,0x00,0xFF,0xFE,0x00,
+0x00,0x00,0x7F,0xFF,0x00,
+0x00,0x00,0x1F,0xFF,0x80,
+0x00,0x00,0x0F,0xFF,0xC0,
+0x00,0x00,0x03,0xFF,0xC0,
+0x00,0x00,0x01,0xFF,0xC0,
+0x00,0x00,0x00,0xFF,0xE0,
+0x00,0x00,0x00,0x7F,0xE0,
+0x00,0x00,0x00,0x7F,0xE0,
+0x7F,0x00,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0x80,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xE0,0x00,0x7F,0xE0,
+0xFF,0xF0,0x00,0xFF,0xC0,
+0x7F,0xFF,0x1F,0xFF,0xC0,
+0x7F,0xFF,0xFF,0xFF,0xC0,
+0x3F,0xFF,0xFF,0xFF,0x80,
+0x3F,0xFF,0xFF,0xFF,0x00,
+0x1F,0xFF,0xFF,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x07,0xFF,0xFF,0xF0,0x00,
+0x01,0xFF,0xFF,0xC0,0x00,
+0x00,0x3F,0xFE,0x00,0x00,
+0x7F,0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0x00,0x0F,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xFC,0x00,0x00,
+0x00,0x07,0xF8,0x00,0x00,
+0x7F,0x80,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x3F,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0xFF,0xC0,0x00,0x7F,0xE0,
+0x7F,0xC0,0x00,0x7F,0xE0,
+0x7F,0xC0,0x00,0xFF,0xE0,
+0x7F,0xE0,0x01,0xFF,0xE0,
+0x7F,0xE0,0x03,0xFF,0xE0,
+0x7F,0xF0,0x07,0xFF,0xE0,
+0x7F,0xFE,0x3F,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xFF,0xE0,
+0x3F,0xFF,0xFF,0xFF,0xE0,
+0x1F,0xFF,0xFF,0xFF,0xE0,
+0x0F,0xFF,0xFF,0x3F,0xE0,
+0x0F,0xFF,0xFE,0x3F,0xE0,
+0x07,0xFF,0xFC,0x3F,0xE0,
+0x01,0xFF,0xF0,0x1F,0xE0,
+0x00,0x7F,0x80,0x00,0x00,
+0x7F,0x00,0x00,0x0F,0xC0,
+0xFF,0x80,0x00,0x0F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0x7F,0x80,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x3F,0xC0,
+0x7F,0xC0,0x00,0x3F,0xC0,
+0x7F,0xC0,0x00,0x3F,0xC0,
+0x7F,0xC0,0x00,0x3F,0xC0,
+0x7F,0xC0,0x00,0x3F,0x80,
+0x3F,0xE0,0x00,0x7F,0x80,
+0x3F,0xE0,0x00,0x7F,0x80,
+0x3F,0xE0,0x00,0x7F,0x80,
+0x3F,0xE0,0x00,0x7F,0x00,
+0x3F,0xE0,0x00,0x7F,0x00,
+0x1F,0xE0,0x00,0xFF,0x00,
+0x1F,0xF0,0x00,0xFF,0x00,
+0x1F,0xF0,0x00,0xFE,0x00,
+0x1F,0xF0,0x00,0xFE,0x00,
+0x1F,0xF0,0x01,0xFE,0x00,
+0x0F,0xF0,0x01,0xFE,0x00,
+0x0F,0xF8,0x01,0xFC,0x00,
+0x0F,0xF8,0x01,0xFC,0x00,
+0x0F,0xF8,0x01,0xFC,0x00,
+0x0F,0xF8,0x03,0xFC,0x00,
+0x0F,0xF8,0x03,0xFC,0x00,
+0x07,0xFC,0x03,0xF8,0x00,
+0x07,0xFC,0x03,0xF8,0x00,
+0x07,0xFC,0x03,0xF8,0x00,
+0x07,0xFC,0x07,0xF8,0x00,
+0x07,0xFC,0x07,0xF0,0x00,
+0x03,0xFE,0x07,0xF0,0x00,
+0x03,0xFE,0x07,0xF0,0x00,
+0x03,0xFE,0x0F,0xF0,0x00,
+0x03,0xFE,0x0F,0xE0,0x00,
+0x03,0xFE,0x0F,0xE0,0x00,
+0x01,0xFE,0x0F,0xE0,0x00,
+0x01,0xFF,0x0F,0xE0,0x00,
+0x01,0xFF,0x1F,0xE0,0x00,
+0x01,0xFF,0x1F,0xC0,0x00,
+0x01,0xFF,0x1F,0xC0,0x00,
+0x01,0xFF,0x1F,0xC0,0x00,
+0x00,0xFF,0xBF,0xC0,0x00,
+0x00,0xFF,0xFF,0x80,0x00,
+0x00,0xFF,0xFF,0x80,0x00,
+0x00,0xFF,0xFF,0x80,0x00,
+0x00,0xFF,0xFF,0x80,0x00,
+0x00,0x7F,0xFF,0x00,0x00,
+0x00,0x7F,0xFF,0x00,0x00,
+0x00,0x7F,0xFF,0x00,0x00,
+0x00,0x7F,0xFF,0x00,0x00,
+0x00,0x3F,0xFE,0x00,0x00,
+0x00,0x3F,0xFC,0x00,0x00,
+0x00,0x1F,0xF8,0x00,0x00,
+0x7F,0x80,0x00,0x07,0xC0,
+0x7F,0x80,0x00,0x0F,0xE0,
+0xFF,0xC0,0x00,0x0F,0xE0,
+0x7F,0xC0,0x00,0x0F,0xE0,
+0x7F,0xC0,0x00,0x0F,0xE0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x3F,0xC0,0x00,0x3F,0xC0,
+0x3F,0xC0,0x00,0x3F,0x80,
+0x3F,0xC0,0x00,0x3F,0x80,
+0x3F,0xC0,0x00,0x3F,0x80,
+0x3F,0xC0,0x00,0x3F,0x80,
+0x3F,0xC0,0x00,0x3F,0x80,
+0x3F,0xE0,0x00,0x3F,0x80,
+0x3F,0xE0,0x00,0x3F,0x80,
+0x3F,0xE0,0x00,0x7F,0x80,
+0x3F,0xE0,0xF0,0x7F,0x80,
+0x3F,0xE1,0xF0,0x7F,0x00,
+0x1F,0xE1,0xF0,0x7F,0x00,
+0x1F,0xE1,0xF0,0x7F,0x00,
+0x1F,0xE1,0xF8,0x7F,0x00,
+0x1F,0xE1,0xF8,0x7F,0x00,
+0x1F,0xE1,0xF8,0x7F,0x00,
+0x1F,0xE3,0xF8,0xFF,0x00,
+0x1F,0xE3,0xF8,0xFF,0x00,
+0x1F,0xE3,0xF8,0xFF,0x00,
+0x1F,0xE3,0xF8,0xFE,0x00,
+0x1F,0xE3,0xF8,0xFE,0x00,
+0x0F,0xF7,0xFC,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFE,0x00,
+0x0F,0xFF,0xFF,0xFC,0x00,
+0x0F,0xFF,0x1F,0xFC,0x00,
+0x0F,0xFF,0x1F,0xFC,0x00,
+0x0F,0xFF,0x0F,0xFC,0x00,
+0x0F,0xFE,0x0F,0xFC,0x00,
+0x07,0xFE,0x0F,0xFC,0x00,
+0x07,0xFE,0x0F,0xFC,0x00,
+0x07,0xFC,0x07,0xFC,0x00,
+0x07,0xFC,0x07,0xFC,0x00,
+0x07,0xFC,0x07,0xF8,0x00,
+0x07,0xFC,0x03,0xF8,0x00,
+0x07,0xF8,0x03,0xF8,0x00,
+0x07,0xF8,0x03,0xF8,0x00,
+0x07,0xF8,0x03,0xF8,0x00,
+0x07,0xF0,0x01,0xF8,0x00,
+0x3F,0xC0,0x00,0x0F,0xC0,
+0x3F,0xC0,0x00,0x3F,0xE0,
+0x3F,0xE0,0x00,0x3F,0xC0,
+0x3F,0xE0,0x00,0x3F,0xC0,
+0x1F,0xF0,0x00,0x7F,0x80,
+0x1F,0xF0,0x00,0x7F,0x80,
+0x0F,0xF8,0x00,0xFF,0x80,
+0x0F,0xF8,0x00,0xFF,0x00,
+0x0F,0xFC,0x01,0xFF,0x00,
+0x07,0xFC,0x01,0xFE,0x00,
+0x07,0xFC,0x03,0xFE,0x00,
+0x03,0xFE,0x03,0xFC,0x00,
+0x03,0xFE,0x07,0xFC,0x00,
+0x01,0xFF,0x07,0xF8,0x00,
+0x01,0xFF,0x0F,0xF8,0x00,
+0x01,0xFF,0x8F,0xF8,0x00,
+0x00,0xFF,0x9F,0xF0,0x00,
+0x00,0xFF,0xFF,0xF0,0x00,
+0x00,0x7F,0xFF,0xE0,0x00,
+0x00,0x7F,0xFF,0xE0,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x3F,0xFF,0xC0,0x00,
+0x00,0x3F,0xFF,0x80,0x00,
+0x00,0x1F,0xFF,0x80,0x00,
+0x00,0x1F,0xFF,0x00,0x00,
+0x00,0x1F,0xFF,0x00,0x00,
+0x00,0x0F,0xFF,0x00,0x00,
+0x00,0x0F,0xFF,0x00,0x00,
+0x00,0x1F,0xFF,0x80,0x00,
+0x00,0x1F,0xFF,0x80,0x00,
+0x00,0x3F,0xFF,0xC0,0x00,
+0x00,0x3F,0xFF,0xC0,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x7F,0xFF,0xE0,0x00,
+0x00,0x7F,0xFF,0xE0,0x00,
+0x00,0xFF,0xBF,0xF0,0x00,
+0x00,0xFF,0x1F,0xF0,0x00,
+0x01,0xFF,0x1F,0xF8,0x00,
+0x01,0xFE,0x1F,0xF8,0x00,
+0x03,0xFE,0x0F,0xF8,0x00,
+0x03,0xFC,0x0F,0xFC,0x00,
+0x07,0xFC,0x07,0xFC,0x00,
+0x07,0xF8,0x07,0xFE,0x00,
+0x07,0xF8,0x03,0xFE,0x00,
+0x0F,0xF0,0x03,0xFF,0x00,
+0x0F,0xF0,0x03,0xFF,0x00,
+0x1F,0xF0,0x01,0xFF,0x00,
+0x1F,0xE0,0x01,0xFF,0x80,
+0x3F,0xE0,0x00,0xFF,0x80,
+0x3F,0xC0,0x00,0xFF,0xC0,
+0x7F,0xC0,0x00,0xFF,0xC0,
+0x7F,0x80,0x00,0x7F,0xC0,
+0x7F,0x80,0x00,0x7F,0xE0,
+0xFF,0x00,0x00,0x3F,0xE0,
+0xFF,0x00,0x00,0x3F,0xE0,
+0x7F,0x00,0x00,0x07,0xC0,
+0xFF,0x80,0x00,0x0F,0xE0,
+0xFF,0x80,0x00,0x1F,0xE0,
+0x7F,0xC0,0x00,0x1F,0xE0,
+0x7F,0xC0,0x00,0x1F,0xC0,
+0x7F,0xC0,0x00,0x3F,0xC0,
+0x7F,0xE0,0x00,0x3F,0xC0,
+0x3F,0xE0,0x00,0x3F,0xC0,
+0x3F,0xE0,0x00,0x7F,0x80,
+0x3F,0xF0,0x00,0x7F,0x80,
+0x1F,0xF0,0x00,0x7F,0x80,
+0x1F,0xF0,0x00,0xFF,0x00,
+0x1F,0xF8,0x00,0xFF,0x00,
+0x0F,0xF8,0x00,0xFF,0x00,
+0x0F,0xF8,0x01,0xFE,0x00,
+0x0F,0xF8,0x01,0xFE,0x00,
+0x07,0xFC,0x01,0xFE,0x00,
+0x07,0xFC,0x03,0xFC,0x00,
+0x07,0xFC,0x03,0xFC,0x00,
+0x03,0xFE,0x03,0xFC,0x00,
+0x03,0xFE,0x07,0xF8,0x00,
+0x03,0xFE,0x07,0xF8,0x00,
+0x01,0xFF,0x07,0xF8,0x00,
+0x01,0xFF,0x0F,0xF0,0x00,
+0x01,0xFF,0x0F,0xF0,0x00,
+0x00,0xFF,0x8F,0xF0,0x00,
+0x00,0xFF,0x9F,0xE0,0x00,
+0x00,0xFF,0x9F,0xE0,0x00,
+0x00,0x7F,0xDF,0xE0,0x00,
+0x00,0x7F,0xFF,0xC0,0x00,
+0x00,0x3F,0xFF,0xC0,0x00,
+0x00,0x3F,0xFF,0xC0,0x00,
+0x00,0x1F,0xFF,0x80,0x00,
+0x00,0x1F,0xFF,0x80,0x00,
+0x00,0x0F,0xFF,0x00,0x00,
+0x00,0x0F,0xFF,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x03,0xFC,0x00,0x00,
+0x7F,0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0x00,0x00,0x01,0xFF,0xC0,
+0x00,0x00,0x00,0xFF,0xC0,
+0x00,0x00,0x01,0xFF,0x80,
+0x00,0x00,0x03,0xFF,0x80,
+0x00,0x00,0x03,0xFF,0x00,
+0x00,0x00,0x07,0xFF,0x00,
+0x00,0x00,0x0F,0xFE,0x00,
+0x00,0x00,0x0F,0xFC,0x00,
+0x00,0x00,0x1F,0xFC,0x00,
+0x00,0x00,0x3F,0xF8,0x00,
+0x00,0x00,0x3F,0xF0,0x00,
+0x00,0x00,0x7F,0xF0,0x00,
+0x00,0x00,0xFF,0xE0,0x00,
+0x00,0x00,0xFF,0xE0,0x00,
+0x00,0x01,0xFF,0xC0,0x00,
+0x00,0x01,0xFF,0x80,0x00,
+0x00,0x03,0xFF,0x80,0x00,
+0x00,0x07,0xFF,0x00,0x00,
+0x00,0x07,0xFE,0x00,0x00,
+0x00,0x0F,0xFE,0x00,0x00,
+0x00,0x1F,0xFC,0x00,0x00,
+0x00,0x1F,0xFC,0x00,0x00,
+0x00,0x3F,0xF8,0x00,0x00,
+0x00,0x7F,0xF0,0x00,0x00,
+0x00,0x7F,0xF0,0x00,0x00,
+0x00,0xFF,0xE0,0x00,0x00,
+0x00,0xFF,0xC0,0x00,0x00,
+0x01,0xFF,0xC0,0x00,0x00,
+0x03,0xFF,0x80,0x00,0x00,
+0x03,0xFF,0x00,0x00,0x00,
+0x07,0xFF,0x00,0x00,0x00,
+0x0F,0xFE,0x00,0x00,0x00,
+0x0F,0xFE,0x00,0x00,0x00,
+0x1F,0xFC,0x00,0x00,0x00,
+0x3F,0xF8,0x00,0x00,0x00,
+0x3F,0xF8,0x00,0x00,0x00,
+0x7F,0xF0,0x00,0x00,0x00,
+0xFF,0xE0,0x00,0x00,0x00,
+0xFF,0xE0,0x00,0x00,0x00,
+0xFF,0xFF,0xFF,0xFF,0xC0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+0xFF,0xFF,0xFF,0xFF,0xE0,
+};
+
+static const sGLYPH PackedEuroFont9664_Glyphs[] = {
+    {0, 0, 0, 0, 0, 16},
+    {0, 1, 0, 29, 63, 31},
+    {252, 1, 26, 37, 8, 39},
+    {292, 1, 4, 33, 55, 35},
+    {567, 1, 4, 33, 55, 35},
+    {842, 1, 4, 33, 55, 35},
+    {1117, 1, 5, 32, 55, 34},
+    {1337, 1, 4, 33, 55, 35},
+    {1612, 1, 5, 32, 55, 34},
+    {1832, 1, 4, 33, 55, 35},
+    {2107, 1, 5, 32, 55, 34},
+    {2327, 1, 4, 33, 55, 35},
+    {2602, 1, 4, 33, 55, 35},
+    {2877, 1, 1, 33, 63, 35},
+    {3192, 1, 4, 35, 55, 37},
+    {3467, 1, 4, 35, 55, 37},
+    {3742, 1, 4, 35, 55, 37},
+    {4017, 1, 4, 35, 55, 37},
+    {4292, 1, 4, 35, 55, 37},
+    {4567, 1, 4, 35, 55, 37},
+    {4842, 1, 4, 35, 56, 37},
+    {5122, 1, 4, 35, 55, 37},
+    {5397, 1, 4, 27, 55, 29},
+    {5617, 1, 4, 35, 55, 37},
+    {5892, 1, 4, 35, 55, 37},
+    {6167, 1, 4, 35, 55, 37},
+    {6442, 1, 4, 35, 55, 37},
+    {6717, 1, 4, 35, 55, 37},
+    {6992, 1, 4, 35, 56, 37},
+    {7272, 1, 4, 35, 55, 37},
+    {7547, 1, 4, 35, 55, 37},
+    {7822, 1, 4, 35, 55, 37},
+    {8097, 1, 4, 35, 56, 37},
+    {8377, 1, 4, 35, 55, 37},
+    {8652, 1, 4, 35, 56, 37},
+    {8932, 1, 4, 35, 55, 37},
+    {9207, 1, 4, 35, 55, 37},
+    {9482, 1, 4, 35, 55, 37},
+    {9757, 1, 4, 35, 55, 37},
+    {10032, 1, 4, 35, 55, 37},
+};
+
+static const uint8_t PackedEuroFont9664_Codes[] = {
+    ' ', '!', '-', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'
+};
+
+static const uint8_t PackedEuroFont9664_Index[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39
+};
+
+sFONT PackedEuroFont9664 = {
+ PackedEuroFont9664_Table,
+ 96, // width 
+ 64, // Height
+ PackedEuroFont9664_Glyphs,
+ PackedEuroFont9664_Codes,
+ PackedEuroFont9664_Index,
+ 40  // characters
+};
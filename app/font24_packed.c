@@ -0,0 +1,278 @@
+#include "fonts.h"
+
+// Font 17x24, 19 characters " -.0123456789:Chimn", 19 glyphs in 450 bytes, 6840 bytes unpacked
+// Generated with tools/pack_font.py from EPD_4R2/Fonts/font24.c, do not edit
+static const uint8_t PackedFont24_Table[] = {
+0xFF,0xC0,
+0xFF,0xC0,
+0xF0,
+0xF0,
+0xF0,
+0x1E,0x00,
+0x3F,0x00,
+0x61,0x80,
+0x61,0x80,
+0xC0,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0x61,0x80,
+0x61,0x80,
+0x3F,0x00,
+0x1E,0x00,
+0x04,0x00,
+0x3C,0x00,
+0xFC,0x00,
+0xEC,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0xFF,0xC0,
+0xFF,0xC0,
+0x1F,0x00,
+0x7F,0xC0,
+0xE0,0xC0,
+0xC0,0x60,
+0xC0,0x60,
+0x00,0x60,
+0x00,0xC0,
+0x01,0x80,
+0x07,0x00,
+0x0E,0x00,
+0x18,0x00,
+0x30,0x00,
+0x60,0x00,
+0xFF,0xE0,
+0xFF,0xE0,
+0x1E,0x00,
+0x7F,0x00,
+0x63,0x80,
+0x01,0x80,
+0x01,0x80,
+0x03,0x00,
+0x1E,0x00,
+0x1F,0x00,
+0x03,0x80,
+0x00,0xC0,
+0x00,0xC0,
+0x00,0xC0,
+0xC1,0xC0,
+0xFF,0x80,
+0x7E,0x00,
+0x03,0x80,
+0x07,0x80,
+0x07,0x80,
+0x0D,0x80,
+0x19,0x80,
+0x19,0x80,
+0x31,0x80,
+0x31,0x80,
+0x61,0x80,
+0xC1,0x80,
+0xFF,0xE0,
+0xFF,0xE0,
+0x01,0x80,
+0x0F,0xE0,
+0x0F,0xE0,
+0x7F,0xC0,
+0x7F,0xC0,
+0x60,0x00,
+0x60,0x00,
+0x60,0x00,
+0x6F,0x00,
+0x7F,0xC0,
+0x70,0xC0,
+0x00,0x60,
+0x00,0x60,
+0x00,0x60,
+0x00,0x60,
+0xC0,0xC0,
+0xFF,0xC0,
+0x3F,0x00,
+0x07,0xC0,
+0x1F,0xC0,
+0x38,0x00,
+0x70,0x00,
+0x60,0x00,
+0xC0,0x00,
+0xDE,0x00,
+0xFF,0x80,
+0xE1,0x80,
+0xC0,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0x61,0xC0,
+0x7F,0x80,
+0x1F,0x00,
+0xFF,0xC0,
+0xFF,0xC0,
+0xC0,0xC0,
+0xC1,0xC0,
+0x01,0x80,
+0x01,0x80,
+0x03,0x80,
+0x03,0x00,
+0x03,0x00,
+0x07,0x00,
+0x06,0x00,
+0x06,0x00,
+0x0E,0x00,
+0x0C,0x00,
+0x0C,0x00,
+0x3F,0x00,
+0x7F,0x80,
+0xE1,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0x61,0x80,
+0x3F,0x00,
+0x3F,0x00,
+0x61,0x80,
+0xC0,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0xE1,0xC0,
+0x7F,0x80,
+0x3F,0x00,
+0x3E,0x00,
+0x7F,0x80,
+0xE1,0x80,
+0xC0,0xC0,
+0xC0,0xC0,
+0xC0,0xC0,
+0x61,0xC0,
+0x7F,0xC0,
+0x1E,0xC0,
+0x00,0xC0,
+0x01,0x80,
+0x03,0x80,
+0x07,0x00,
+0xFE,0x00,
+0xF8,0x00,
+0xF0,
+0xF0,
+0xF0,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0xF0,
+0xF0,
+0xF0,
+0x0F,0xB0,
+0x3F,0xF0,
+0x70,0x70,
+0x60,0x30,
+0xC0,0x30,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0xC0,0x00,
+0x60,0x30,
+0x70,0x70,
+0x3F,0xE0,
+0x0F,0xC0,
+0xF0,0x00,
+0xF0,0x00,
+0x30,0x00,
+0x30,0x00,
+0x37,0xC0,
+0x3F,0xE0,
+0x38,0x70,
+0x30,0x30,
+0x30,0x30,
+0x30,0x30,
+0x30,0x30,
+0x30,0x30,
+0x30,0x30,
+0xFC,0xFC,
+0xFC,0xFC,
+0x06,0x00,
+0x06,0x00,
+0x00,0x00,
+0x00,0x00,
+0x7E,0x00,
+0x7E,0x00,
+0x06,0x00,
+0x06,0x00,
+0x06,0x00,
+0x06,0x00,
+0x06,0x00,
+0x06,0x00,
+0x06,0x00,
+0xFF,0xF0,
+0xFF,0xF0,
+0xF7,0x78,
+0xFF,0xFC,
+0x39,0xCC,
+0x31,0x8C,
+0x31,0x8C,
+0x31,0x8C,
+0x31,0x8C,
+0x31,0x8C,
+0x31,0x8C,
+0xFD,0xEF,
+0xFD,0xEF,
+0xF7,0xC0,
+0xFF,0xE0,
+0x38,0x70,
+0x30,0x30,
+0x30,0x30,
+0x30,0x30,
+0x30,0x30,
+0x30,0x30,
+0x30,0x30,
+0xFC,0xFC,
+0xFC,0xFC,
+};
+
+static const sGLYPH PackedFont24_Glyphs[] = {
+    {0, 0, 0, 0, 0, 4},
+    {0, 1, 9, 10, 2, 12},
+    {4, 1, 14, 4, 3, 6},
+    {7, 1, 2, 10, 15, 12},
+    {37, 1, 2, 10, 15, 12},
+    {67, 1, 2, 11, 15, 13},
+    {97, 1, 2, 10, 15, 12},
+    {127, 1, 2, 11, 15, 13},
+    {157, 1, 2, 11, 15, 13},
+    {187, 1, 2, 10, 15, 12},
+    {217, 1, 2, 10, 15, 12},
+    {247, 1, 2, 10, 15, 12},
+    {277, 1, 2, 10, 15, 12},
+    {307, 1, 6, 4, 11, 6},
+    {318, 1, 3, 12, 14, 14},
+    {346, 1, 2, 14, 15, 16},
+    {376, 1, 2, 12, 15, 14},
+    {406, 1, 6, 16, 11, 18},
+    {428, 1, 6, 14, 11, 16},
+};
+
+static const uint8_t PackedFont24_Codes[] = {
+    ' ', '-', '.', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', 'C', 'h', 'i', 'm', 'n'
+};
+
+static const uint8_t PackedFont24_Index[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18
+};
+
+sFONT PackedFont24 = {
+ PackedFont24_Table,
+ 17, // width 
+ 24, // Height
+ PackedFont24_Glyphs,
+ PackedFont24_Codes,
+ PackedFont24_Index,
+ 19  // characters
+};
@@ -0,0 +1,420 @@
+#include "fonts.h"
+
+// Font 40x40, 13 characters " .0123456789:", 13 glyphs in 1293 bytes, 18600 bytes unpacked
+// Generated with tools/pack_font.py from EPD_4R2/Fonts/Font4040.c, do not edit
+static const uint8_t PackedFont4040_Table[] = {
+0xFC,
+0xFC,
+0xFC,
+0xFC,
+0xFC,
+0x00,0x7F,0x80,0x00,
+0x01,0xFF,0xE0,0x00,
+0x07,0xFF,0xF8,0x00,
+0x0F,0xFF,0xFC,0x00,
+0x1F,0xE1,0xFE,0x00,
+0x1F,0x80,0x7E,0x00,
+0x3F,0x00,0x3F,0x00,
+0x3E,0x00,0x1F,0x00,
+0x7E,0x00,0x1F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7E,0x00,0x1F,0x80,
+0x3E,0x00,0x1F,0x00,
+0x3F,0x00,0x3F,0x00,
+0x1F,0x80,0x7E,0x00,
+0x1F,0xE1,0xFE,0x00,
+0x0F,0xFF,0xFC,0x00,
+0x07,0xFF,0xF8,0x00,
+0x01,0xFF,0xE0,0x00,
+0x00,0x7F,0x80,0x00,
+0x00,0x3C,
+0x01,0xFC,
+0x07,0xFC,
+0x7F,0xFC,
+0xFF,0xFC,
+0x7F,0x7C,
+0x70,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7C,
+0x00,0x7F,0xC0,0x00,
+0x03,0xFF,0xF0,0x00,
+0x07,0xFF,0xFC,0x00,
+0x0F,0xFF,0xFE,0x00,
+0x1F,0xE0,0xFE,0x00,
+0x3F,0x80,0x3F,0x00,
+0x3F,0x00,0x1F,0x00,
+0x7E,0x00,0x1F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x3C,0x00,0x0F,0x80,
+0x00,0x00,0x0F,0x80,
+0x00,0x00,0x0F,0x80,
+0x00,0x00,0x1F,0x00,
+0x00,0x00,0x1F,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x7E,0x00,
+0x00,0x01,0xFC,0x00,
+0x00,0x03,0xF0,0x00,
+0x00,0x0F,0xE0,0x00,
+0x00,0x1F,0xC0,0x00,
+0x00,0x7F,0x00,0x00,
+0x00,0xFC,0x00,0x00,
+0x01,0xF8,0x00,0x00,
+0x03,0xF0,0x00,0x00,
+0x07,0xC0,0x00,0x00,
+0x0F,0x80,0x00,0x00,
+0x1F,0x00,0x00,0x00,
+0x3E,0x00,0x00,0x00,
+0x3E,0x00,0x00,0x00,
+0x7C,0x00,0x00,0x00,
+0x7C,0x00,0x00,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0x00,0xFF,0x80,
+0x07,0xFF,0xE0,
+0x0F,0xFF,0xF8,
+0x3F,0x81,0xFC,
+0x7F,0x00,0x7E,
+0x7E,0x00,0x3E,
+0x7C,0x00,0x1F,
+0x18,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x3F,
+0x00,0x00,0x7E,
+0x00,0x00,0xFC,
+0x00,0x03,0xF8,
+0x01,0xFF,0xF0,
+0x01,0xFF,0x80,
+0x01,0xFF,0xC0,
+0x01,0xFF,0xF0,
+0x00,0x01,0xFC,
+0x00,0x00,0x7E,
+0x00,0x00,0x3E,
+0x00,0x00,0x3F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x70,0x00,0x3F,
+0xF8,0x00,0x3F,
+0xFC,0x00,0x7E,
+0xFF,0x81,0xFE,
+0x7F,0xFF,0xFC,
+0x1F,0xFF,0xF8,
+0x0F,0xFF,0xE0,
+0x01,0xFF,0x80,
+0x00,0x00,0x7E,0x00,
+0x00,0x00,0xFE,0x00,
+0x00,0x00,0xFE,0x00,
+0x00,0x01,0xFE,0x00,
+0x00,0x03,0xFE,0x00,
+0x00,0x07,0xFE,0x00,
+0x00,0x07,0xFE,0x00,
+0x00,0x0F,0xBE,0x00,
+0x00,0x1F,0x3E,0x00,
+0x00,0x3F,0x3E,0x00,
+0x00,0x3E,0x3E,0x00,
+0x00,0x7C,0x3E,0x00,
+0x00,0xF8,0x3E,0x00,
+0x01,0xF8,0x3E,0x00,
+0x01,0xF0,0x3E,0x00,
+0x03,0xE0,0x3E,0x00,
+0x07,0xC0,0x3E,0x00,
+0x0F,0xC0,0x3E,0x00,
+0x0F,0x80,0x3E,0x00,
+0x1F,0x00,0x3E,0x00,
+0x3E,0x00,0x3E,0x00,
+0x7E,0x00,0x3E,0x00,
+0x7C,0x00,0x3E,0x00,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0xFF,0xFF,0xFF,0xF8,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x3E,0x00,
+0x1F,0xFF,0xFE,
+0x3F,0xFF,0xFE,
+0x3F,0xFF,0xFE,
+0x3F,0xFF,0xFE,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3E,0x00,0x00,
+0x3C,0x00,0x00,
+0x3C,0x00,0x00,
+0x7C,0x00,0x00,
+0x7C,0x00,0x00,
+0x7C,0x00,0x00,
+0x7C,0x7F,0x80,
+0x7D,0xFF,0xE0,
+0x7F,0xFF,0xF0,
+0x7F,0x83,0xF8,
+0x7E,0x00,0xFC,
+0x7C,0x00,0x7E,
+0xF8,0x00,0x3E,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x1F,
+0x00,0x00,0x3F,
+0x00,0x00,0x3E,
+0x78,0x00,0x7E,
+0xFC,0x00,0xFE,
+0xFF,0x03,0xFC,
+0x7F,0xFF,0xF8,
+0x3F,0xFF,0xF0,
+0x0F,0xFF,0xE0,
+0x01,0xFF,0x00,
+0x00,0x3F,0xC0,0x00,
+0x01,0xFF,0xF8,0x00,
+0x03,0xFF,0xFC,0x00,
+0x07,0xFF,0xFE,0x00,
+0x0F,0xE0,0x7F,0x00,
+0x1F,0x80,0x1E,0x00,
+0x1F,0x00,0x00,0x00,
+0x3E,0x00,0x00,0x00,
+0x3E,0x00,0x00,0x00,
+0x7C,0x00,0x00,0x00,
+0x7C,0x00,0x00,0x00,
+0x7C,0x00,0x00,0x00,
+0x78,0x00,0x00,0x00,
+0xF8,0x3F,0xC0,0x00,
+0xF9,0xFF,0xF0,0x00,
+0xFB,0xFF,0xF8,0x00,
+0xFF,0xE0,0xFC,0x00,
+0xFF,0x80,0x7E,0x00,
+0xFF,0x00,0x3F,0x00,
+0xFE,0x00,0x1F,0x00,
+0xFE,0x00,0x0F,0x80,
+0xFC,0x00,0x0F,0x80,
+0xFC,0x00,0x0F,0x80,
+0xFC,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7E,0x00,0x1F,0x80,
+0x3E,0x00,0x1F,0x00,
+0x3F,0x00,0x3F,0x00,
+0x1F,0x80,0x7F,0x00,
+0x1F,0xE0,0xFE,0x00,
+0x0F,0xFF,0xFC,0x00,
+0x07,0xFF,0xF8,0x00,
+0x01,0xFF,0xF0,0x00,
+0x00,0x7F,0x80,0x00,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0xFF,0xFF,0xFF,0x80,
+0x00,0x00,0x1F,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x7C,0x00,
+0x00,0x00,0x7C,0x00,
+0x00,0x00,0xF8,0x00,
+0x00,0x01,0xF8,0x00,
+0x00,0x01,0xF0,0x00,
+0x00,0x03,0xF0,0x00,
+0x00,0x03,0xE0,0x00,
+0x00,0x07,0xE0,0x00,
+0x00,0x07,0xC0,0x00,
+0x00,0x0F,0xC0,0x00,
+0x00,0x0F,0x80,0x00,
+0x00,0x1F,0x80,0x00,
+0x00,0x1F,0x00,0x00,
+0x00,0x1F,0x00,0x00,
+0x00,0x3F,0x00,0x00,
+0x00,0x3E,0x00,0x00,
+0x00,0x7E,0x00,0x00,
+0x00,0x7C,0x00,0x00,
+0x00,0x7C,0x00,0x00,
+0x00,0xFC,0x00,0x00,
+0x00,0xF8,0x00,0x00,
+0x01,0xF8,0x00,0x00,
+0x01,0xF8,0x00,0x00,
+0x01,0xF0,0x00,0x00,
+0x03,0xF0,0x00,0x00,
+0x03,0xF0,0x00,0x00,
+0x03,0xF0,0x00,0x00,
+0x03,0xE0,0x00,0x00,
+0x00,0xFF,0x80,0x00,
+0x03,0xFF,0xF0,0x00,
+0x0F,0xFF,0xF8,0x00,
+0x1F,0xC0,0xFC,0x00,
+0x1F,0x00,0x3E,0x00,
+0x3E,0x00,0x1F,0x00,
+0x7E,0x00,0x1F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7C,0x00,0x0F,0x80,
+0x7E,0x00,0x1F,0x00,
+0x3F,0x00,0x3F,0x00,
+0x3F,0x80,0x7E,0x00,
+0x1F,0xF3,0xFC,0x00,
+0x07,0xFF,0xF8,0x00,
+0x03,0xFF,0xC0,0x00,
+0x01,0xFF,0xE0,0x00,
+0x07,0xF3,0xF8,0x00,
+0x1F,0x80,0x7C,0x00,
+0x3F,0x00,0x3F,0x00,
+0x7E,0x00,0x1F,0x80,
+0x7C,0x00,0x0F,0x80,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xF8,0x00,0x07,0xC0,
+0xFC,0x00,0x0F,0xC0,
+0x7C,0x00,0x1F,0x80,
+0x7F,0x00,0x3F,0x80,
+0x3F,0xC0,0xFF,0x00,
+0x1F,0xFF,0xFE,0x00,
+0x07,0xFF,0xF8,0x00,
+0x00,0xFF,0xC0,0x00,
+0x00,0xFF,0x00,0x00,
+0x07,0xFF,0xE0,0x00,
+0x0F,0xFF,0xF0,0x00,
+0x1F,0xC3,0xF8,0x00,
+0x3F,0x00,0xFC,0x00,
+0x7E,0x00,0x7C,0x00,
+0x7C,0x00,0x3E,0x00,
+0x7C,0x00,0x3E,0x00,
+0xF8,0x00,0x1F,0x00,
+0xF8,0x00,0x1F,0x00,
+0xF8,0x00,0x1F,0x00,
+0xF8,0x00,0x1F,0x80,
+0xF8,0x00,0x1F,0x80,
+0xF8,0x00,0x1F,0x80,
+0xFC,0x00,0x3F,0x80,
+0x7C,0x00,0x3F,0x80,
+0x7E,0x00,0x7F,0x80,
+0x3F,0x00,0xFF,0x80,
+0x1F,0x83,0xFF,0x80,
+0x0F,0xFF,0xFF,0x80,
+0x07,0xFF,0x9F,0x80,
+0x01,0xFE,0x1F,0x80,
+0x00,0x00,0x1F,0x00,
+0x00,0x00,0x1F,0x00,
+0x00,0x00,0x3F,0x00,
+0x00,0x00,0x3F,0x00,
+0x00,0x00,0x3E,0x00,
+0x00,0x00,0x7E,0x00,
+0x18,0x00,0xFC,0x00,
+0x7C,0x01,0xFC,0x00,
+0xFF,0x07,0xF8,0x00,
+0x7F,0xFF,0xF0,0x00,
+0x3F,0xFF,0xE0,0x00,
+0x0F,0xFF,0xC0,0x00,
+0x03,0xFE,0x00,0x00,
+0xFC,
+0xFC,
+0xFC,
+0xFC,
+0xFC,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0xFC,
+0xFC,
+0xFC,
+0xFC,
+0xFC,
+};
+
+static const sGLYPH PackedFont4040_Glyphs[] = {
+    {0, 0, 0, 0, 0, 10},
+    {0, 2, 26, 6, 5, 10},
+    {5, 2, 1, 26, 35, 30},
+    {145, 2, 1, 14, 35, 18},
+    {215, 2, 1, 25, 35, 29},
+    {355, 2, 1, 24, 35, 28},
+    {460, 2, 1, 29, 35, 33},
+    {600, 2, 1, 24, 35, 28},
+    {705, 2, 1, 25, 35, 29},
+    {845, 2, 1, 25, 35, 29},
+    {985, 2, 1, 26, 36, 30},
+    {1129, 2, 1, 25, 35, 29},
+    {1269, 2, 6, 6, 24, 10},
+};
+
+static const uint8_t PackedFont4040_Codes[] = {
+    ' ', '.', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':'
+};
+
+static const uint8_t PackedFont4040_Index[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12
+};
+
+sFONT PackedFont4040 = {
+ PackedFont4040_Table,
+ 40, // width 
+ 40, // Height
+ PackedFont4040_Glyphs,
+ PackedFont4040_Codes,
+ PackedFont4040_Index,
+ 13  // characters
+};
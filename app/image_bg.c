@@ -1,905 +1,547 @@
-#include <stdint.h>
-
-// Image 400x300 background
-extern const uint8_t ppm_image_bg[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x01,0xE0,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x18,0x01,0xFF,0xFF,0xFF,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xE0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xF0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xF8,0x00,0x18,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFC,0x00,0x18,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFE,0x00,0x18,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFE,0x00,0x18,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFF,0x00,0x18,0x00,0x00,0x46,0x40,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x0F,0xFF,0x00,0x18,0x00,0x00,0xEE,0xE8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x03,0xFF,0x00,0x18,0x00,0x00,0xE6,0xDC,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x01,0xFF,0x80,0x18,0x00,0x00,0xE0,0x0B,0x0E,0x60,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9C,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x01,0xFF,0x80,0x18,0x00,0x00,0x03,0x23,0x9E,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8C,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x01,0xFF,0x80,0x18,0x00,0x00,0x77,0x61,0x9E,0xF0,0x00,0x00,0x0F,0xE0,0x03,0xFF,
-0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8C,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x7F,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x01,0xFF,0x80,0x18,0x00,0x04,0xF7,0x6C,0x0C,0x70,0x06,0x00,0x1F,0xF0,0x07,0xFF,
-0xF0,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x01,0xFF,0x80,0x18,0x00,0x0F,0x70,0x0F,0x00,0x00,0x06,0x00,0x70,0x1C,0x00,0x0C,
-0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x8C,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x01,0xFF,0x80,0x18,0x00,0x0F,0x00,0x03,0x9C,0x00,0x06,0x00,0xE0,0x0E,0x00,0x0C,
-0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x03,0x8C,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xC0,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x01,0xFF,0x80,0x18,0x00,0x0F,0x09,0xD8,0x1E,0xE0,0x06,0x00,0xC0,0x06,0x00,0x0C,
-0x00,0x0C,0x80,0x00,0x00,0x00,0x00,0x03,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF0,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x01,0xFF,0x80,0x18,0x00,0x04,0x1D,0xD9,0x1C,0xE6,0x06,0x01,0x80,0x03,0x00,0x0C,
-0x00,0x0C,0xC0,0x00,0x00,0x00,0x00,0x03,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x03,0xFF,0x80,0x18,0x00,0x01,0xBD,0xDB,0x08,0xEF,0x06,0x01,0x80,0x03,0x00,0x0C,
-0x00,0x0C,0x40,0x00,0x00,0x00,0x00,0x03,0xAC,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x07,0xFF,0x00,0x18,0x00,0x03,0xDC,0x03,0x30,0x0F,0x06,0x03,0x00,0x01,0x00,0x0C,
-0x00,0x18,0x60,0x00,0x00,0x00,0x00,0x03,0xFC,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFF,0x00,0x18,0x00,0x07,0xC0,0x00,0x39,0x86,0x06,0x03,0x00,0x01,0x80,0x0C,
-0x00,0x18,0x60,0x00,0x00,0x00,0x00,0x03,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFF,0x00,0x18,0x00,0x33,0x80,0xC0,0x39,0xC8,0x06,0x03,0x00,0x01,0x80,0x0C,
-0x00,0x18,0x20,0x00,0x00,0x00,0x00,0x03,0xFC,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFE,0x00,0x18,0x00,0x78,0x01,0xC0,0x01,0x9C,0x06,0x03,0x00,0x01,0x80,0x0C,
-0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x01,0xFC,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFC,0x00,0x18,0x00,0xF8,0x2E,0x00,0xE2,0x1C,0x06,0x03,0x00,0x01,0x80,0x0C,
-0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x03,0xFC,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xFC,0x00,0x18,0x00,0xF8,0x24,0xC0,0xE7,0x08,0x06,0x03,0x00,0x01,0x80,0x0C,
-0x00,0x20,0x18,0x00,0x00,0x00,0x00,0x07,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xF8,0x00,0x18,0x00,0x70,0x04,0xE3,0x06,0x60,0x06,0x03,0x00,0x01,0x00,0x0C,
-0x00,0x60,0x18,0x00,0x00,0x00,0x00,0x0E,0x77,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0xE0,0x00,0x18,0x00,0x00,0x6E,0xC3,0x18,0x70,0x06,0x01,0x80,0x03,0x00,0x0C,
-0x00,0x40,0x18,0x00,0x00,0x00,0x00,0x0D,0xF9,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFF,0x80,0x00,0x18,0x00,0x00,0x24,0x30,0x59,0xE0,0x06,0x01,0x80,0x03,0x00,0x0C,
-0x00,0xC0,0x0C,0x00,0x00,0x00,0x00,0x1F,0xFD,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xF8,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0xFF,0xFC,0x00,0x00,0x18,0x00,0x00,0x66,0x78,0x61,0x80,0x06,0x00,0xC0,0x06,0x00,0x0C,
-0x00,0xC0,0x0C,0x00,0x00,0x00,0x00,0x1B,0xFE,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xE0,0x00,0x00,0x00,0x01,0xC0,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x67,0x30,0x16,0x80,0x06,0x00,0xE0,0x0E,0x00,0x0C,
-0x01,0x80,0x0C,0x00,0x00,0x00,0x00,0x1B,0xFE,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x06,0x06,0x1E,0x00,0x06,0x00,0x70,0x1C,0x00,0x0C,
-0x01,0x80,0x06,0x00,0x00,0x00,0x00,0x1B,0xFE,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x31,0x8F,0x00,0x00,0x06,0x00,0x1F,0xF0,0x00,0x0C,
-0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x1B,0xFE,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x7F,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x73,0xCF,0x00,0x00,0x00,0x00,0x07,0xC0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0xFD,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x23,0x86,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0xFD,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x0C,0x20,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x73,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x70,0xF3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x70,0xE7,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x03,0xF7,0x07,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x03,0x87,0x87,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x03,0x87,0x83,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x10,0x01,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x18,0x01,0xFF,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x18,0x01,0xFF,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x01,0x80,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0xE0,0x00,0x0F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x7F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0xFF,0xF0,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x01,0xFF,0xF9,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x01,0xFF,0xF8,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0xFF,0xCC,0x7F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0xFF,0x9C,0x03,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x07,0xFC,0x1F,0xFF,0xF0,0x3F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0x3F,0x3C,0x00,0x7E,0x00,0x00,0x00,0x01,0xC0,0x00,0x00,0x70,0x00,0x00,0x0F,0xF0,0x00,0x07,
-0xF0,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x00,0x00,
-0x07,0x00,0x00,0x70,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x07,0x1E,0x7C,0x00,0x3F,0x00,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0x3F,0xFC,0x00,0x1F,
-0xFC,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x3F,0xFC,0x00,0x3F,0xFC,0x00,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x07,0x8C,0xFC,0x7C,0x0F,0x80,0x00,0x00,0x07,0xC0,0x00,0x01,0xF0,0x00,0x00,0x7F,0xFE,0x00,0x3F,
-0xFE,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x7F,0xFE,0x00,0x7F,0xFE,0x00,0x00,0x00,
-0x1F,0x00,0x01,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0xC1,0xFC,0x1F,0x07,0xC0,0x00,0x00,0x0F,0xC0,0x00,0x01,0xF0,0x00,0x00,0xFF,0xFF,0x00,0x7F,
-0xFF,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,
-0x3F,0x00,0x03,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0xE3,0xFC,0x03,0xC3,0xE0,0x00,0x00,0x1F,0xC0,0x00,0x03,0xF0,0x00,0x00,0xF8,0x0F,0x00,0xF8,
-0x0F,0x80,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x01,0xF0,0x1F,0x01,0xF0,0x0F,0x00,0x00,0x00,
-0x7F,0x00,0x07,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0xF7,0xFC,0x00,0xE1,0xE0,0x00,0x00,0x3F,0xC0,0x00,0x07,0xF0,0x00,0x01,0xF0,0x07,0x80,0xF0,
-0x07,0x80,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x01,0xE0,0x07,0x81,0xE0,0x07,0x80,0x00,0x00,
-0xFF,0x00,0x0F,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x01,0xFF,0xF8,0xE0,0x30,0xF0,0x00,0x00,0xFF,0xC0,0x00,0x07,0xF0,0x00,0x01,0xE0,0x07,0x80,0xE0,
-0x03,0x80,0x00,0x00,0x07,0xFF,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x03,0xC0,0x07,0x83,0xC0,0x07,0x80,0x00,0x03,
-0xFF,0x00,0x1F,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0xFF,0xF0,0xE0,0x18,0xF0,0x00,0x01,0xFB,0xC0,0x00,0x0F,0xF0,0x00,0x03,0xC0,0x07,0x81,0xE0,
-0x03,0xC0,0x00,0x00,0x07,0xFF,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x03,0xC0,0x03,0xC3,0xC0,0x07,0x80,0x00,0x07,
-0xEF,0x00,0x7E,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x7F,0xE1,0xE0,0x18,0x78,0x00,0x03,0xF3,0xC0,0x00,0x1E,0xF0,0x07,0x80,0x40,0x07,0x81,0xE0,
-0x01,0xC0,0x00,0x00,0x07,0xFF,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x03,0xC0,0x03,0xC3,0x80,0x00,0x00,0x00,0x0F,
-0xCF,0x00,0xFC,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x02,0x3F,0xC1,0xE0,0x0C,0x78,0x00,0x03,0xC3,0xC0,0x00,0x3C,0xF0,0x07,0x00,0x00,0x07,0x81,0xC0,
-0x01,0xC0,0x00,0x00,0x07,0xFF,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x00,0x80,0x03,0xC3,0x80,0x00,0x00,0x00,0x0F,
-0x0F,0x00,0xF0,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x06,0x06,0x01,0xE0,0x04,0x78,0x00,0x03,0x03,0xC0,0x00,0x7C,0xF0,0x07,0x80,0x00,0x07,0x01,0xC0,
-0x01,0xC0,0x00,0x00,0x07,0xFF,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x00,0x00,0x03,0x87,0x80,0x00,0x00,0x00,0x0C,
-0x0F,0x00,0xE0,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x0F,0x00,0x01,0xE0,0x06,0x3C,0x00,0x00,0x03,0xC0,0x00,0x78,0xF0,0x07,0x00,0x00,0x1F,0x01,0xC0,
-0x01,0xE0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x07,0x87,0x8F,0xF8,0x00,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x0F,0x80,0x01,0xE0,0x06,0x3C,0x00,0x00,0x03,0xC0,0x00,0xF0,0xF0,0x00,0x00,0x01,0xFE,0x03,0xC0,
-0x01,0xE0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x07,0x87,0x9F,0xFC,0x00,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x1F,0x80,0x01,0xE0,0x02,0x3C,0x00,0x00,0x03,0xC0,0x01,0xF0,0xF0,0x00,0x00,0x03,0xFC,0x03,0xC0,
-0x01,0xE0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x0F,0x07,0xBF,0xFE,0x00,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x3F,0xC0,0x01,0xE0,0x02,0x3C,0x00,0x00,0x03,0xC0,0x01,0xE0,0xF0,0x00,0x00,0x03,0xFE,0x03,0xC0,
-0x01,0xE0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x1F,0x07,0xFE,0x7F,0x00,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x3F,0xF0,0x01,0xE0,0x03,0x3C,0x00,0x00,0x03,0xC0,0x03,0xC0,0xF0,0x00,0x00,0x03,0xFF,0x03,0xC0,
-0x01,0xE0,0x00,0x00,0x07,0xC3,0xF0,0x7E,0x1F,0x83,0xE0,0x00,0x00,0x00,0x3E,0x07,0xE0,0x0F,0x80,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x0F,0x98,0x00,0xE0,0x03,0x3C,0x00,0x00,0x03,0xC0,0x07,0x80,0xF0,0x00,0x00,0x00,0x0F,0x83,0xC0,
-0x01,0xE0,0x00,0x00,0x07,0x81,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x00,0x00,0x7C,0x07,0xC0,0x07,0x80,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x07,0x18,0x01,0xE0,0x02,0x3C,0x00,0x00,0x03,0xC0,0x0F,0x80,0xF0,0x00,0x00,0x00,0x03,0xC3,0xC0,
-0x01,0xE0,0x00,0x00,0x07,0x81,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x00,0x00,0xF8,0x07,0x80,0x03,0xC0,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x07,0x98,0x03,0xE0,0x02,0x3C,0x00,0x00,0x03,0xC0,0x0F,0x00,0xF0,0x00,0x00,0x00,0x03,0xC3,0xC0,
-0x01,0xE0,0x00,0x00,0x07,0x81,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x00,0x01,0xF0,0x07,0x80,0x03,0xC0,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x07,0x98,0x07,0xC0,0x06,0x3C,0x00,0x00,0x03,0xC0,0x1E,0x00,0xF0,0x00,0x00,0x00,0x01,0xE1,0xC0,
-0x01,0xC0,0x00,0x00,0x07,0x81,0xF0,0x7C,0x0F,0x83,0xE0,0x00,0x00,0x03,0xE0,0x07,0x80,0x03,0xC0,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x07,0x8C,0x0F,0x80,0x06,0x3C,0x00,0x00,0x03,0xC0,0x3F,0xFF,0xFE,0x00,0x00,0x00,0x01,0xE1,0xC0,
-0x01,0xC0,0x00,0x00,0x07,0xC3,0xF8,0xFE,0x1F,0xC3,0xE0,0x00,0x00,0x07,0xC0,0x07,0x80,0x03,0xC0,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x07,0x8C,0x1F,0x00,0x04,0x78,0x00,0x00,0x03,0xC0,0x3F,0xFF,0xFF,0x00,0x00,0x00,0x01,0xE1,0xC0,
-0x01,0xC0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x0F,0x80,0x07,0x80,0x03,0xC0,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0xC6,0x3E,0x00,0x0C,0x78,0x00,0x00,0x03,0xC0,0x3F,0xFF,0xFF,0x00,0x03,0xC0,0x01,0xE1,0xC0,
-0x01,0xC0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x1F,0x00,0x07,0x80,0x03,0xC0,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0xC6,0x3C,0x00,0x18,0x78,0x00,0x00,0x03,0xC0,0x3F,0xFF,0xFF,0x00,0x03,0xC0,0x01,0xE1,0xE0,
-0x03,0xC0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x3E,0x00,0x03,0x80,0x03,0xC0,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x03,0xE3,0x38,0x00,0x18,0xF0,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x01,0xE0,0x01,0xC1,0xE0,
-0x03,0xC0,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x78,0x00,0x03,0xC0,0x03,0xC0,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x01,0xE1,0x80,0x00,0x30,0xF0,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x01,0xE0,0x03,0xC0,0xF0,
-0x07,0x80,0x00,0x00,0x07,0x81,0xF0,0x7C,0x0F,0xFF,0xE0,0x00,0x00,0xF0,0x00,0x03,0xC0,0x07,0x80,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x01,0xF0,0xC0,0x00,0x61,0xE0,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x07,0x80,0xF8,
-0x0F,0x80,0x00,0x00,0x07,0x81,0xF0,0x7C,0x0F,0xFF,0xE0,0x00,0x01,0xE0,0x00,0x01,0xE0,0x0F,0x80,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0xF8,0x70,0x01,0xC3,0xE0,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0xFC,0x1F,0x80,0x7E,
-0x1F,0x00,0x00,0x00,0x07,0x81,0xF0,0x7C,0x0F,0xFF,0xE0,0x00,0x03,0xE0,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,
-0x0F,0x00,0x00,0xF0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x7C,0x3E,0x0F,0x07,0xC0,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x07,0x80,0x7F,0xFF,0x00,0x7F,
-0xFF,0x00,0x00,0x00,0x07,0x81,0xF0,0x7C,0x0F,0xFF,0xE0,0x00,0x03,0xFF,0xFF,0xC0,0x7F,0xFE,0x01,0xE0,0x00,
-0x0F,0x00,0x00,0xF0,0x01,0xE0,0x00,0x00, 
-0x00,0x00,0x00,0x7E,0x0F,0xFE,0x0F,0x80,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x07,0x00,0x3F,0xFE,0x00,0x3F,
-0xFE,0x00,0x00,0x00,0x07,0xC1,0xF0,0x7E,0x0F,0xFF,0xE0,0x00,0x07,0xFF,0xFF,0xC0,0x3F,0xFC,0x01,0xE0,0x00,
-0x0F,0x00,0x00,0xF0,0x01,0xE0,0x00,0x00, 
-0x00,0x00,0x00,0x3F,0x00,0xE0,0x3F,0x80,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x07,0x80,0x0F,0xF8,0x00,0x0F,
-0xF8,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x07,0xFF,0xFF,0xC0,0x1F,0xF8,0x01,0xE0,0x00,
-0x0F,0x00,0x00,0xF0,0x01,0xE0,0x00,0x00, 
-0x00,0x00,0x00,0x1F,0xC0,0x00,0x7F,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x70,0x07,0x00,0x01,0xC0,0x00,0x01,
-0xC0,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x07,0xFF,0xFF,0x80,0x01,0x80,0x00,0xE0,0x00,
-0x0E,0x00,0x00,0xF0,0x01,0xE0,0x00,0x00, 
-0x00,0x00,0x00,0x0F,0xF8,0x03,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x03,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x01,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x7F,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x0F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC0,0x00,0x07,0xC0,0x00,0x07,0xC0,
-0x00,0x07,0xC0,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xF8,0x00,0x1F,0xF8,0x00,0x3F,0xF8,
-0x00,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFC,0x00,0x3F,0xFC,0x00,0x7F,0xFC,
-0x00,0x7F,0xFC,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x7F,0xFE,0x00,0xFF,0xFE,
-0x00,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x1F,0x00,0xF8,0x1F,0x01,0xF0,0x1F,
-0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xE0,0x0F,0x81,0xF0,0x0F,0x03,0xE0,0x0F,
-0x01,0xE0,0x0F,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x07,0x81,0xE0,0x07,0x83,0xC0,0x07,
-0x81,0xE0,0x07,0x80,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x03,0x81,0xE0,0x07,0x83,0xC0,0x07,
-0x83,0xC0,0x07,0x80,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x03,0xC3,0xC0,0x03,0x83,0x80,0x07,
-0x83,0xC0,0x07,0x80,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x03,0xC3,0xC0,0x03,0xC3,0x80,0x07,
-0x83,0xC0,0x03,0x80,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x83,0xC0,0x03,0xC0,0x00,0x07,
-0x83,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x83,0xC0,0x03,0xC0,0x00,0x07,
-0x83,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x83,0xC0,0x03,0xC0,0x00,0x07,
-0x83,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x03,0xC0,0x03,0xC0,0x00,0x0F,
-0x07,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x03,0xC0,0x03,0xC0,0x00,0x1F,
-0x07,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x03,0xC0,0x03,0xC0,0x00,0x3E,
-0x07,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x03,0xC0,0x03,0xC0,0x00,0x7C,
-0x07,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x03,0xC0,0x03,0xC0,0x00,0xF8,
-0x07,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0xC0,0x03,0xC0,0x01,0xF0,
-0x07,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xE0,0x03,0xC0,0x03,0xC0,0x01,0xE0,
-0x03,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x07,0xC0,
-0x03,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x80,0x03,0xC0,0x03,0xC0,0x0F,0x80,
-0x03,0x80,0x03,0xC0,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x03,0xC0,0x03,0xC0,0x1F,0x00,
-0x03,0xC0,0x03,0x80,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x03,0xC0,0x03,0xC0,0x3E,0x00,
-0x03,0xC0,0x03,0x80,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x01,0xC0,0x07,0x80,0x7C,0x00,
-0x03,0xC0,0x07,0x80,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xE0,0x07,0x80,0xF0,0x00,
-0x01,0xE0,0x07,0x80,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x00,0x01,0xF0,0x0F,0x81,0xE0,0x00,
-0x01,0xF0,0x0F,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xE0,0x00,0x00,0xF8,0x1F,0x03,0xC0,0x00,
-0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xC0,0xFF,0xFE,0x03,0xFF,0xFF,
-0x80,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xC0,0x7F,0xFE,0x07,0xFF,0xFF,
-0x80,0x7F,0xFC,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xC0,0x1F,0xF8,0x07,0xFF,0xFF,
-0x80,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xC0,0x07,0xE0,0x07,0xFF,0xFF,
-0x80,0x07,0xC0,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x1F,0xC0,0x00,0x00,0x00,0x1F,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xF8,0x00,0x00,
-0x00,0x00,0x0F,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x07,0xFF,0x00,0x00,0x03,0xFF,0xFF,0xC0,0x00,0x00,0x3F,0xFC,
-0x00,0x00,0x0F,0xFF,0xFF,0x00,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x00,0x7F,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x3F,0xFF,0xE0,0x00,0x0F,0xFF,0xFF,0xF0,0x00,0x00,0xFF,0xFF,
-0x80,0x00,0x3F,0xFF,0xFF,0xC0,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x00,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0xFF,0xFF,0xF8,0x00,0x1F,0xFF,0xFF,0xF8,0x00,0x03,0xFF,0xFF,
-0xC0,0x00,0x7F,0xFF,0xFF,0xE0,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x01,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x01,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xFF,0xFC,0x00,0x0F,0xFF,0xFF,
-0xF0,0x00,0xFF,0xFF,0xFF,0xF0,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x03,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x03,0xFF,0xFF,0xFE,0x00,0x7F,0xFF,0xFF,0xFE,0x00,0x0F,0xFF,0xFF,
-0xF8,0x01,0xFF,0xFF,0xFF,0xF8,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x03,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x07,0xFF,0xFF,0xFE,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x1F,0xFF,0xFF,
-0xF8,0x03,0xFF,0xFF,0xFF,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x3F,0xFF,0xFF,
-0xFC,0x03,0xFF,0xFF,0xFF,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xF0,0x0F,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFF,0x00,0x0F,0xFC,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x80,0xFF,0xC0,0x03,0xFE,0x00,0x3F,0xFF,0xFF,
-0xFE,0x03,0xFE,0x00,0x0F,0xF8,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x03,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00,0x1F,0xFF,0xFF,0xFF,0x81,0xFF,0x80,0x01,0xFC,0x00,0x7F,0xFF,0xFF,
-0xFE,0x07,0xFE,0x00,0x07,0xF0,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x01,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x07,0xFC,0x00,0x00,0x1F,0xFE,0x03,0xFF,0x80,0xFF,0x80,0x01,0xF8,0x00,0x7F,0xF0,0x0F,
-0xFE,0x07,0xFE,0x00,0x07,0xE0,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x07,0xF8,0x00,0x00,0x1F,0xF8,0x01,0xFF,0xC0,0xFF,0x80,0x01,0xF0,0x00,0x7F,0xE0,0x07,
-0xFE,0x07,0xFE,0x00,0x07,0xC0,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x07,0xF8,0x00,0x00,0x1F,0xF0,0x00,0xFF,0xC0,0xFF,0x80,0x01,0xE1,0x00,0x7F,0xC0,0x03,
-0xFF,0x07,0xFE,0x00,0x07,0x84,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x07,0xF8,0x00,0x00,0x1F,0xF0,0x00,0xFF,0xC0,0xFF,0x80,0x01,0xC3,0x80,0x7F,0xC0,0x03,
-0xFF,0x07,0xFE,0x00,0x07,0x0C,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x3F,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x07,0xF8,0x00,0x00,0x1F,0xF0,0x00,0xFF,0xC0,0xFF,0x80,0x00,0x87,0x80,0x7F,0xC0,0x03,
-0xFF,0x07,0xFE,0x00,0x02,0x1C,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x3F,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x07,0xF8,0x00,0x00,0x1F,0xF0,0x00,0xFF,0xC0,0xFF,0x80,0x00,0x0F,0x80,0x7F,0xC0,0x03,
-0xFF,0x07,0xFE,0x00,0x00,0x3C,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x3F,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x07,0xF8,0x00,0x00,0x1F,0xE0,0x00,0xFF,0xC0,0xFF,0x80,0x00,0x1F,0x80,0x7F,0x80,0x03,
-0xFE,0x07,0xFE,0x00,0x00,0x7C,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x3F,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0xFF,0x80,0xFF,0x80,0x00,0x3F,0x80,0x00,0x00,0x03,
-0xFE,0x07,0xFE,0x00,0x00,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x80,0xFF,0x80,0x00,0x7F,0x80,0x00,0x00,0x03,
-0xFE,0x07,0xFE,0x00,0x01,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x80,0xFF,0x80,0x00,0xFF,0x80,0x00,0x00,0x03,
-0xFE,0x07,0xFE,0x00,0x03,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x80,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0x07,
-0xFE,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0x07,
-0xFC,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0x0F,
-0xFC,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x07,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0x0F,
-0xFC,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFE,0x00,0x3F,0xFF,0xFF,0xFF,0xFE,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFE,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0x1F,
-0xF8,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xFF,0xFF,0xFE,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFE,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0x3F,
-0xF8,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xF8,0x00,0x3F,0xFF,0xFF,0xFF,0xFE,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0x3F,
-0xF0,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xF8,0x00,0x3F,0xFF,0xFF,0xFF,0xFE,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFC,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0x7F,
-0xF0,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFE,0x00,0x3F,0xFF,0xFF,0xFF,0xFE,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xF8,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x00,0xFF,
-0xE0,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0x00,0x3F,0xFF,0xFF,0xFF,0xFE,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF8,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x01,0xFF,
-0xC0,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0x80,0x3F,0xFF,0xFF,0xFF,0xFE,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x03,0xFF,
-0xC0,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0xFF,0xC0,0x3F,0xFF,0xFF,0xFF,0xFC,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xE0,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x07,0xFF,
-0x80,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xC0,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x0F,0xFF,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x3F,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x80,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x1F,0xFE,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x1F,0xF0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x80,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x3F,0xFC,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0x7F,0xF8,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFE,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x00,0xFF,0xF0,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFC,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x01,0xFF,0xE0,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x00,0xFF,0x00,0x00,0x00,0x7F,0xF8,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x03,0xFF,0xE0,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0x00,0x07,0xFC,0x00,0x01,0xFF,0x00,0x00,0x00,0xFF,0xF0,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x07,0xFF,0x80,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x07,0xF8,0x3F,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0xFF,0x07,0xFC,0x00,0x01,0xFF,0x00,0x00,0x01,0xFF,0xE0,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x0F,0xFF,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x3F,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x01,
-0xFF,0x07,0xFC,0x00,0x01,0xFF,0x00,0x00,0x03,0xFF,0xC0,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x1F,0xFE,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x3F,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x01,
-0xFF,0x07,0xFC,0x00,0x01,0xFF,0x00,0x00,0x07,0xFF,0x80,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x1F,0xFC,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x3F,0xE0,0x00,0x0F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x01,
-0xFF,0x07,0xFE,0x00,0x01,0xFF,0x00,0x00,0x0F,0xFF,0x00,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x3F,0xF8,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x3F,0xE0,0x00,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x01,
-0xFF,0x07,0xFE,0x00,0x03,0xFF,0x00,0x00,0x1F,0xFC,0x00,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0x7F,0xF0,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x3F,0xE0,0x00,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x01,
-0xFF,0x07,0xFE,0x00,0x07,0xFF,0x00,0x00,0x3F,0xFC,0x00,0x00,0x00,0xFF,0x80,0x01,0xFF,0x80,0xFF,0xE0,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x3F,0xE0,0x00,0x3F,0xF0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x00,
-0xFF,0x03,0xFF,0x00,0x07,0xFE,0x00,0x00,0x7F,0xF8,0x00,0x00,0x00,0xFF,0x80,0x01,0xFF,0x81,0xFF,0xE0,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xE0,0x00,0x0F,0xF8,0x3F,0xE0,0x00,0x7F,0xF0,0x00,0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x01,
-0xFF,0x03,0xFF,0xC0,0x1F,0xFE,0x00,0x00,0x7F,0xF8,0x00,0x00,0x00,0xFF,0x80,0x01,0xFF,0x81,0xFF,0xC0,0x00,
-0x00,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFF,0x03,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0x80,0xFF,0x80,0x01,0xFF,0x83,0xFF,0xFF,0xFF,
-0xFE,0x07,0xFE,0x00,0x07,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFF,0x01,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xC0,0xFF,0xFF,0xFF,0xFF,0x83,0xFF,0xFF,0xFF,
-0xFE,0x07,0xFF,0xFF,0xFF,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFF,0x01,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xC0,0xFF,0xFF,0xFF,0xFF,0x03,0xFF,0xFF,0xFF,
-0xFF,0x03,0xFF,0xFF,0xFF,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFF,0x00,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xC0,0xFF,0xFF,0xFF,0xFF,0x03,0xFF,0xFF,0xFF,
-0xFF,0x03,0xFF,0xFF,0xFF,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFF,0x00,0x7F,0xFF,0xFF,0xF0,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xC0,0xFF,0xFF,0xFF,0xFF,0x03,0xFF,0xFF,0xFF,
-0xFF,0x03,0xFF,0xFF,0xFF,0xFC,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFF,0x00,0x3F,0xFF,0xFF,0xE0,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xC0,0x7F,0xFF,0xFF,0xFE,0x03,0xFF,0xFF,0xFF,
-0xFF,0x01,0xFF,0xFF,0xFF,0xF8,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFF,0x00,0x1F,0xFF,0xFF,0xC0,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xC0,0x3F,0xFF,0xFF,0xFC,0x03,0xFF,0xFF,0xFF,
-0xFF,0x00,0xFF,0xFF,0xFF,0xF0,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFF,0x00,0x0F,0xFF,0xFF,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xC0,0x1F,0xFF,0xFF,0xF8,0x03,0xFF,0xFF,0xFF,
-0xFF,0x00,0x7F,0xFF,0xFF,0xE0,0x00,0x00, 
-0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF0,0x3F,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,
-0xFE,0x00,0x03,0xFF,0xFC,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xC0,0x0F,0xFF,0xFF,0xF0,0x01,0xFF,0xFF,0xFF,
-0xFE,0x00,0x3F,0xFF,0xFF,0xC0,0x00,0x00, 
-0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xE0,0x1F,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,
-0xFC,0x00,0x00,0x3F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x0F,0xFF,0xFF,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00  
-};
\ No newline at end of file
+#include "PackedImage.h"
+
+// Image 400x300, 6843 bytes PackBits coded, 15000 bytes uncompressed
+// Generated with tools/pack_image.py, do not edit
+static const uint8_t ppm_image_bg_data[] = {
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xFF,0xFF,0x00,0x80,0xFD,0x00,0x00,0x01,0xD7,0xFF,
+0x02,0xFF,0xFE,0x1F,0xFD,0xFF,0x00,0xF8,0xD7,0xFF,
+0x01,0xFF,0xFC,0xFC,0xFF,0x01,0xFE,0x3F,0xD8,0xFF,
+0x01,0xFF,0xF9,0xFB,0xFF,0x00,0x3F,0xD8,0xFF,
+0x01,0xFF,0xF3,0xFB,0xFF,0x00,0x9F,0xD8,0xFF,
+0x01,0xFF,0xF7,0xFB,0xFF,0x00,0xCF,0xD8,0xFF,
+0x01,0xFF,0xE7,0xFB,0xFF,0x00,0xEF,0xD8,0xFF,
+0x02,0xFF,0xE7,0xFE,0xFE,0x00,0xFF,0xFF,0x00,0xEF,0xD8,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x02,0x1F,0xFF,0xE7,0xD8,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x02,0x0F,0xFF,0xE7,0xD8,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x02,0x07,0xFF,0xE7,0xFD,0xFF,0x00,0xE3,0xDD,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x02,0x03,0xFF,0xE7,0xFD,0xFF,0x00,0xE1,0xDD,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x02,0x01,0xFF,0xE7,0xFD,0xFF,0x00,0xC1,0xDD,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x02,0x01,0xFF,0xE7,0xFD,0xFF,0x00,0xC1,0xDD,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFD,0x00,0x01,0xFF,0xE7,0xFF,0xFF,0x02,0xB9,0xBF,0xE3,0xDD,0xFF,
+0x08,0xFF,0xEF,0xFE,0x00,0xFF,0xF0,0x00,0xFF,0xE7,0xFF,0xFF,0x01,0x11,0x17,0xF1,0xFF,0x00,0x07,0xED,0xFF,
+0x08,0xFF,0xEF,0xFE,0x00,0xFF,0xFC,0x00,0xFF,0xE7,0xFF,0xFF,0x02,0x19,0x23,0xFB,0xF3,0xFF,0x01,0xFE,0x03,
+0xED,0xFF,
+0x08,0xFF,0xEF,0xFE,0x00,0xFF,0xFE,0x00,0x7F,0xE7,0xFF,0xFF,0x03,0x1F,0xF4,0xF1,0x9F,0xF4,0xFF,0x02,0xFE,
+0x63,0x87,0xEE,0xFF,
+0x08,0xFF,0xEF,0xFE,0x00,0xFF,0xFE,0x00,0x7F,0xE7,0xFF,0xFF,0x03,0xFC,0xDC,0x61,0x0F,0xF4,0xFF,0x02,0xFC,
+0x73,0x03,0xEE,0xFF,
+0x08,0xFF,0xEF,0xFE,0x00,0xFF,0xFE,0x00,0x7F,0xE7,0xFF,0xFF,0x03,0x88,0x9E,0x61,0x0F,0xFF,0xFF,0x04,0xF0,
+0x1F,0xFC,0x00,0x0F,0xFB,0xFF,0x02,0xFC,0x73,0x07,0xF6,0xFF,0x00,0x80,0xFD,0x00,0x00,0x7F,0xFF,0xFF,
+0x16,0xFF,0xEF,0xFE,0x00,0xFF,0xFE,0x00,0x7F,0xE7,0xFF,0xFB,0x08,0x93,0xF3,0x8F,0xF9,0xFF,0xE0,0x0F,0xF8,
+0x00,0x0F,0xFC,0xFC,0xFF,0x01,0xFC,0x73,0xF5,0xFF,0xFC,0x00,0x00,0x3F,0xFF,0xFF,
+0x0C,0xFF,0xEF,0xFE,0x00,0xFF,0xFE,0x00,0x7F,0xE7,0xFF,0xF0,0x8F,0xF0,0xFF,0xFF,0x07,0xF9,0xFF,0x8F,0xE3,
+0xFF,0xF3,0xFF,0xF8,0xFC,0xFF,0x02,0xFC,0x73,0x07,0xF6,0xFF,0xFC,0x00,0x00,0x3F,0xFF,0xFF,
+0x17,0xFF,0xEF,0xFE,0x00,0xFF,0xFE,0x00,0x7F,0xE7,0xFF,0xF0,0xFF,0xFC,0x63,0xFF,0xF9,0xFF,0x1F,0xF1,0xFF,
+0xF3,0xFF,0xF8,0x7F,0xFD,0xFF,0x02,0xFC,0x73,0x03,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x3F,0xFF,0xFF,
+0x17,0xFF,0xEF,0xFE,0x00,0xFF,0xFE,0x00,0x7F,0xE7,0xFF,0xF0,0xF6,0x27,0xE1,0x1F,0xF9,0xFF,0x3F,0xF9,0xFF,
+0xF3,0xFF,0xF3,0x7F,0xFD,0xFF,0x01,0xFC,0x73,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x0F,0xFF,0xFF,
+0x17,0xFF,0xEF,0xFE,0x00,0xFF,0xFE,0x00,0x7F,0xE7,0xFF,0xFB,0xE2,0x26,0xE3,0x19,0xF9,0xFE,0x7F,0xFC,0xFF,
+0xF3,0xFF,0xF3,0x3F,0xFD,0xFF,0x01,0xFC,0x73,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x17,0xFF,0xEF,0xFE,0x00,0xFF,0xFC,0x00,0x7F,0xE7,0xFF,0xFE,0x42,0x24,0xF7,0x10,0xF9,0xFE,0x7F,0xFC,0xFF,
+0xF3,0xFF,0xF3,0xBF,0xFD,0xFF,0x02,0xFC,0x53,0x03,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x17,0xFF,0xEF,0xFE,0x00,0xFF,0xF8,0x00,0xFF,0xE7,0xFF,0xFC,0x23,0xFC,0xCF,0xF0,0xF9,0xFC,0xFF,0xFE,0xFF,
+0xF3,0xFF,0xE7,0x9F,0xFD,0xFF,0x00,0xFC,0xFF,0x03,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFD,0x00,0x10,0xFF,0xE7,0xFF,0xF8,0x3F,0xFF,0xC6,0x79,0xF9,0xFC,0xFF,0xFE,0x7F,0xF3,
+0xFF,0xE7,0x9F,0xFD,0xFF,0x01,0xFC,0x03,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFD,0x00,0x10,0xFF,0xE7,0xFF,0xCC,0x7F,0x3F,0xC6,0x37,0xF9,0xFC,0xFF,0xFE,0x7F,0xF3,
+0xFF,0xE7,0xDF,0xFD,0xFF,0x02,0xFC,0x03,0xC7,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x0F,0x01,0xFF,0xE7,0xFF,0x87,0xFE,0x3F,0xFE,0x63,0xF9,0xFC,0xFF,0xFE,0x7F,
+0xF3,0xFF,0xFF,0xCF,0xFD,0xFF,0x02,0xFE,0x03,0x83,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x0F,0x03,0xFF,0xE7,0xFF,0x07,0xD1,0xFF,0x1D,0xE3,0xF9,0xFC,0xFF,0xFE,0x7F,
+0xF3,0xFF,0xFF,0xCF,0xFD,0xFF,0x02,0xFC,0x03,0x87,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x11,0x03,0xFF,0xE7,0xFF,0x07,0xDB,0x3F,0x18,0xF7,0xF9,0xFC,0xFF,0xFE,0x7F,
+0xF3,0xFF,0xDF,0xE7,0xFD,0xFF,0x01,0xF8,0x10,0xF5,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x11,0x07,0xFF,0xE7,0xFF,0x8F,0xFB,0x1C,0xF9,0x9F,0xF9,0xFC,0xFF,0xFE,0xFF,
+0xF3,0xFF,0x9F,0xE7,0xFD,0xFF,0x02,0xF1,0x88,0x7F,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x02,0x1F,0xFF,0xE7,0xFF,0xFF,0x0C,0x91,0x3C,0xE7,0x8F,0xF9,0xFE,0x7F,0xFC,
+0xFF,0xF3,0xFF,0xBF,0xE7,0xFD,0xFF,0x02,0xF2,0x06,0x7F,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,
+0xFF,
+0x02,0xFF,0xEF,0xFE,0xFE,0x00,0x02,0x7F,0xFF,0xE7,0xFF,0xFF,0x0C,0xDB,0xCF,0xA6,0x1F,0xF9,0xFE,0x7F,0xFC,
+0xFF,0xF3,0xFF,0x3F,0xF3,0xFD,0xFF,0x02,0xE0,0x02,0x3F,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,0x07,0xFF,
+0xFF,
+0x02,0xFF,0xEF,0xFE,0xFF,0x00,0x00,0x03,0xFF,0xFF,0x00,0xE7,0xFF,0xFF,0x0C,0x99,0x87,0x9E,0x7F,0xF9,0xFF,
+0x3F,0xF9,0xFF,0xF3,0xFF,0x3F,0xF3,0xFD,0xFF,0x02,0xE4,0x01,0x3F,0xF6,0xFF,0x00,0x1F,0xFE,0xFF,0x01,0xFE,
+0x3F,0xFF,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x0C,0x98,0xCF,0xE9,0x7F,0xF9,0xFF,0x1F,0xF1,0xFF,
+0xF3,0xFE,0x7F,0xF3,0xFD,0xFF,0x02,0xE4,0x01,0x3F,0xF6,0xFF,0xFC,0x00,0x00,0x3F,0xFF,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0xFF,0xF9,0x0A,0xE1,0xFF,0xF9,0xFF,0x8F,0xE3,0xFF,
+0xF3,0xFE,0x7F,0xF9,0xFD,0xFF,0x02,0xE4,0x01,0x3F,0xF6,0xFF,0xFC,0x00,0x00,0x3F,0xFF,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x01,0xCE,0x70,0xFF,0xFF,0x08,0xF9,0xFF,0xE0,0x0F,
+0xFF,0xF3,0xFE,0xFF,0xF9,0xFD,0xFF,0x02,0xE4,0x01,0x3F,0xF6,0xFF,0x00,0x80,0xFD,0x00,0x00,0x7F,0xFF,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x01,0x8C,0x30,0xFD,0xFF,0x01,0xF8,0x3F,0xF8,0xFF,
+0x02,0xE4,0x02,0x3F,0xEE,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x02,0xDC,0x79,0x9F,0xF3,0xFF,0x02,0xE2,0x02,0x7F,
+0xEE,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x02,0xF3,0xDF,0x0F,0xF3,0xFF,0x02,0xF1,0x8C,0x7F,
+0xEE,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x02,0xE3,0x8F,0x0C,0xF3,0xFF,0x01,0xF8,0x20,0xED,
+0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x03,0xE3,0x8F,0x18,0x7F,0xF4,0xFF,0x01,0xFC,0x01,
+0xED,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x03,0xFC,0x08,0xF8,0x3F,0xF3,0xFF,0x00,0x0F,0xED,
+0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x00,0xFC,0xFF,0x78,0x00,0x7F,0xDE,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x03,0xFC,0x78,0x7C,0x7F,0xDE,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xFF,0xFF,0x01,0xFE,0xF8,0xDC,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xD8,0xFF,
+0x03,0xFF,0xEF,0xFE,0x00,0xFD,0xFF,0x00,0xE7,0xD8,0xFF,
+0x03,0xFF,0xE7,0xFE,0x00,0xFD,0xFF,0x00,0xEF,0xD8,0xFF,
+0x03,0xFF,0xE7,0xFE,0x00,0xFD,0xFF,0x00,0xEF,0xD8,0xFF,
+0x01,0xFF,0xF7,0xFB,0xFF,0x00,0xCF,0xD8,0xFF,
+0x01,0xFF,0xF3,0xFB,0xFF,0x00,0xDF,0xD8,0xFF,
+0x01,0xFF,0xF9,0xFB,0xFF,0x00,0x9F,0xD8,0xFF,
+0x01,0xFF,0xFC,0xFB,0xFF,0x00,0x3F,0xD8,0xFF,
+0x02,0xFF,0xFE,0x7F,0xFD,0xFF,0x01,0xFC,0x7F,0xD8,0xFF,
+0xFF,0xFF,0xFC,0x00,0x00,0x01,0xD7,0xFF,
+0xFF,0xFF,0x00,0xE0,0xFD,0x00,0x00,0x07,0xD7,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0x00,0xFE,0xD1,0x00,0x00,0x7F,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xE7,0xFF,0x04,0xFC,0x1F,0xFF,0xF0,0x3F,0xEE,0xFF,
+0xE7,0xFF,0x04,0xF8,0x0F,0xFF,0xF0,0x1F,0xEE,0xFF,
+0xE7,0xFF,0x04,0xF8,0x0F,0xFF,0xF0,0x1F,0xEE,0xFF,
+0xE7,0xFF,0x04,0xF8,0x0F,0xFF,0xF0,0x1F,0xEE,0xFF,
+0xE7,0xFF,0x04,0xF8,0x0F,0xFF,0xF0,0x1F,0xEE,0xFF,
+0xFE,0xFF,0x00,0xF0,0xEC,0xFF,0x00,0xFE,0xFC,0x00,0x00,0x7F,0xEF,0xFF,
+0xFE,0xFF,0x01,0x80,0x1F,0xED,0xFF,0x00,0xFC,0xFC,0x00,0x00,0x3F,0xEF,0xFF,
+0xFE,0xFF,0x02,0x00,0x0F,0x01,0xEE,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x3F,0xEF,0xFF,
+0xFF,0xFF,0x04,0xFE,0x00,0x06,0x00,0x3F,0xEF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xEF,0xFF,
+0xFF,0xFF,0x04,0xFE,0x00,0x07,0x00,0x1F,0xEF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xEF,0xFF,
+0xFF,0xFF,0x04,0xFC,0x00,0x33,0x80,0x07,0xEF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xEF,0xFF,
+0xFF,0xFF,0x04,0xFC,0x00,0x63,0xFC,0x03,0xEF,0xFF,0x06,0xF8,0x03,0xE0,0x00,0x0F,0xC0,0x1F,0xEF,0xFF,
+0xFF,0xFF,0x04,0xFC,0xC0,0xC3,0xFF,0x81,0xFE,0xFF,0x01,0xFE,0x3F,0xFF,0xFF,0x00,0x8F,0xFF,0xFF,0x04,0xF0,
+0x0F,0xFF,0xF8,0x0F,0xFE,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFF,0xFF,0x04,0xF0,0x0F,0xFF,0xF0,0x0F,0xFE,
+0xFF,0x00,0xF8,0xFF,0xFF,0x00,0x8F,0xFD,0xFF,
+0xFF,0xFF,0x04,0xF8,0xE1,0x83,0xFF,0xC0,0xFE,0xFF,0x01,0xFC,0x3F,0xFF,0xFF,0x00,0x0F,0xFF,0xFF,0x04,0xC0,
+0x03,0xFF,0xE0,0x03,0xFE,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFF,0xFF,0x04,0xC0,0x03,0xFF,0xC0,0x03,0xFE,
+0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF8,0x73,0x03,0x83,0xF0,0x7F,0xFF,0xFF,0x04,0xF8,0x3F,0xFF,0xFE,0x0F,0xFF,0xFF,0x04,0x80,
+0x01,0xFF,0xC0,0x01,0xFE,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x3F,0xFF,0xFF,0x04,0x80,0x01,0xFF,0x80,0x01,0xFE,
+0xFF,0x03,0xE0,0xFF,0xFE,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFC,0x3E,0x03,0xE0,0xF8,0x3F,0xFF,0xFF,0x04,0xF0,0x3F,0xFF,0xFE,0x0F,0xFF,0xFF,0xFF,0x00,
+0x02,0xFF,0x80,0x00,0xFE,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFE,
+0xFF,0x03,0xC0,0xFF,0xFC,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFC,0x1C,0x03,0xFC,0x3C,0x1F,0xFF,0xFF,0x04,0xE0,0x3F,0xFF,0xFC,0x0F,0xFF,0xFF,0x05,0x07,
+0xF0,0xFF,0x07,0xF0,0x7F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x07,0x1F,0xFF,0xFE,0x0F,0xE0,0xFE,0x0F,0xF0,0xFE,
+0xFF,0x03,0x80,0xFF,0xF8,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFC,0x08,0x03,0xFF,0x1E,0x1F,0xFF,0xFF,0x0C,0xC0,0x3F,0xFF,0xF8,0x0F,0xFF,0xFE,0x0F,0xF8,
+0x7F,0x0F,0xF8,0x7F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x08,0x1F,0xFF,0xFE,0x1F,0xF8,0x7E,0x1F,0xF8,0x7F,0xFF,
+0xFF,0x03,0x00,0xFF,0xF0,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFE,0x00,0x07,0x1F,0xCF,0x0F,0xFF,0xFF,0x0C,0x00,0x3F,0xFF,0xF8,0x0F,0xFF,0xFE,0x1F,0xF8,
+0x7F,0x1F,0xFC,0x7F,0xFF,0xFF,0x14,0xF8,0x00,0x0F,0x83,0xF0,0x7C,0x1F,0xFF,0xFC,0x3F,0xF8,0x7C,0x3F,0xF8,
+0x7F,0xFF,0xFC,0x00,0xFF,0xE0,0x0F,0xFD,0xFF,
+0xFE,0xFF,0x13,0x00,0x0F,0x1F,0xE7,0x0F,0xFF,0xFE,0x04,0x3F,0xFF,0xF0,0x0F,0xFF,0xFC,0x3F,0xF8,0x7E,0x1F,
+0xFC,0x3F,0xFF,0xFF,0x14,0xF8,0x00,0x0F,0x83,0xF0,0x7C,0x1F,0xFF,0xFC,0x3F,0xFC,0x3C,0x3F,0xF8,0x7F,0xFF,
+0xF8,0x10,0xFF,0x81,0x0F,0xFD,0xFF,
+0xFE,0xFF,0x13,0x80,0x1E,0x1F,0xE7,0x87,0xFF,0xFC,0x0C,0x3F,0xFF,0xE1,0x0F,0xF8,0x7F,0xBF,0xF8,0x7E,0x1F,
+0xFE,0x3F,0xFF,0xFF,0x0C,0xF8,0x00,0x0F,0x83,0xF0,0x7C,0x1F,0xFF,0xFC,0x3F,0xFC,0x3C,0x7F,0xFE,0xFF,0x04,
+0xF0,0x30,0xFF,0x03,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x0D,0xFD,0xC0,0x3E,0x1F,0xF3,0x87,0xFF,0xFC,0x3C,0x3F,0xFF,0xC3,0x0F,0xF8,0xFF,0xFF,0x04,0xF8,
+0x7E,0x3F,0xFE,0x3F,0xFF,0xFF,0x06,0xF8,0x00,0x0F,0x83,0xF0,0x7C,0x1F,0xFF,0xFF,0x03,0x7F,0xFC,0x3C,0x7F,
+0xFE,0xFF,0xFF,0xF0,0x00,0xFF,0xFF,0x0F,0xFD,0xFF,
+0xFF,0xFF,0xFF,0xF9,0x04,0xFE,0x1F,0xFB,0x87,0xFF,0xFF,0xFC,0x0B,0x3F,0xFF,0x83,0x0F,0xF8,0x7F,0xFF,0xF8,
+0xFE,0x3F,0xFE,0x3F,0xFF,0xFF,0x06,0xF8,0x00,0x0F,0x83,0xF0,0x7C,0x1F,0xFE,0xFF,0x02,0xFC,0x78,0x7F,0xFE,
+0xFF,0x04,0xF3,0xF0,0xFF,0x1F,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF0,0xFF,0xFE,0x1F,0xF9,0xC3,0xFF,0xFF,0x05,0xFC,0x3F,0xFF,0x87,0x0F,0xF8,0xFF,0xFF,0x04,
+0xE0,0xFE,0x3F,0xFE,0x1F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFE,0xFF,0x03,0xF8,0x78,0x70,0x07,0xFE,
+0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF0,0x7F,0xFE,0x1F,0xF9,0xC3,0xFF,0xFF,0x02,0xFC,0x3F,0xFF,0xFF,0x0F,0xFF,0xFF,0x05,0xFE,
+0x01,0xFC,0x3F,0xFE,0x1F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFE,0xFF,0x03,0xF8,0x78,0x60,0x03,0xFE,
+0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xE0,0x7F,0xFE,0x1F,0xFD,0xC3,0xFF,0xFF,0x02,0xFC,0x3F,0xFE,0xFF,0x0F,0xFF,0xFF,0x05,0xFC,
+0x03,0xFC,0x3F,0xFE,0x1F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFE,0xFF,0x03,0xF0,0xF8,0x40,0x01,0xFE,
+0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xC0,0x3F,0xFE,0x1F,0xFD,0xC3,0xFF,0xFF,0x04,0xFC,0x3F,0xFE,0x1F,0x0F,0xFF,0xFF,0x05,0xFC,
+0x01,0xFC,0x3F,0xFE,0x1F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFE,0xFF,0x03,0xE0,0xF8,0x01,0x80,0xFE,
+0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xC0,0x0F,0xFE,0x1F,0xFC,0xC3,0xFF,0xFF,0x04,0xFC,0x3F,0xFC,0x3F,0x0F,0xFF,0xFF,0x05,0xFC,
+0x00,0xFC,0x3F,0xFE,0x1F,0xFF,0xFF,0x06,0xF8,0x3C,0x0F,0x81,0xE0,0x7C,0x1F,0xFE,0xFF,0x04,0xC1,0xF8,0x1F,
+0xF0,0x7F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF0,0x67,0xFF,0x1F,0xFC,0xC3,0xFF,0xFF,0x04,0xFC,0x3F,0xF8,0x7F,0x0F,0xFE,0xFF,0x04,0xF0,
+0x7C,0x3F,0xFE,0x1F,0xFF,0xFF,0x06,0xF8,0x7E,0x0F,0x83,0xF0,0x7C,0x1F,0xFE,0xFF,0x04,0x83,0xF8,0x3F,0xF8,
+0x7F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF8,0xE7,0xFE,0x1F,0xFD,0xC3,0xFF,0xFF,0x04,0xFC,0x3F,0xF0,0x7F,0x0F,0xFE,0xFF,0x04,0xFC,
+0x3C,0x3F,0xFE,0x1F,0xFF,0xFF,0x06,0xF8,0x7E,0x0F,0x83,0xF0,0x7C,0x1F,0xFE,0xFF,0x04,0x07,0xF8,0x7F,0xFC,
+0x3F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF8,0x67,0xFC,0x1F,0xFD,0xC3,0xFF,0xFF,0x04,0xFC,0x3F,0xF0,0xFF,0x0F,0xFE,0xFF,0x04,0xFC,
+0x3C,0x3F,0xFE,0x1F,0xFF,0xFF,0x06,0xF8,0x7E,0x0F,0x83,0xF0,0x7C,0x1F,0xFF,0xFF,0x05,0xFE,0x0F,0xF8,0x7F,
+0xFC,0x3F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF8,0x67,0xF8,0x3F,0xF9,0xC3,0xFF,0xFF,0x04,0xFC,0x3F,0xE1,0xFF,0x0F,0xFE,0xFF,0x04,0xFE,
+0x1E,0x3F,0xFE,0x3F,0xFF,0xFF,0x06,0xF8,0x7E,0x0F,0x83,0xF0,0x7C,0x1F,0xFF,0xFF,0x05,0xFC,0x1F,0xF8,0x7F,
+0xFC,0x3F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF8,0x73,0xF0,0x7F,0xF9,0xC3,0xFF,0xFF,0x04,0xFC,0x3F,0xC0,0x00,0x01,0xFE,0xFF,0x04,0xFE,
+0x1E,0x3F,0xFE,0x3F,0xFF,0xFF,0x06,0xF8,0x3C,0x07,0x01,0xE0,0x3C,0x1F,0xFF,0xFF,0x05,0xF8,0x3F,0xF8,0x7F,
+0xFC,0x3F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xF8,0x73,0xE0,0xFF,0xFB,0x87,0xFF,0xFF,0x02,0xFC,0x3F,0xC0,0xFF,0x00,0xFE,0xFF,0x04,0xFE,
+0x1E,0x3F,0xFE,0x3F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFF,0xFF,0x05,0xF0,0x7F,0xF8,0x7F,0xFC,0x3F,
+0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFC,0x39,0xC1,0xFF,0xF3,0x87,0xFF,0xFF,0x02,0xFC,0x3F,0xC0,0xFF,0x00,0x07,0xFF,0xFC,0x3F,
+0xFE,0x1E,0x3F,0xFE,0x3F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFF,0xFF,0x05,0xE0,0xFF,0xF8,0x7F,0xFC,
+0x3F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFC,0x39,0xC3,0xFF,0xE7,0x87,0xFF,0xFF,0x02,0xFC,0x3F,0xC0,0xFF,0x00,0x07,0xFF,0xFC,0x3F,
+0xFE,0x1E,0x1F,0xFC,0x3F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFF,0xFF,0x05,0xC1,0xFF,0xFC,0x7F,0xFC,
+0x3F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFC,0x1C,0xC7,0xFF,0xE7,0x0F,0xFF,0xFF,0x01,0xFC,0x3F,0xFF,0xFF,0x08,0x0F,0xFF,0xFE,0x1F,
+0xFE,0x3E,0x1F,0xFC,0x3F,0xFF,0xFF,0x00,0xF8,0xFC,0x00,0x00,0x1F,0xFF,0xFF,0x05,0x87,0xFF,0xFC,0x3F,0xFC,
+0x3F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFE,0x1E,0x7F,0xFF,0xCF,0x0F,0xFF,0xFF,0x01,0xFC,0x3F,0xFF,0xFF,0x08,0x0F,0xFF,0xFE,0x1F,
+0xFC,0x3F,0x0F,0xF8,0x7F,0xFF,0xFF,0x06,0xF8,0x7E,0x0F,0x83,0xF0,0x00,0x1F,0xFF,0xFF,0x05,0x0F,0xFF,0xFC,
+0x3F,0xF8,0x7F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFF,0xFF,0x05,0xFE,0x0F,0x3F,0xFF,0x9E,0x1F,0xFF,0xFF,0x01,0xFC,0x3F,0xFF,0xFF,0x00,0x0F,0xFF,0xFF,0x05,
+0x0F,0xF8,0x7F,0x07,0xF0,0x7F,0xFF,0xFF,0x0E,0xF8,0x7E,0x0F,0x83,0xF0,0x00,0x1F,0xFF,0xFE,0x1F,0xFF,0xFE,
+0x1F,0xF0,0x7F,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFE,0xFF,0x04,0x07,0x8F,0xFE,0x3C,0x1F,0xFF,0xFF,0x01,0xFC,0x3F,0xFF,0xFF,0x00,0x0F,0xFF,0xFF,0x04,0x03,
+0xE0,0x7F,0x81,0xE0,0xFE,0xFF,0x09,0xF8,0x7E,0x0F,0x83,0xF0,0x00,0x1F,0xFF,0xFC,0x1F,0xFF,0xFF,0x01,0x07,
+0xC0,0xFE,0xFF,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0xFD,0xFF,
+0xFE,0xFF,0x04,0x83,0xC1,0xF0,0xF8,0x3F,0xFF,0xFF,0x01,0xFC,0x3F,0xFF,0xFF,0x07,0x0F,0xF8,0x7F,0x80,0x00,
+0xFF,0x80,0x00,0xFE,0xFF,0x08,0xF8,0x7E,0x0F,0x83,0xF0,0x00,0x1F,0xFF,0xFC,0xFF,0x00,0x06,0x3F,0x80,0x01,
+0xFE,0x1F,0xFF,0xF0,0xFF,0xFF,0x02,0x0F,0xFE,0x1F,0xFF,0xFF,
+0xFE,0xFF,0x04,0x81,0xF0,0x01,0xF0,0x7F,0xFF,0xFF,0x01,0xFC,0x3F,0xFF,0xFF,0x07,0x0F,0xF8,0xFF,0xC0,0x01,
+0xFF,0xC0,0x01,0xFE,0xFF,0x08,0xF8,0x3E,0x0F,0x81,0xF0,0x00,0x1F,0xFF,0xF8,0xFF,0x00,0x06,0x3F,0xC0,0x03,
+0xFE,0x1F,0xFF,0xF0,0xFF,0xFF,0x02,0x0F,0xFE,0x1F,0xFF,0xFF,
+0xFE,0xFF,0x04,0xC0,0xFF,0x1F,0xC0,0x7F,0xFF,0xFF,0x01,0xFC,0x3F,0xFF,0xFF,0x07,0x0F,0xF8,0x7F,0xF0,0x07,
+0xFF,0xF0,0x07,0xFE,0xFF,0x00,0xF8,0xFC,0x00,0x02,0x1F,0xFF,0xF8,0xFF,0x00,0x06,0x3F,0xE0,0x07,0xFE,0x1F,
+0xFF,0xF0,0xFF,0xFF,0x02,0x0F,0xFE,0x1F,0xFF,0xFF,
+0xFE,0xFF,0x03,0xE0,0x3F,0xFF,0x80,0xFE,0xFF,0x01,0xFC,0x7F,0xFF,0xFF,0x07,0x8F,0xF8,0xFF,0xFE,0x3F,0xFF,
+0xFE,0x3F,0xFE,0xFF,0x00,0xF8,0xFC,0x00,0x02,0x3F,0xFF,0xF8,0xFF,0x00,0x06,0x7F,0xFE,0x7F,0xFF,0x1F,0xFF,
+0xF1,0xFF,0xFF,0x02,0x0F,0xFE,0x1F,0xFF,0xFF,
+0xFE,0xFF,0x03,0xF0,0x07,0xFC,0x03,0xEF,0xFF,0x00,0xFC,0xFC,0x00,0x00,0x3F,0xEF,0xFF,
+0xFE,0xFF,0x00,0xFC,0xFF,0x00,0x00,0x07,0xEF,0xFF,0x00,0xFE,0xFC,0x00,0x00,0x7F,0xEF,0xFF,
+0xFE,0xFF,0x00,0xFE,0xFF,0x00,0x00,0x1F,0xD6,0xFF,
+0xFD,0xFF,0x02,0x80,0x00,0x7F,0xD6,0xFF,
+0xFD,0xFF,0x01,0xF0,0x01,0xD5,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xDF,0xFF,0x0A,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFF,0xF8,0x3F,0xFC,0xFF,
+0xDF,0xFF,0x0A,0xC0,0x07,0xFF,0xE0,0x07,0xFF,0xC0,0x07,0xFF,0xE0,0x07,0xFC,0xFF,
+0xDF,0xFF,0x0A,0x80,0x03,0xFF,0xC0,0x03,0xFF,0x80,0x03,0xFF,0x80,0x03,0xFC,0xFF,
+0xDF,0xFF,0xFF,0x00,0x08,0xFF,0x80,0x01,0xFF,0x00,0x01,0xFF,0x00,0x01,0xFC,0xFF,
+0xE0,0xFF,0x0B,0xFE,0x07,0xE0,0xFF,0x07,0xE0,0xFE,0x0F,0xE0,0xFF,0x07,0xE0,0xFC,0xFF,
+0xE0,0xFF,0x0B,0xFE,0x1F,0xF0,0x7E,0x0F,0xF0,0xFC,0x1F,0xF0,0xFE,0x1F,0xF0,0xFC,0xFF,
+0xE0,0xFF,0x0C,0xFC,0x3F,0xF8,0x7E,0x1F,0xF8,0x7C,0x3F,0xF8,0x7E,0x1F,0xF8,0x7F,0xFD,0xFF,
+0xE0,0xFF,0x0C,0xFC,0x3F,0xFC,0x7E,0x1F,0xF8,0x7C,0x3F,0xF8,0x7C,0x3F,0xF8,0x7F,0xFD,0xFF,
+0xE0,0xFF,0x0C,0xFC,0x3F,0xFC,0x3C,0x3F,0xFC,0x7C,0x7F,0xF8,0x7C,0x3F,0xF8,0x7F,0xFD,0xFF,
+0xE0,0xFF,0x0C,0xFC,0x3F,0xFC,0x3C,0x3F,0xFC,0x3C,0x7F,0xF8,0x7C,0x3F,0xFC,0x7F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0xFC,0x7C,0x3F,0xFC,0x3F,0xFF,0xF8,0x7C,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0xF8,0x7C,0x3F,0xFC,0x3F,0xFF,0xF8,0x7C,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0xF8,0x7C,0x3F,0xFC,0x3F,0xFF,0xF8,0x7C,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0xF0,0xFC,0x3F,0xFC,0x3F,0xFF,0xF0,0xF8,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0xF0,0xFC,0x3F,0xFC,0x3F,0xFF,0xE0,0xF8,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0xE1,0xFC,0x3F,0xFC,0x3F,0xFF,0xC1,0xF8,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0xC3,0xFC,0x3F,0xFC,0x3F,0xFF,0x83,0xF8,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0x87,0xFC,0x3F,0xFC,0x3F,0xFF,0x07,0xF8,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDE,0xFF,0x0A,0x0F,0xFC,0x3F,0xFC,0x3F,0xFE,0x0F,0xF8,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDF,0xFF,0x0B,0xFE,0x1F,0xFC,0x3F,0xFC,0x3F,0xFE,0x1F,0xFC,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDF,0xFF,0x0B,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xF8,0x3F,0xFC,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDF,0xFF,0x0B,0xF0,0x7F,0xFC,0x3F,0xFC,0x3F,0xF0,0x7F,0xFC,0x7F,0xFC,0x3F,0xFD,0xFF,
+0xDF,0xFF,0x0B,0xE0,0xFF,0xFC,0x3F,0xFC,0x3F,0xE0,0xFF,0xFC,0x3F,0xFC,0x7F,0xFD,0xFF,
+0xDF,0xFF,0x0B,0xC1,0xFF,0xFC,0x3F,0xFC,0x3F,0xC1,0xFF,0xFC,0x3F,0xFC,0x7F,0xFD,0xFF,
+0xDF,0xFF,0x0B,0x83,0xFF,0xFE,0x3F,0xF8,0x7F,0x83,0xFF,0xFC,0x3F,0xF8,0x7F,0xFD,0xFF,
+0xDF,0xFF,0x0B,0x07,0xFF,0xFE,0x1F,0xF8,0x7F,0x0F,0xFF,0xFE,0x1F,0xF8,0x7F,0xFD,0xFF,
+0xE0,0xFF,0x0B,0xFE,0x0F,0xFF,0xFE,0x0F,0xF0,0x7E,0x1F,0xFF,0xFE,0x0F,0xF0,0xFC,0xFF,
+0xE0,0xFF,0x01,0xFC,0x1F,0xFF,0xFF,0x03,0x07,0xE0,0xFC,0x3F,0xFF,0xFF,0x01,0x07,0xE0,0xFC,0xFF,
+0xE0,0xFF,0x00,0xFC,0xFF,0x00,0x03,0x3F,0x00,0x01,0xFC,0xFF,0x00,0x02,0x7F,0x00,0x01,0xFC,0xFF,
+0xE0,0xFF,0x00,0xF8,0xFF,0x00,0x03,0x3F,0x80,0x01,0xF8,0xFF,0x00,0x02,0x7F,0x80,0x03,0xFC,0xFF,
+0xE0,0xFF,0x00,0xF8,0xFF,0x00,0x03,0x3F,0xE0,0x07,0xF8,0xFF,0x00,0x02,0x7F,0xE0,0x07,0xFC,0xFF,
+0xE0,0xFF,0x00,0xF8,0xFF,0x00,0x03,0x3F,0xF8,0x1F,0xF8,0xFF,0x00,0x02,0x7F,0xF8,0x3F,0xFC,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xFF,0xFF,0x01,0xE0,0x3F,0xFE,0xFF,0x00,0xE0,0xFF,0x00,0x00,0x7F,0xFB,0xFF,0x01,0xFC,0x07,0xFD,0xFF,0x00,
+0xF0,0xFF,0x00,0x00,0x1F,0xFE,0xFF,0x01,0xF8,0x00,0xFF,0xFF,0x00,0xFC,0xFF,0x00,0x00,0x3F,0xFF,0xFF,0x01,
+0xC0,0x03,0xFF,0xFF,0x00,0xF0,0xFF,0x00,0xFE,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFF,0x00,0x00,0x1F,0xFB,0xFF,0x01,0xF8,0x03,0xFD,0xFF,0x00,
+0x80,0xFF,0x00,0x00,0x07,0xFE,0xFF,0x04,0xC0,0x00,0x1F,0xFF,0xF0,0xFF,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0x00,
+0x02,0x7F,0xFF,0xC0,0xFF,0x00,0x00,0x3F,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFF,0x00,0x00,0x07,0xFB,0xFF,0x01,0xF8,0x03,0xFD,0xFF,0xFE,
+0x00,0x00,0x07,0xFE,0xFF,0xFF,0x00,0x02,0x07,0xFF,0xE0,0xFF,0x00,0x02,0x07,0xFF,0xFC,0xFF,0x00,0x02,0x3F,
+0xFF,0x80,0xFF,0x00,0x00,0x1F,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFF,0x00,0x00,0x01,0xFB,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x00,
+0xFE,0xFE,0x00,0x00,0x03,0xFF,0xFF,0x00,0xFE,0xFF,0x00,0x02,0x03,0xFF,0xC0,0xFF,0x00,0x02,0x03,0xFF,0xF0,
+0xFF,0x00,0x01,0x0F,0xFF,0xFE,0x00,0x00,0x0F,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFE,0x00,0xFB,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x00,0xFC,0xFE,
+0x00,0x00,0x03,0xFF,0xFF,0x00,0xFC,0xFF,0x00,0x02,0x01,0xFF,0x80,0xFF,0x00,0x02,0x01,0xFF,0xF0,0xFF,0x00,
+0x01,0x07,0xFE,0xFE,0x00,0x00,0x07,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x7F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x00,
+0xFC,0xFE,0x00,0x00,0x03,0xFF,0xFF,0x00,0xF8,0xFF,0x00,0x01,0x01,0xFF,0xFD,0x00,0x01,0xFF,0xE0,0xFF,0x00,
+0x01,0x07,0xFC,0xFE,0x00,0x00,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFE,0x00,0x00,0x7F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x00,
+0xF8,0xFE,0x00,0x00,0x03,0xFF,0xFF,0x00,0xF0,0xFE,0x00,0x00,0xFF,0xFD,0x00,0x01,0xFF,0xC0,0xFF,0x00,0x01,
+0x03,0xFC,0xFE,0x00,0x00,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x0F,0xF0,0x00,0x3F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x00,0xFF,0xF0,0x03,0xFF,0xFF,0x00,0xF0,0xFE,0x00,0x06,0x7F,0x00,0x3F,0xFC,0x01,0xFF,0xC0,0xFF,0x00,
+0x05,0x01,0xFC,0x01,0xFF,0xF0,0x07,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFC,0x00,0x3F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,0x00,0xE0,0xFE,0x00,0x06,0x7E,0x00,0x7F,0xFE,0x03,0xFF,0x80,0xFF,0x00,
+0x05,0x01,0xF8,0x01,0xFF,0xF8,0x0F,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFE,0x00,0x3F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xF8,0x03,0xFF,0xFF,0x12,0xE0,0x01,0xFC,0x00,0x7F,0x00,0x7F,0xFE,0x07,0xFF,0x80,0x0F,0xF0,
+0x01,0xF8,0x01,0xFF,0xF8,0x1F,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0x00,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xF8,0x07,0xFF,0xFF,0x12,0xE0,0x07,0xFE,0x00,0x3F,0x00,0x7F,0xFE,0x0F,0xFF,0x80,0x1F,0xF8,
+0x01,0xF8,0x01,0xFF,0xF8,0x3F,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0x80,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xF8,0x07,0xFF,0xFF,0x12,0xE0,0x0F,0xFF,0x00,0x3F,0x00,0x7F,0xFE,0x1E,0xFF,0x80,0x3F,0xFC,
+0x00,0xF8,0x01,0xFF,0xF8,0x7B,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0x80,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xF8,0x07,0xFF,0xFF,0x12,0xE0,0x0F,0xFF,0x00,0x3F,0x00,0x7F,0xFE,0x3C,0x7F,0x80,0x3F,0xFC,
+0x00,0xF8,0x01,0xFF,0xF8,0xF3,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xC0,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xF8,0x07,0xFF,0xFF,0x12,0xE0,0x0F,0xFF,0x00,0x3F,0x00,0x7F,0xFF,0x78,0x7F,0x80,0x3F,0xFC,
+0x00,0xF8,0x01,0xFF,0xFD,0xE3,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xC0,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xF8,0x07,0xFF,0xFF,0x0F,0xE0,0x0F,0xFF,0x00,0x3F,0x00,0x7F,0xFF,0xF0,0x7F,0x80,0x3F,0xFC,
+0x00,0xF8,0x01,0xFF,0xFF,0x00,0xC3,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xC0,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xF8,0x07,0xFF,0xFF,0x0F,0xE0,0x1F,0xFF,0x00,0x3F,0x00,0x7F,0xFF,0xE0,0x7F,0x80,0x7F,0xFC,
+0x01,0xF8,0x01,0xFF,0xFF,0x00,0x83,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xC0,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xFC,0x0F,0xFC,0xFF,0x06,0x00,0x7F,0x00,0x7F,0xFF,0xC0,0x7F,0xFF,0xFF,0x03,0xFC,0x01,0xF8,
+0x01,0xFF,0xFF,0x00,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0x80,0x3F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xF9,0xFF,0x06,0x00,0x7F,0x00,0x7F,0xFF,0x80,0x7F,0xFF,0xFF,0x06,0xFC,0x01,0xF8,0x01,0xFF,0xFE,
+0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0x80,0x3F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xF9,0xFF,0x06,0x00,0x7F,0x00,0x7F,0xFF,0x00,0x7F,0xFF,0xFF,0x06,0xFC,0x01,0xF8,0x01,0xFF,0xFC,
+0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0x80,0x3F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFA,0xFF,0x07,0xFE,0x00,0x7F,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0xF8,0x01,0xF8,0x01,0xFF,
+0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0x00,0x7F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFA,0xFF,0x07,0xFE,0x00,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0xF8,0x03,0xF8,0x01,0xFF,
+0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x03,0xC0,0x1F,0xFE,0x00,0xFB,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,0xF8,
+0x03,0xFA,0xFF,0x07,0xFC,0x00,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0xF0,0x03,0xF8,0x01,0xFF,0xF8,
+0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x03,0xC0,0x1F,0xF8,0x00,0xFB,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,0xF8,
+0x03,0xFA,0xFF,0x07,0xFC,0x00,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0xF0,0x03,0xF8,0x01,0xFF,0xF8,
+0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFF,0x00,0x02,0x01,0xFF,0xC0,0xFE,0x00,0x02,0x01,0xF8,0x03,
+0xFE,0xFF,0x01,0xF8,0x03,0xFA,0xFF,0x07,0xF8,0x01,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0xE0,0x07,
+0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFF,0x00,0x02,0x03,0xFF,0xC0,0xFE,0x00,0x02,0x01,0xF8,0x03,
+0xFE,0xFF,0x01,0xF8,0x03,0xFA,0xFF,0x07,0xF0,0x01,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0xC0,0x07,
+0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFF,0x00,0x02,0x07,0xFF,0xC0,0xFE,0x00,0x02,0x01,0xF8,0x03,
+0xFE,0xFF,0x01,0xF8,0x03,0xFA,0xFF,0x07,0xF0,0x03,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0xC0,0x0F,
+0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFF,0x00,0x02,0x07,0xFF,0xC0,0xFE,0x00,0x02,0x01,0xF8,0x03,
+0xFE,0xFF,0x01,0xF8,0x03,0xFA,0xFF,0x07,0xE0,0x03,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0x80,0x0F,
+0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFF,0x00,0x02,0x01,0xFF,0xC0,0xFE,0x00,0x02,0x01,0xF8,0x03,
+0xFE,0xFF,0x01,0xF8,0x03,0xFA,0xFF,0x07,0xC0,0x07,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFF,0x06,0x00,0x1F,
+0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFE,0x00,0x01,0xFF,0xC0,0xFE,0x00,0x02,0x01,0xF8,0x03,0xFE,
+0xFF,0x01,0xF8,0x03,0xFA,0xFF,0x10,0x80,0x07,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFE,0x00,0x3F,0xF8,0x01,
+0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x7F,0xC0,0xFE,0x00,0x02,0x01,0xF8,0x03,0xFE,
+0xFF,0x01,0xF8,0x03,0xFA,0xFF,0x10,0x00,0x0F,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xFC,0x00,0x3F,0xF8,0x01,
+0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x05,0xC0,0x1F,0xFF,0x00,0x3F,0xC0,0xFE,0x00,0x02,0x03,0xF8,0x03,0xFE,
+0xFF,0x01,0xF8,0x03,0xFB,0xFF,0x11,0xFE,0x00,0x1F,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xF8,0x00,0x7F,0xF8,
+0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0x80,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFB,0xFF,0x11,0xFC,0x00,0x3F,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xF0,0x00,0xFF,0xF8,0x01,0xFF,
+0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xC0,0x1F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFB,0xFF,0x11,0xF8,0x00,0x7F,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xE0,0x01,0xFF,0xF8,0x01,0xFF,
+0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xE0,0x0F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFB,0xFF,0x11,0xF8,0x00,0x7F,0xFF,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0xC0,0x03,0xFF,0xF8,0x01,0xFF,
+0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xF0,0x0F,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFB,0xFF,0x01,0xE0,0x00,0xFF,0xFF,0x0D,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0x80,0x07,0xFF,0xF8,0x01,
+0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xF0,0x07,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFB,0xFF,0x01,0xC0,0x01,0xFF,0xFF,0x0D,0x00,0x7F,0xFE,0x00,0x7F,0xFF,0x00,0x0F,0xFF,0xF8,0x01,
+0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xF0,0x07,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFB,0xFF,0x01,0x80,0x03,0xFF,0xFF,0x0D,0x00,0x7F,0xFE,0x00,0x7F,0xFE,0x00,0x1F,0xFF,0xF8,0x01,
+0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xF0,0x07,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x01,
+0xF8,0x03,0xFF,0xFF,0x00,0x00,0xFE,0xFF,0x01,0x80,0x07,0xFF,0xFF,0x0D,0x00,0x7F,0xFE,0x00,0x7F,0xFC,0x00,
+0x1F,0xFF,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x01,0xC0,0x1F,0xFE,0xFF,0x04,0xC0,0x1F,0xFF,0xF0,0x07,0xFC,0xFF,0x01,0xF8,0x03,0xFE,0xFF,0x04,
+0xF8,0x03,0xFF,0xFE,0x00,0xFE,0xFF,0x01,0x00,0x0F,0xFF,0xFF,0x0D,0x00,0x7F,0xFE,0x00,0x7F,0xF8,0x00,0x7F,
+0xFF,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x09,0xC0,0x1F,0xFF,0xF8,0x07,0xC0,0x1F,0xFF,0xF0,0x07,0xFC,0xFF,0x01,0xF8,0x03,0xFF,0xFF,0x05,
+0x00,0xF8,0x03,0xFF,0xFE,0x00,0xFF,0xFF,0x02,0xFE,0x00,0x1F,0xFF,0xFF,0x06,0x00,0x7F,0xFE,0x00,0x7F,0xF0,
+0x00,0xFF,0xFF,0x04,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x09,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xFF,0xF0,0x07,0xFC,0xFF,0x09,0xF8,0x03,0xFF,0xFE,0x00,
+0xF8,0x03,0xFF,0xFE,0x00,0xFF,0xFF,0x02,0xFC,0x00,0x3F,0xFF,0xFF,0x06,0x00,0x7F,0xFE,0x00,0x7F,0xE0,0x01,
+0xFF,0xFF,0x04,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x09,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xFF,0xF0,0x07,0xFC,0xFF,0x09,0xF8,0x03,0xFF,0xFE,0x00,
+0xF8,0x03,0xFF,0xFE,0x00,0xFF,0xFF,0x02,0xF8,0x00,0x7F,0xFF,0xFF,0x06,0x00,0x7F,0xFE,0x00,0x7F,0xE0,0x03,
+0xFF,0xFF,0x04,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x09,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xFF,0xF0,0x07,0xFC,0xFF,0x09,0xF8,0x03,0xFF,0xFE,0x00,
+0xF8,0x01,0xFF,0xFE,0x00,0xFF,0xFF,0x01,0xF0,0x00,0xFE,0xFF,0x06,0x00,0x7F,0xFE,0x00,0x7F,0xC0,0x07,0xFF,
+0xFF,0x04,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x09,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xFF,0xE0,0x07,0xFC,0xFF,0x09,0xF8,0x03,0xFF,0xFE,0x00,
+0xF8,0x01,0xFF,0xFC,0x00,0xFF,0xFF,0x01,0xE0,0x03,0xFE,0xFF,0x06,0x00,0x7F,0xFE,0x00,0x7F,0x80,0x0F,0xFF,
+0xFF,0x04,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x09,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xFF,0xE0,0x07,0xFC,0xFF,0x09,0xF8,0x03,0xFF,0xFE,0x00,
+0xF8,0x01,0xFF,0xF8,0x00,0xFF,0xFF,0x01,0xC0,0x03,0xFE,0xFF,0x06,0x00,0x7F,0xFE,0x00,0x7F,0x00,0x1F,0xFF,
+0xFF,0x04,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x09,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xFF,0xC0,0x0F,0xFC,0xFF,0x01,0xF8,0x03,0xFF,0xFF,0x05,
+0x00,0xFC,0x00,0xFF,0xF8,0x01,0xFF,0xFF,0x01,0x80,0x07,0xFE,0xFF,0x06,0x00,0x7F,0xFE,0x00,0x7E,0x00,0x1F,
+0xFF,0xFF,0x04,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x09,0xC0,0x1F,0xFF,0xF0,0x07,0xC0,0x1F,0xFF,0x80,0x0F,0xFC,0xFF,0x09,0xF8,0x03,0xFF,0xFE,0x00,
+0xFC,0x00,0x3F,0xE0,0x01,0xFF,0xFF,0x01,0x80,0x07,0xFE,0xFF,0x06,0x00,0x7F,0xFE,0x00,0x7E,0x00,0x3F,0xFF,
+0xFF,0x04,0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0xC0,0xFE,0x00,0x00,0x0F,0xFC,0xFF,0x00,0xF8,0xFD,0x00,0x00,0xFC,
+0xFE,0x00,0x00,0x01,0xFF,0xFF,0x00,0x80,0xFE,0x00,0x05,0x7F,0x00,0x7F,0xFE,0x00,0x7C,0xFE,0x00,0x05,0x01,
+0xF8,0x01,0xFF,0xF8,0x03,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0xC0,0xFE,0x00,0x00,0x1F,0xFC,0xFF,0x00,0xF8,0xFD,0x00,0x00,0xFE,
+0xFE,0x00,0x00,0x03,0xFF,0xFF,0x00,0x80,0xFE,0x00,0x00,0x3F,0xFD,0x00,0x00,0x7C,0xFE,0x00,0x01,0x01,0xF8,
+0xFE,0x00,0x00,0x03,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0xC0,0xFE,0x00,0x00,0x1F,0xFC,0xFF,0x00,0xF8,0xFD,0x00,0x00,0xFE,
+0xFE,0x00,0x00,0x03,0xFF,0xFF,0x00,0x80,0xFE,0x00,0x00,0x3F,0xFD,0x00,0x00,0xFC,0xFD,0x00,0x00,0xFC,0xFE,
+0x00,0x00,0x03,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0xC0,0xFE,0x00,0x00,0x3F,0xFC,0xFF,0x00,0xF8,0xFD,0x00,0x00,0xFF,
+0xFE,0x00,0x00,0x07,0xFF,0xFF,0x00,0x80,0xFE,0x00,0x00,0x3F,0xFD,0x00,0x00,0xFC,0xFD,0x00,0x00,0xFC,0xFE,
+0x00,0x00,0x03,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0xC0,0xFE,0x00,0x00,0x7F,0xFC,0xFF,0x00,0xF8,0xFD,0x00,0x01,0xFF,
+0x80,0xFF,0x00,0x00,0x0F,0xFF,0xFF,0x00,0x80,0xFE,0x00,0x00,0x3F,0xFD,0x00,0x00,0xFC,0xFD,0x00,0x00,0xFC,
+0xFE,0x00,0x00,0x03,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0xC0,0xFE,0x00,0xFB,0xFF,0x00,0xF8,0xFD,0x00,0x01,0xFF,0xC0,0xFF,
+0x00,0x00,0x1F,0xFF,0xFF,0x00,0x80,0xFE,0x00,0x01,0x3F,0x80,0xFF,0x00,0x01,0x01,0xFC,0xFD,0x00,0x00,0xFE,
+0xFE,0x00,0x00,0x07,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0xC0,0xFF,0x00,0x00,0x01,0xFB,0xFF,0x00,0xF8,0xFD,0x00,0x01,0xFF,
+0xE0,0xFF,0x00,0x00,0x3F,0xFF,0xFF,0x00,0x80,0xFE,0x00,0x01,0x3F,0xC0,0xFF,0x00,0x01,0x03,0xFC,0xFD,0x00,
+0x00,0xFF,0xFE,0x00,0x00,0x0F,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x07,0xC0,0xFF,0x00,0x00,0x03,0xFB,0xFF,0x00,0xF8,0xFD,0x00,0x01,0xFF,
+0xF0,0xFF,0x00,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0x3F,0xE0,0xFF,0x00,0x01,0x07,0xFC,0xFD,0x00,0x01,0xFF,
+0x80,0xFF,0x00,0x00,0x1F,0xFF,0xFF,
+0xFF,0xFF,0x00,0xC0,0xFE,0x00,0x01,0x0F,0xC0,0xFF,0x00,0x00,0x0F,0xFB,0xFF,0x00,0xF8,0xFE,0x00,0x04,0x01,
+0xFF,0xFC,0x00,0x03,0xFE,0xFF,0x00,0x80,0xFE,0x00,0x01,0x3F,0xF0,0xFF,0x00,0x01,0x0F,0xFE,0xFE,0x00,0x02,
+0x01,0xFF,0xC0,0xFF,0x00,0x00,0x3F,0xFF,0xFF,
+0xFF,0xFF,0x00,0xE0,0xFE,0x00,0x01,0x1F,0xE0,0xFF,0x00,0xFA,0xFF,0x00,0xFC,0xFE,0x00,0x00,0x03,0xFF,0xFF,
+0x01,0xC0,0x1F,0xF9,0xFF,0x00,0xFC,0xFF,0x00,0x00,0x3F,0xFB,0xFF,0x00,0xF0,0xFF,0x00,0xFE,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+0xCF,0xFF,
+};
+
+static const uint16_t ppm_image_bg_rows[] = {
+0,2,4,6,8,10,20,30,40,49,58,67,
+76,88,100,112,128,144,160,176,193,214,237,262,
+287,328,365,404,446,487,528,570,612,652,693,735,
+777,818,860,903,946,991,1030,1069,1111,1138,1161,1184,
+1206,1229,1251,1270,1288,1304,1315,1326,1337,1348,1357,1366,
+1375,1384,1395,1403,1413,1415,1417,1419,1421,1423,1429,1431,
+1433,1435,1437,1439,1441,1443,1445,1447,1449,1459,1469,1479,
+1489,1499,1513,1528,1544,1562,1580,1598,1618,1669,1720,1770,
+1820,1870,1920,1971,2020,2069,2121,2172,2223,2274,2325,2376,
+2430,2483,2536,2590,2644,2698,2750,2803,2856,2909,2964,3019,
+3072,3126,3180,3232,3283,3300,3318,3328,3336,3343,3345,3347,
+3349,3351,3353,3355,3357,3359,3361,3363,3365,3367,3369,3371,
+3387,3403,3419,3435,3452,3469,3487,3505,3523,3541,3557,3573,
+3589,3605,3621,3637,3653,3669,3685,3702,3719,3736,3753,3770,
+3787,3804,3821,3840,3859,3878,3897,3916,3918,3920,3922,3924,
+3926,3928,3930,3932,3934,3936,3938,3940,3942,3944,3946,3948,
+3950,3952,3954,3956,3958,3960,3962,3964,3966,3968,3970,3972,
+3974,3976,3978,3980,3982,3984,3986,3988,4040,4092,4142,4195,
+4246,4297,4347,4398,4449,4499,4549,4599,4649,4699,4750,4801,
+4850,4895,4940,4986,5032,5077,5122,5171,5220,5269,5318,5367,
+5414,5461,5509,5555,5601,5647,5694,5741,5788,5839,5889,5942,
+5994,6046,6097,6148,6199,6251,6302,6351,6399,6446,6493,6541,
+6589,6639,6688,6739,6779,6781,6783,6785,6787,6789,6791,6793,
+6795,6797,6799,6801,6803,6805,6807,6809,6811,6813,6815,6817,
+6819,6821,6823,6825,6827,6829,6831,6833,6835,6837,6839,6841,
+};
+
+extern const PackedImage ppm_image_bg = {
+    400, 300, ppm_image_bg_rows, ppm_image_bg_data
+};
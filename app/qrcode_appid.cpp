@@ -0,0 +1,30 @@
+#include "QRCode/src/qrcode.h"
+#include "boardmap.h"
+
+// QR code of QRCODE_APP_ID, version 4, 33 x 33 modules, ECC_LOW, MODE_BYTE, mask 5
+// Generated with tools/pack_qrcode.py, do not edit
+static constexpr char AppIdQRCode_payload[] = "LicensePlate2Tangle,uid=E24F43FFFE44C3FC";
+
+static constexpr bool AppIdQRCode_equals(const char *a, const char *b)
+{
+    return *a == *b && (*a == '\0' || AppIdQRCode_equals(a + 1, b + 1));
+}
+
+static_assert(AppIdQRCode_equals(AppIdQRCode_payload, QRCODE_APP_ID),
+              "QRCODE_APP_ID has changed, generate AppIdQRCode again with tools/pack_qrcode.py");
+
+static const uint8_t AppIdQRCode_modules[] = {
+0xFE,0x77,0x77,0x3F,0xC1,0x0C,0x9B,0x50,0x6E,0x9C,0xA7,0x0B,0xB7,0x56,0x66,0xC5,
+0xDB,0xAA,0xF4,0x7A,0xEC,0x13,0x36,0x55,0x07,0xFA,0xAA,0xAA,0xFE,0x00,0x98,0xC3,
+0x00,0xC7,0x6B,0x00,0x0C,0x0E,0x11,0x10,0xCE,0x18,0xF6,0x0C,0x18,0x56,0x26,0x73,
+0x44,0xEF,0xEE,0x66,0xDB,0x08,0xA3,0x72,0x01,0x96,0x8C,0x1F,0x29,0x55,0x12,0xDD,
+0xF4,0xBE,0x56,0x8B,0x07,0x40,0x0A,0x90,0x54,0xDB,0x75,0xCB,0xBE,0x64,0xAC,0x8A,
+0x73,0x00,0xE7,0xB1,0x0A,0x6C,0xEC,0xE1,0x66,0x18,0x52,0xBD,0x1F,0x29,0x0D,0x00,
+0xD8,0xE1,0xAC,0xD2,0xDD,0xD4,0xFC,0x00,0x50,0x58,0x46,0x3F,0xAE,0x0B,0xEA,0xD0,
+0x52,0x23,0x31,0xDB,0xA7,0x0A,0x0F,0x8D,0xD0,0x72,0x5C,0x56,0xE9,0xC4,0x73,0x2F,
+0x05,0x58,0xD2,0xCC,0xFE,0xEB,0x09,0x85,0x00,
+};
+
+extern const QRCode AppIdQRCode = {
+    4, 33, ECC_LOW, MODE_BYTE, 5, const_cast<uint8_t *>(AppIdQRCode_modules)
+};
@@ -22,11 +22,15 @@
 #include "app/LoraCommunication.h"
 #include "app/LicensePlateDisplay.h"
 #include "app/ParkingArea.h"
+#include "app/QRCodeService.h"
 
 #include "JSON/Json.h"
 #include "QRCode/src/qrcode.h"
 
 
+// QRCode of QRCODE_APP_ID, generated with tools/pack_qrcode.py
+extern const QRCode AppIdQRCode;
+
 // Standard console configuration
 static BufferedSerial serial_port(CONSOLE_TX, CONSOLE_RX, CONSOLE_BAUD);
 
@@ -35,10 +39,16 @@ FileHandle *mbed::mbed_override_console(int fd)
     return &serial_port;
 }
 
+// The QRCode of the session, static to keep its buffers off the stack
+static QRCodeService qrCodeService;
+
 /**
- * Parse a json message and look for license plate and endtime information 
+ * Parse a json message and look for license plate and endtime information,
+ * the country of the license plate is optional. A message may also only
+ * carry the token of a new session, the license is empty then
  */
-bool parseJsonMessage(const char* jsonString, size_t length, std::string &license, time_t &endtime)
+bool parseJsonMessage(const char* jsonString, size_t length, std::string &license,
+                      std::string &country, time_t &endtime, std::string &session)
 {
 
     Json json(jsonString, strlen(jsonString));
@@ -54,10 +64,24 @@ bool parseJsonMessage(const char* jsonString, size_t length, std::string &licens
         return false;
     }
 
+    // The token of a new session, shown with the QRCode
+    session.clear();
+    int keyIndex = json.findKeyIndexIn("s", 0);
+    if (-1 != keyIndex) {
+        int valueIndex = json.findChildIndexOf(keyIndex, -1);
+        if (valueIndex > 0) {
+            session = std::string(json.tokenAddress(valueIndex), json.tokenLength(valueIndex));
+        }
+    }
+
     // 1. find valid license plate data
-    int keyIndex = json.findKeyIndexIn("l", 0);
+    license.clear();
+    keyIndex = json.findKeyIndexIn("l", 0);
 
     if (-1 == keyIndex) {
+        if (!session.empty()) {
+            return true;
+        }
         printf("JSON: No valid license data found\r\n");
         return false;
     }
@@ -67,10 +91,17 @@ bool parseJsonMessage(const char* jsonString, size_t length, std::string &licens
             const char *valueStart = json.tokenAddress(valueIndex);
             int valueLength = json.tokenLength(valueIndex);
 
-            char value[32];
-            strncpy(value, valueStart, valueLength);
-            value[valueLength] = 0; // NULL-terminate the string
-            license = std::string(value);
+            license = std::string(valueStart, valueLength);
+        }
+    }
+
+    // The sign of the country, e.g. "F", germany if there is none
+    country.clear();
+    keyIndex = json.findKeyIndexIn("c", 0);
+    if (-1 != keyIndex) {
+        int valueIndex = json.findChildIndexOf(keyIndex, -1);
+        if (valueIndex > 0) {
+            country = std::string(json.tokenAddress(valueIndex), json.tokenLength(valueIndex));
         }
     }
 
@@ -150,13 +181,9 @@ int main()
     // For now the battery level is not supported, for now set it to full
     display.setBatteryLevel(BatteryLevel::FULL);
 
-    // The QRCode will only be generated once
-    printf("Create QRCode from device...\r\n");
-    QRCode qrcode;
-    uint8_t *qrcodeData = new uint8_t[qrcode_getBufferSize(4)];
-    qrcode_initText(&qrcode, qrcodeData, 4, 0, QRCODE_APP_ID);   
-
-    display.setQRCode(&qrcode);
+    // The QRCode of the device is encoded at build time and kept in flash,
+    // see app/qrcode_appid.cpp
+    display.setQRCode(&AppIdQRCode);
 
     // On startup and show the welcome screen 
     printf("Show welcome screen...\r\n");
@@ -169,6 +196,13 @@ int main()
 
     // This is the main loop
     while (true) {
+        // Keep the temperature shown on the display up to date,
+        // only the status region is sent if the value has changed.
+        // The display thread does the refresh, so this does not block
+        sensorBoard.read();
+        display.setTemperature(sensorBoard.getValueFloat(Temperature1));
+        display.updateStatus();
+
         // Now wait until the lora communication module is ready
         if (LoraCommunication::Status::UP == lora.getStatus()) {
 
@@ -195,21 +229,36 @@ int main()
             // RX: Poll for incoming data
             // --------------------------
             // This is the data we expect from the server: {"l":"IO:TA2020","t":1606004894}
+            // optionally with the country of the license plate: "c":"F"
+            // and the token of a new session: "s":"8KQ2ZP", which may also come alone
 
             if (true == lora.receiveMessage((uint8_t *)messageBuffer, sizeof(messageBuffer), &receivedBytes))
             {
                 std::string license;
+                std::string country;
                 time_t endtime;
-
-                if(true == parseJsonMessage(messageBuffer, sizeof(receivedBytes), license, endtime)) {
-                    printf("Show the ne booking parameter on the parking sign...\r\n");
-                    printf("License Plate: %s\r\n", license.c_str());
-
-                    display.setLicense(license);
-                    display.setParkingEndTime(endtime);
-
-                    // Finally there is booking, so lets show the customer
-                    display.showParkingScreen();
+                std::string session;
+
+                if(true == parseJsonMessage(messageBuffer, sizeof(receivedBytes), license, country, endtime, session)) {
+                    // A new session gets its own QRCode, the app id stays if it can not be encoded
+                    if (!session.empty()) {
+                        const QRCode *sessionQRCode = qrCodeService.encode(session);
+                        if (nullptr != sessionQRCode) {
+                            display.setQRCode(sessionQRCode);
+                            display.updateStatus();
+                        }
+                    }
+
+                    if (!license.empty()) {
+                        printf("Show the ne booking parameter on the parking sign...\r\n");
+                        printf("License Plate: %s\r\n", license.c_str());
+
+                        display.setLicense(license, country);
+                        display.setParkingEndTime(endtime);
+
+                        // Finally there is booking, so lets show the customer
+                        display.showParkingScreen();
+                    }
                 }
                 else {
                     printf("Received message from the server is not a valid json message\n");
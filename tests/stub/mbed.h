@@ -0,0 +1,174 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/**
+ * The part of the mbed-os API the display driver uses, for the host tests.
+ * The SPI records every byte written together with the level of the pin
+ * MockSpi::dcPin, the BUSY pin always reads idle.
+ */
+
+#ifndef MBED_STUB_H
+#define MBED_STUB_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+typedef int PinName;
+
+#define NC                      -1
+#define DEVICE_SPI_ASYNCH       0
+#define osWaitForever           0xFFFFFFFFU
+#define osFlagsError            0x80000000U
+#define osFlagsErrorTimeout     0xFFFFFFFEU
+
+
+/**
+ * Bytes written to the SPI since the last clear()
+ */
+struct MockSpi
+{
+    struct Transfer {
+        int dc;             // level of the data / command pin
+        unsigned char data;
+    };
+
+    static std::vector<Transfer> transfers;
+    static int pinLevels[64];
+    static PinName dcPin;
+
+    static void clear() { transfers.clear(); }
+};
+
+
+template <typename F> class Callback;
+
+template <typename R, typename... A>
+class Callback<R(A...)>
+{
+public:
+    Callback() {}
+    Callback(std::nullptr_t) {}
+    template <typename F> Callback(F f) : function(f) {}
+    R operator()(A... a) const { return function(a...); }
+    explicit operator bool() const { return (bool)function; }
+
+private:
+    std::function<R(A...)> function;
+};
+
+template <typename T, typename R, typename... A>
+Callback<R(A...)> callback(T *object, R (T::*method)(A...))
+{
+    return Callback<R(A...)>([object, method](A... a) { return (object->*method)(a...); });
+}
+
+
+class SPI
+{
+public:
+    SPI(PinName mosi, PinName miso, PinName sclk) {}
+    void format(int bits, int mode = 0) {}
+    void frequency(int hz) {}
+
+    int write(int value)
+    {
+        MockSpi::transfers.push_back({MockSpi::pinLevels[MockSpi::dcPin], (unsigned char)value});
+        return 0;
+    }
+
+    int write(const char *tx, int tx_length, char *rx, int rx_length)
+    {
+        for (int i = 0; i < tx_length; i++) {
+            write((unsigned char)tx[i]);
+        }
+        return tx_length;
+    }
+};
+
+class DigitalOut
+{
+public:
+    DigitalOut(PinName pin, int value = 0) : pin(pin) { write(value); }
+    void write(int value) { MockSpi::pinLevels[pin] = value; }
+    int read() { return MockSpi::pinLevels[pin]; }
+    DigitalOut &operator=(int value) { write(value); return *this; }
+    operator int() { return read(); }
+
+private:
+    PinName pin;
+};
+
+class DigitalIn
+{
+public:
+    DigitalIn(PinName pin) {}
+    int read() { return 1; }
+    operator int() { return read(); }
+};
+
+class InterruptIn
+{
+public:
+    InterruptIn(PinName pin) {}
+    int read() { return 1; }
+    operator int() { return read(); }
+    void rise(Callback<void()> function) {}
+    void fall(Callback<void()> function) {}
+};
+
+class EventFlags
+{
+public:
+    uint32_t set(uint32_t flags) { return this->flags |= flags; }
+    uint32_t clear(uint32_t flags = 0x7fffffff) { uint32_t old = this->flags; this->flags &= ~flags; return old; }
+    uint32_t get() const { return flags; }
+    uint32_t wait_any(uint32_t flags, uint32_t millisec = osWaitForever, bool clear = true)
+    {
+        uint32_t result = this->flags & flags;
+        if (0 == result) {
+            return osFlagsErrorTimeout;
+        }
+        if (clear) {
+            this->flags &= ~flags;
+        }
+        return result;
+    }
+
+private:
+    uint32_t flags = 0;
+};
+
+namespace Kernel {
+struct Clock
+{
+    typedef std::chrono::milliseconds duration;
+    typedef std::chrono::time_point<Clock> time_point;
+
+    static time_point now()
+    {
+        return time_point(std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch()));
+    }
+};
+}
+
+namespace ThisThread {
+inline void sleep_for(uint32_t millisec) {}
+}
+
+#endif /* MBED_STUB_H */
@@ -0,0 +1,233 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/**
+ * Host tests of the screens painted band by band against the full frame
+ * buffer, see tests/Makefile
+ */
+
+#include "DisplayList.h"
+#include "epd4in2b.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+
+#define COLORED     0
+
+/* The widgets of the screens, as LicensePlateDisplay builds them */
+static const int kWidgetBackground = 0;
+static const int kWidgetTemperature = 1;
+static const int kWidgetBattery = 2;
+static const int kWidgetQRCode = 3;
+static const int kWidgetTime = 4;
+static const int kWidgetDate = 5;
+static const int kWidgetPlate = 6;
+static const int kWidgetCountdown = 7;
+
+static const int kPlateX = 10;
+static const int kPlateWidth = EPD_WIDTH - kPlateX;
+
+static const int kLineBytes = EPD_WIDTH / 8;
+static const int kFrameBytes = kLineBytes * EPD_HEIGHT;
+
+extern const PackedImage bg_welcomescreen;
+extern const PackedImage bg_parkingscreen;
+extern const QRCode AppIdQRCode;
+extern sFONT PackedFont24;
+extern sFONT PackedFont4040;
+
+static unsigned char expected[kFrameBytes];     // the screen painted into the full frame buffer
+static unsigned char panel[kFrameBytes];        // the bands as they were sent to the display
+static unsigned char bands[2][kFrameBytes];
+
+static int failures = 0;
+
+#define CHECK(condition, ...) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+
+static void buildWelcomeScreen(DisplayList &displayList)
+{
+    displayList.clear();
+    displayList.addBackground(kWidgetBackground, &bg_welcomescreen, COLORED);
+    displayList.addText(kWidgetTemperature, 243, 26, 84, TextLayout::Align::RIGHT, &PackedFont24, COLORED);
+    displayList.addBarGauge(kWidgetBattery, 340, 30, 11, 12, 1, 3, COLORED);
+    displayList.addQRCode(kWidgetQRCode, 30, 100, 5, COLORED);
+}
+
+static void buildParkingScreen(DisplayList &displayList)
+{
+    displayList.clear();
+    displayList.addBackground(kWidgetBackground, &bg_parkingscreen, COLORED);
+    displayList.addText(kWidgetTemperature, 243, 26, 84, TextLayout::Align::RIGHT, &PackedFont24, COLORED);
+    displayList.addBarGauge(kWidgetBattery, 340, 30, 11, 12, 1, 3, COLORED);
+    displayList.addText(kWidgetTime, 100, 115, 140, TextLayout::Align::CENTER, &PackedFont4040, COLORED);
+    displayList.addText(kWidgetCountdown, 100, 170, 140, TextLayout::Align::CENTER, &PackedFont24, COLORED);
+    displayList.addText(kWidgetDate, 260, 140, 136, TextLayout::Align::CENTER, &PackedFont4040, COLORED);
+    displayList.addPlate(kWidgetPlate, kPlateX, 210, kPlateWidth, COLORED);
+}
+
+static void fillRandom(unsigned char *buffer, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = rand();
+    }
+}
+
+/**
+ * The whole screen painted at once into the full frame buffer
+ */
+static void paintFullFrame(DisplayList &displayList)
+{
+    fillRandom(expected, sizeof(expected));
+    Paint painter(expected, EPD_WIDTH, EPD_HEIGHT);
+    displayList.paint(painter, 0, 0, EPD_WIDTH - 1, EPD_HEIGHT - 1);
+}
+
+/**
+ * The screen streamed band by band like LicensePlateDisplay::showScreen(),
+ * the last band is cut at the bottom of the frame
+ */
+static void paintScreenInBands(DisplayList &displayList, int bandRows)
+{
+    Paint painter(bands[0], EPD_WIDTH, EPD_HEIGHT);
+    fillRandom(panel, sizeof(panel));
+    for (int y = 0, i = 0; y < EPD_HEIGHT; y += bandRows, i++) {
+        fillRandom(bands[i % 2], sizeof(bands[0]));
+        painter.SetImage(bands[i % 2]);
+        painter.SetBand(y, bandRows);
+        displayList.paint(painter, 0, y, EPD_WIDTH - 1, y + painter.GetBandHeight() - 1);
+        memcpy(&panel[y * kLineBytes], painter.GetImage(), painter.GetBandHeight() * kLineBytes);
+    }
+    displayList.markShown();
+}
+
+/**
+ * The changed region painted band by band like LicensePlateDisplay::showChanges(),
+ * the last band is moved up to end at the bottom of the frame. only the
+ * drawn rectangle of every band is sent
+ */
+static void paintChangesInBands(DisplayList &displayList, int bandRows)
+{
+    int x0, y0, x1, y1;
+    if (!displayList.getDirtyRegion(&x0, &y0, &x1, &y1)) {
+        return;
+    }
+
+    Paint painter(bands[0], EPD_WIDTH, EPD_HEIGHT);
+    for (int y = y0; y <= y1; y += bandRows) {
+        fillRandom(bands[0], sizeof(bands[0]));
+        painter.SetBand(std::min(y, EPD_HEIGHT - bandRows), bandRows);
+        displayList.paint(painter, x0, y0, x1, y1);
+
+        int x, top, w, h;
+        if (painter.GetDirtyRect(&x, &top, &w, &h)) {
+            for (int j = top; j < top + h; j++) {
+                memcpy(&panel[j * kLineBytes + x / 8],
+                       &painter.GetImage()[(j - painter.GetBandY()) * kLineBytes + x / 8], w / 8);
+            }
+        }
+        painter.ClearDirtyRect();
+    }
+    displayList.markShown();
+}
+
+/**
+ * Every screen and every update painted in bands of several heights is
+ * the same frame as painting it at once
+ */
+static void testBandsMatchFullFrame()
+{
+    static const int kBandRows[] = {1, 7, 16, 24, 100, EPD_HEIGHT - 1, EPD_HEIGHT};
+    static const char *kPlates[][2] = {{"D", "IO:TA2020"}, {"F", "AB-123-CD"}, {"NL", "12-ABC-3"}};
+
+    DisplayList displayList;
+    LicensePlate plate(kPlateWidth);
+    srand(10);
+
+    int frames = 0;
+    for (int bandRows : kBandRows) {
+        buildWelcomeScreen(displayList);
+        displayList.setText(kWidgetTemperature, "23.4C");
+        displayList.setLevel(kWidgetBattery, 2);
+        displayList.setQRCode(kWidgetQRCode, &AppIdQRCode);
+        paintScreenInBands(displayList, bandRows);
+        paintFullFrame(displayList);
+        CHECK(0 == memcmp(panel, expected, sizeof(panel)), "welcome screen in %d row bands differs", bandRows);
+        frames++;
+
+        // The qrcode disappears, then the temperature and the battery change
+        displayList.setQRCode(kWidgetQRCode, nullptr);
+        paintChangesInBands(displayList, bandRows);
+        paintFullFrame(displayList);
+        CHECK(0 == memcmp(panel, expected, sizeof(panel)), "welcome screen without qrcode in %d row bands differs",
+              bandRows);
+        displayList.setText(kWidgetTemperature, "-5.0C");
+        displayList.setLevel(kWidgetBattery, 3);
+        paintChangesInBands(displayList, bandRows);
+        paintFullFrame(displayList);
+        CHECK(0 == memcmp(panel, expected, sizeof(panel)), "welcome screen update in %d row bands differs",
+              bandRows);
+        frames += 2;
+
+        buildParkingScreen(displayList);
+        displayList.setText(kWidgetTemperature, "23.4C");
+        displayList.setLevel(kWidgetBattery, 1);
+        displayList.setText(kWidgetTime, "18:45");
+        displayList.setText(kWidgetDate, "21.11");
+        displayList.setText(kWidgetCountdown, "1:30 h");
+        plate.setLicense(kPlates[0][0], kPlates[0][1]);
+        displayList.setPlate(kWidgetPlate, &plate);
+        paintScreenInBands(displayList, bandRows);
+        paintFullFrame(displayList);
+        CHECK(0 == memcmp(panel, expected, sizeof(panel)), "parking screen in %d row bands differs", bandRows);
+        frames++;
+
+        // The countdown and the plate at the bottom change, so the last band is moved up
+        for (int i = 1; i < 3; i++) {
+            displayList.setText(kWidgetCountdown, i == 1 ? "59 min" : "3 min");
+            plate.setLicense(kPlates[i][0], kPlates[i][1]);
+            displayList.setPlate(kWidgetPlate, &plate);
+            paintChangesInBands(displayList, bandRows);
+            paintFullFrame(displayList);
+            CHECK(0 == memcmp(panel, expected, sizeof(panel)), "parking screen update %d in %d row bands differs",
+                  i, bandRows);
+            frames++;
+        }
+    }
+    printf("display list: %d frames painted in bands match the full frame\n", frames);
+}
+
+
+int main()
+{
+    testBandsMatchFullFrame();
+
+    if (failures) {
+        printf("display list: %d failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,258 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/**
+ * Host tests of the display driver against the recording SPI of
+ * tests/stub/mbed.h, see tests/Makefile
+ */
+
+#include "epd4in2b.h"
+#include "epdpaint.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+static const int kLineBytes = EPD_WIDTH / 8;
+static const int kFrameBytes = kLineBytes * EPD_HEIGHT;
+
+static const PinName kDcPin = 5;
+
+static unsigned char frame[kFrameBytes];
+static unsigned char shadow[kFrameBytes];
+static unsigned char panel[kFrameBytes];      // black SRAM of the panel, as the recorded bytes wrote it
+static unsigned char previous[kFrameBytes];
+
+static int failures = 0;
+
+#define CHECK(condition, ...) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+
+/**
+ * What the recorded bytes did to the panel
+ */
+struct Upload
+{
+    int pixelBytes;     // bytes written to the black SRAM
+    int windows;        // partial windows written to
+    int refreshes;
+};
+
+/**
+ * Replay the recorded bytes into the panel SRAM model
+ */
+static Upload replay()
+{
+    Upload upload = {0, 0, 0};
+    int command = -1;
+    int parameter = 0;
+    unsigned char window[9];
+    bool partial = false;
+    int x0 = 0, x1 = EPD_WIDTH - 1, y0 = 0, y1 = EPD_HEIGHT - 1;
+    int position = 0;
+
+    for (auto &transfer : MockSpi::transfers) {
+        if (0 == transfer.dc) {
+            command = transfer.data;
+            parameter = 0;
+            position = 0;
+            if (PARTIAL_IN == command) {
+                partial = true;
+            } else if (PARTIAL_OUT == command) {
+                partial = false;
+            } else if (DISPLAY_REFRESH == command) {
+                upload.refreshes++;
+            }
+            continue;
+        }
+
+        if (PARTIAL_WINDOW == command && parameter < 9) {
+            window[parameter++] = transfer.data;
+            if (9 == parameter) {
+                x0 = (window[0] << 8 | window[1]) & ~0x07;
+                x1 = window[2] << 8 | window[3];
+                y0 = window[4] << 8 | window[5];
+                y1 = window[6] << 8 | window[7];
+                upload.windows++;
+            }
+        } else if (DATA_START_TRANSMISSION_2 == command) {
+            int w = partial ? (x1 - x0 + 1) / 8 : kLineBytes;
+            int x = partial ? x0 / 8 : 0;
+            int y = partial ? y0 : 0;
+            if (position < w * (partial ? y1 - y0 + 1 : EPD_HEIGHT)) {
+                panel[(y + position / w) * kLineBytes + x + position % w] = transfer.data;
+            }
+            position++;
+            upload.pixelBytes++;
+        }
+    }
+    MockSpi::clear();
+    return upload;
+}
+
+/**
+ * Bytes of the bounding box of the changes between two frames
+ */
+static int changedBoxBytes(const unsigned char *a, const unsigned char *b)
+{
+    int first = kLineBytes, last = -1, top = EPD_HEIGHT, bottom = -1;
+    for (int y = 0; y < EPD_HEIGHT; y++) {
+        for (int x = 0; x < kLineBytes; x++) {
+            if (a[y * kLineBytes + x] != b[y * kLineBytes + x]) {
+                first = x < first ? x : first;
+                last = x > last ? x : last;
+                top = y < top ? y : top;
+                bottom = y;
+            }
+        }
+    }
+    return last < 0 ? 0 : (last - first + 1) * (bottom - top + 1);
+}
+
+static Upload displayDiff(Epd &epd, int expectedBands)
+{
+    memcpy(previous, panel, sizeof(panel));
+    int bands = epd.DisplayFrameDiff(frame);
+    Upload upload = replay();
+    CHECK(expectedBands == bands, "%d bands sent, expected %d", bands, expectedBands);
+    CHECK(0 == memcmp(panel, frame, sizeof(frame)), "the panel does not show the frame");
+    CHECK(0 == memcmp(shadow, frame, sizeof(frame)), "the shadow frame is not the frame");
+    return upload;
+}
+
+
+static void testDisplayFrameDiff()
+{
+    MockSpi::dcPin = kDcPin;
+    Epd epd(1, 2, 3, 4, kDcPin, 6, 7, 8);
+    epd.SetShadowFrame(shadow);
+    Paint paint(frame, EPD_WIDTH, EPD_HEIGHT);
+    Upload upload;
+
+    // Without a valid shadow frame the whole frame is sent
+    paint.Clear(1);
+    paint.DrawStringAt(243, 26, "23.4C", &Font24, 0);
+    upload = displayDiff(epd, 1);
+    CHECK(kFrameBytes == upload.pixelBytes, "first frame: %d bytes", upload.pixelBytes);
+    CHECK(1 == upload.refreshes, "first frame: %d refreshes", upload.refreshes);
+
+    // An identical redraw sends nothing and does not refresh
+    paint.Clear(1);
+    paint.DrawStringAt(243, 26, "23.4C", &Font24, 0);
+    upload = displayDiff(epd, 0);
+    CHECK(0 == upload.pixelBytes && 0 == upload.refreshes, "identical redraw: %d bytes, %d refreshes",
+          upload.pixelBytes, upload.refreshes);
+    CHECK(0 == MockSpi::transfers.size(), "identical redraw: bytes were sent");
+
+    // A single pixel is one byte of one row
+    paint.DrawPixel(100, 50, 0);
+    upload = displayDiff(epd, 1);
+    CHECK(1 == upload.pixelBytes && 1 == upload.windows, "pixel: %d bytes in %d windows",
+          upload.pixelBytes, upload.windows);
+
+    // A changed digit of the temperature is its bounding box
+    paint.DrawFilledRectangle(243, 26, 243 + 5 * Font24.Width, 26 + Font24.Height, 1);
+    paint.DrawStringAt(243, 26, "23.5C", &Font24, 0);
+    int box = changedBoxBytes(frame, panel);
+    upload = displayDiff(epd, 1);
+    CHECK(box == upload.pixelBytes, "temperature: %d bytes, the changes span %d", upload.pixelBytes, box);
+    CHECK(box < 4 * Font24.Height, "temperature: the changes span %d bytes", box);
+
+    // Changes closer than EPD_DIFF_BAND_GAP rows are one band of their common columns
+    paint.DrawPixel(20, 10, 0);
+    paint.DrawPixel(44, 10 + EPD_DIFF_BAND_GAP, 0);
+    upload = displayDiff(epd, 1);
+    CHECK(4 * (EPD_DIFF_BAND_GAP + 1) == upload.pixelBytes, "close rows: %d bytes", upload.pixelBytes);
+
+    // Changes further apart are separate bands
+    paint.DrawPixel(20, 100, 0);
+    paint.DrawPixel(20, 100 + EPD_DIFF_BAND_GAP + 2, 0);
+    upload = displayDiff(epd, 2);
+    CHECK(2 == upload.pixelBytes && 2 == upload.windows, "distant rows: %d bytes in %d windows",
+          upload.pixelBytes, upload.windows);
+
+    // A screen change sends the whole frame as one band
+    paint.Clear(0);
+    upload = displayDiff(epd, 1);
+    CHECK(kFrameBytes == upload.pixelBytes, "screen change: %d bytes", upload.pixelBytes);
+
+    printf("epd: frame diff uploads checked\n");
+}
+
+
+// Streamed rows reach the panel and the shadow frame at their column, also past x = 255
+static void testStreamWindow()
+{
+    static const int kX = 264, kY = 40, kW = 64, kL = 20;
+    unsigned char rows[kW / 8 * kL];
+
+    MockSpi::dcPin = kDcPin;
+    Epd epd(1, 2, 3, 4, kDcPin, 6, 7, 8);
+    epd.SetShadowFrame(shadow);
+    Paint paint(frame, EPD_WIDTH, EPD_HEIGHT);
+    Upload upload;
+
+    paint.Clear(1);
+    displayDiff(epd, 1);
+
+    paint.DrawStringAt(kX + 3, kY + 2, "42", &Font16, 0);
+    paint.DrawLine(kX, kY + kL - 1, kX + kW - 1, kY, 0);
+    for (int j = 0; j < kL; j++) {
+        memcpy(&rows[j * kW / 8], &frame[(kY + j) * kLineBytes + kX / 8], kW / 8);
+    }
+
+    // In two parts, as the display thread streams its bands
+    epd.StreamWindowBegin(kX, kY, kW, kL);
+    CHECK(0 == epd.StreamWindowRows(rows, kL / 2), "stream: first rows not sent");
+    CHECK(0 == epd.StreamWindowRows(&rows[kW / 8 * kL / 2], kL - kL / 2), "stream: last rows not sent");
+    CHECK(0 == epd.StreamWindowEnd(), "stream: window not closed");
+    upload = replay();
+    CHECK(kW / 8 * kL == upload.pixelBytes && 1 == upload.windows, "stream: %d bytes in %d windows",
+          upload.pixelBytes, upload.windows);
+    CHECK(0 == memcmp(panel, frame, sizeof(frame)), "stream: the panel does not show the frame");
+    CHECK(0 == memcmp(shadow, frame, sizeof(frame)), "stream: the shadow frame is not the frame");
+
+    // The shadow frame knows the streamed rows, so redrawing them sends nothing
+    upload = displayDiff(epd, 0);
+    CHECK(0 == upload.pixelBytes, "stream redraw: %d bytes", upload.pixelBytes);
+
+    // A change next to the streamed rows is found against them
+    paint.DrawPixel(kX + kW - 1, kY + kL - 1, 0);
+    upload = displayDiff(epd, 1);
+    CHECK(1 == upload.pixelBytes, "stream change: %d bytes", upload.pixelBytes);
+
+    printf("epd: streamed window checked\n");
+}
+
+
+int main()
+{
+    testDisplayFrameDiff();
+    testStreamWindow();
+
+    if (failures) {
+        printf("epd: %d failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/**
+ * Host tests of the license plate formats, see tests/Makefile
+ */
+
+#include "LicensePlate.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+
+extern sFONT PackedEuroFont9664;
+extern sFONT PackedEuroFont7248;
+extern sFONT PackedEuroFont4832;
+
+static const int kWidth = 400;
+static const int kHeight = 300;
+static const int kPlateX = 5;
+static const int kPlateY = 120;
+static const int kPlateWidth = 390;
+
+static unsigned char image[kWidth / 8 * kHeight];
+
+static int failures = 0;
+
+#define CHECK(condition, ...) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+
+/**
+ * Licenses as the server sends them and as the plates show them
+ */
+static void testFormats()
+{
+    static const struct {
+        const char *sign;
+        const char *license;
+        const char *expectedSign;
+        const char *expectedText;
+    } plates[] = {
+        {"D",   "IO:TA2020",        "D",   "IO:TA 2020"},
+        {"",    "M AB 1234",        "D",   "M:AB 1234"},
+        {"D",   "B-MW-1234E",       "D",   "B:MW 1234E"},
+        {"d",   "hh:ab123",         "D",   "HH:AB 123"},
+        {"D",   "ABCDEFGHIJKLMN",   "D",   "ABCDEFGHI"},
+        {"D",   "::--",             "D",   ""},
+        {"D",   "",                 "D",   ""},
+        {"A",   "W 12345 X",        "A",   "W 12345 X"},
+        {"B",   "1-abc-123",        "B",   "1-ABC-123"},
+        {"CH",  "ZH 123456",        "CH",  "ZH 123456"},
+        {"CZ",  "1A2 3456",         "CZ",  "1A2 3456"},
+        {"DK",  "AB 12 345",        "DK",  "AB 12 345"},
+        {"E",   "1234 BCD",         "E",   "1234 BCD"},
+        {"f",   "ab-123-cd",        "F",   "AB-123-CD"},
+        {"FIN", "ABC-123",          "FIN", "ABC-123"},
+        {"I",   "AB 123CD",         "I",   "AB 123CD"},
+        {"L",   "AB 1234",          "L",   "AB 1234"},
+        {"NL",  "12-ABC-3",         "NL",  "12-ABC-3"},
+        {"PL",  "WA 12345",         "PL",  "WA 12345"},
+        {"S",   "ABC 12A",          "S",   "ABC 12A"},
+        {"UK",  "AB12 CDE",         "UK",  "AB12 CDE"},
+        {"LT",  "ABC 123",          "LT",  "ABC 123"},
+        {"IRLX", "12-D-34567",      "IRL", "12 D 34567"},
+    };
+
+    LicensePlate plate(kPlateWidth);
+    for (auto &entry : plates) {
+        plate.setLicense(entry.sign, entry.license);
+        CHECK(0 == strcmp(entry.expectedSign, plate.getSign()), "%s %s: sign %s, expected %s",
+              entry.sign, entry.license, plate.getSign(), entry.expectedSign);
+        CHECK(0 == strcmp(entry.expectedText, plate.getText()), "%s %s: text \"%s\", expected \"%s\"",
+              entry.sign, entry.license, plate.getText(), entry.expectedText);
+    }
+
+    CHECK(nullptr == LicensePlate::findFormat("LT"), "LT has a format");
+    CHECK(false == LicensePlate::findFormat("CH")->band, "CH plates have a band");
+    printf("license plate: %d formats checked\n", (int)(sizeof(plates) / sizeof(plates[0])));
+}
+
+/**
+ * A license of a pattern, 'a' is a random letter, '9' a random digit
+ */
+static std::string generate(const char *pattern)
+{
+    std::string license;
+    for (const char *p = pattern; '\0' != *p; p++) {
+        if ('a' == *p) {
+            license += 'A' + rand() % 26;
+        } else if ('9' == *p) {
+            license += '0' + rand() % 10;
+        } else {
+            license += *p;
+        }
+    }
+    return license;
+}
+
+/**
+ * Pixels set in the frame outside of the rectangle
+ */
+static int pixelsOutside(int x0, int y0, int x1, int y1)
+{
+    int count = 0;
+    for (int y = 0; y < kHeight; y++) {
+        for (int x = 0; x < kWidth; x++) {
+            bool inside = x >= x0 && x <= x1 && y >= y0 && y <= y1;
+            if (!inside && (image[y * kWidth / 8 + x / 8] & (0x80 >> (x % 8)))) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Plates of many formats are drawn within the plate area in the largest
+ * font they fit, the layout and drawing time is reported
+ */
+static void testPlatesFit()
+{
+    static const struct {
+        const char *sign;
+        const char *pattern;
+    } patterns[] = {
+        {"D", "a:aa9999"}, {"D", "aaa:aa999"}, {"D", "a:a9"}, {"D", "aa:a99e"}, {"D", "aaa:aa9999e"},
+        {"", "a a 9"}, {"A", "a 99999a"}, {"B", "9-aaa-999"}, {"CH", "aa 999999"}, {"CZ", "9a9 9999"},
+        {"DK", "aa 99 999"}, {"E", "9999 aaa"}, {"F", "aa-999-aa"}, {"FIN", "aaa-999"},
+        {"I", "aa 999aa"}, {"L", "aa 9999"}, {"NL", "99-aaa-9"}, {"PL", "aa 99999"},
+        {"S", "aaa 99a"}, {"UK", "aa99 aaa"}, {"LT", "aaa 999"}, {"IRL", "99-a-99999"},
+        {"d", "ab-cd-12345678"}, {"F", "a"}, {"D", ""}, {"D", "::--"},
+    };
+    sFONT *const fonts[] = { &PackedEuroFont9664, &PackedEuroFont7248, &PackedEuroFont4832 };
+
+    std::vector<std::pair<std::string, std::string>> plates;
+    srand(1);
+    for (int i = 0; i < 12; i++) {
+        for (auto &entry : patterns) {
+            plates.push_back({entry.sign, generate(entry.pattern)});
+        }
+    }
+
+    Paint paint(image, kWidth, kHeight);
+    LicensePlate plate(kPlateWidth);
+    for (auto &entry : plates) {
+        plate.setLicense(entry.first.c_str(), entry.second.c_str());
+        const LicensePlate::Format *format = plate.getFormat();
+        int textWidth = kPlateWidth - (format->band ? GetCharAdvance(fonts[0], '!') : 0);
+
+        // The largest font the text fits with
+        int size = 0;
+        while (fonts[size] != plate.getFont()) {
+            size++;
+        }
+        CHECK(0 == size || TextLayout::measure(fonts[size - 1], plate.getText()) > textWidth,
+              "%s %s: laid out smaller than needed", entry.first.c_str(), entry.second.c_str());
+        CHECK(TextLayout::measure(plate.getFont(), plate.getText()) <= textWidth,
+              "%s %s: \"%s\" is wider than the plate", entry.first.c_str(), entry.second.c_str(),
+              plate.getText());
+
+        paint.Clear(0);
+        plate.draw(paint, kPlateX, kPlateY, 1);
+        CHECK(0 == pixelsOutside(kPlateX, kPlateY, kPlateX + kPlateWidth - 1, kPlateY + LicensePlate::kHeight - 1),
+              "%s %s: drawn outside of the plate", entry.first.c_str(), entry.second.c_str());
+    }
+
+    const int repeat = 50;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; i++) {
+        for (auto &entry : plates) {
+            plate.setLicense(entry.first.c_str(), entry.second.c_str());
+        }
+    }
+    auto laidOut = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; i++) {
+        for (auto &entry : plates) {
+            plate.setLicense(entry.first.c_str(), entry.second.c_str());
+            plate.draw(paint, kPlateX, kPlateY, 1);
+        }
+    }
+    auto drawn = std::chrono::steady_clock::now();
+    double count = repeat * plates.size();
+    printf("license plate: %d plates fit, layout %.2f us, layout and drawing %.2f us per plate\n",
+           (int)plates.size(),
+           std::chrono::duration<double, std::micro>(laidOut - start).count() / count,
+           std::chrono::duration<double, std::micro>(drawn - laidOut).count() / count);
+}
+
+
+int main()
+{
+    testFormats();
+    testPlatesFit();
+
+    if (failures) {
+        printf("license plate: %d failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
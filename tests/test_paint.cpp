@@ -0,0 +1,629 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/**
+ * Host tests of the painter, see tests/Makefile
+ */
+
+#include "epdpaint.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+
+/* Packed fonts of app/, generated with tools/pack_font.py */
+extern sFONT PackedFont24;
+extern sFONT PackedFont4040;
+extern sFONT PackedEuroFont9664;
+
+
+static const int kWidth = 400;
+static const int kHeight = 300;
+
+static unsigned char image[kWidth / 8 * kHeight];
+static unsigned char expected[kWidth / 8 * kHeight];
+
+static int failures = 0;
+
+#define CHECK(condition, ...) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+
+/**
+ * The characters as DrawCharAt drew them before the glyph blitter,
+ * every set bit of the font table is a DrawPixel call
+ */
+static void drawCharPerPixel(Paint &paint, int x, int y, char ascii_char, sFONT *font, int colored)
+{
+    int line_bytes = (font->Width + 7) / 8;
+    const unsigned char *ptr = &font->table[(ascii_char - ' ') * font->Height * line_bytes];
+
+    for (int j = 0; j < font->Height; j++, ptr += line_bytes) {
+        for (int i = 0; i < font->Width; i++) {
+            if (ptr[i / 8] & (0x80 >> (i % 8))) {
+                paint.DrawPixel(x + i, y + j, colored);
+            }
+        }
+    }
+}
+
+/**
+ * Every glyph of every font of EPD_4R2/Fonts, drawn by the blitter and
+ * per pixel into the same background, in all rotations, both colors,
+ * clipped at the edges and in bands of the frame
+ */
+static void testCharactersMatchPerPixel()
+{
+    /* The fonts by JH1PJL end with '|', EuroFont9664 with 'Z' */
+    struct {
+        const char *name;
+        sFONT *font;
+        char last;
+    } fonts[] = {
+        {"Font8", &Font8, '~'}, {"Font12", &Font12, '~'}, {"Font16", &Font16, '~'},
+        {"Font20", &Font20, '~'}, {"Font24", &Font24, '~'}, {"Font9696", &Font9696, '|'},
+        {"Font8088", &Font8088, '|'}, {"Font8080", &Font8080, '|'}, {"Font4848", &Font4848, '|'},
+        {"Font4040", &Font4040, '|'}, {"Font3840", &Font3840, '|'}, {"Font3335", &Font3335, '|'},
+        {"Font2829", &Font2829, '|'}, {"Font2424", &Font2424, '|'}, {"Font2121", &Font2121, '|'},
+        {"Font1616", &Font1616, '|'}, {"Font1314", &Font1314, '|'},
+        {"EuroFont9664", &EuroFont9664, 'Z'},
+    };
+
+    Paint paint(image, kWidth, kHeight);
+    Paint reference(expected, kWidth, kHeight);
+    srand(2);
+
+    int characters = 0;
+    for (auto &entry : fonts) {
+        for (int ch = ' '; ch <= entry.last; ch++) {
+            for (int k = 0; k < 24; k++) {
+                int rotate = k < 16 ? ROTATE_0 : rand() % 4;
+                int x = rand() % (kWidth + 2 * entry.font->Width) - entry.font->Width;
+                int y = rand() % (kHeight + 2 * entry.font->Height) - entry.font->Height;
+                int colored = rand() % 2;
+                int band_y = k % 3 ? 0 : rand() % kHeight;
+                int band_height = k % 3 ? kHeight : 1 + rand() % (kHeight - band_y);
+
+                for (size_t i = 0; i < sizeof(image); i++) {
+                    image[i] = expected[i] = rand();
+                }
+                paint.SetRotate(rotate);
+                reference.SetRotate(rotate);
+                paint.SetBand(band_y, band_height);
+                reference.SetBand(band_y, band_height);
+
+                paint.DrawCharAt(x, y, ch, entry.font, colored);
+                drawCharPerPixel(reference, x, y, ch, entry.font, colored);
+
+                CHECK(0 == memcmp(image, expected, sizeof(image)),
+                      "%s '%c' at %d,%d rotate %d colored %d band %d+%d differs",
+                      entry.name, ch, x, y, rotate, colored, band_y, band_height);
+                characters++;
+            }
+        }
+    }
+    printf("paint: %d characters of %d fonts match the per-pixel rendering\n",
+           characters, (int)(sizeof(fonts) / sizeof(fonts[0])));
+}
+
+
+/**
+ * The filled rectangle as DrawFilledRectangle drew it before the span fill,
+ * a column of DrawPixel calls per x
+ */
+template <int Rotation, int Polarity>
+static void fillPerPixel(BasicPaint<Rotation, Polarity> &paint, int x0, int y0, int x1, int y1, int colored)
+{
+    for (int x = x0 < x1 ? x0 : x1; x <= (x0 < x1 ? x1 : x0); x++) {
+        for (int y = y0 < y1 ? y0 : y1; y <= (y0 < y1 ? y1 : y0); y++) {
+            paint.DrawPixel(x, y, colored);
+        }
+    }
+}
+
+template <int Rotation, int Polarity>
+static int fillCases(int count)
+{
+    BasicPaint<Rotation, Polarity> paint(image, kWidth, kHeight);
+    BasicPaint<Rotation, Polarity> reference(expected, kWidth, kHeight);
+    static const char *kShapes[] = {"filled rectangle", "horizontal line", "vertical line", "rectangle",
+                                    "absolute rectangle", "clear"};
+    int differences = 0;
+
+    for (int k = 0; k < count; k++) {
+        int shape = k % 6 == 5 && rand() % 8 ? rand() % 5 : k % 6;
+        int x0 = rand() % (kWidth + 80) - 40;
+        int y0 = rand() % (kWidth + 80) - 40;
+        int x1 = k % 4 ? x0 + rand() % 60 - 20 : rand() % (kWidth + 80) - 40;
+        int y1 = k % 4 ? y0 + rand() % 60 - 20 : rand() % (kWidth + 80) - 40;
+        int colored = rand() % 2;
+        int band_y = k % 3 ? 0 : rand() % kHeight;
+        int band_height = k % 3 ? kHeight : 1 + rand() % (kHeight - band_y);
+
+        for (size_t i = 0; i < sizeof(image); i++) {
+            image[i] = expected[i] = rand();
+        }
+        paint.SetBand(band_y, band_height);
+        reference.SetBand(band_y, band_height);
+
+        if (shape == 0) {
+            paint.DrawFilledRectangle(x0, y0, x1, y1, colored);
+            fillPerPixel(reference, x0, y0, x1, y1, colored);
+        } else if (shape == 1) {
+            paint.DrawHorizontalLine(x0, y0, x1 - x0, colored);
+            for (int x = x0; x < x1; x++) {
+                reference.DrawPixel(x, y0, colored);
+            }
+        } else if (shape == 2) {
+            paint.DrawVerticalLine(x0, y0, y1 - y0, colored);
+            for (int y = y0; y < y1; y++) {
+                reference.DrawPixel(x0, y, colored);
+            }
+        } else if (shape == 3) {
+            paint.DrawRectangle(x0, y0, x1, y1, colored);
+            fillPerPixel(reference, x0, y0, x1, y0, colored);
+            fillPerPixel(reference, x0, y1, x1, y1, colored);
+            fillPerPixel(reference, x0, y0, x0, y1, colored);
+            fillPerPixel(reference, x1, y0, x1, y1, colored);
+        } else if (shape == 4) {
+            paint.DrawAbsoluteFilledRectangle(x0, y0, x1, y1, colored);
+            for (int y = y0; y <= y1; y++) {
+                for (int x = x0; x <= x1; x++) {
+                    reference.DrawAbsolutePixel(x, y, colored);
+                }
+            }
+        } else {
+            paint.Clear(colored);
+            for (int y = 0; y < kHeight; y++) {
+                for (int x = 0; x < kWidth; x++) {
+                    reference.DrawAbsolutePixel(x, y, colored);
+                }
+            }
+        }
+
+        if (memcmp(image, expected, sizeof(image))) {
+            if (differences++ < 3) {
+                printf("FAIL %s %d,%d %d,%d colored %d band %d+%d rotate %d polarity %d differs\n",
+                       kShapes[shape], x0, y0, x1, y1, colored, band_y, band_height, Rotation, Polarity);
+            }
+        }
+    }
+    return differences;
+}
+
+/**
+ * Rectangles, lines and clears filled by spans match drawing every pixel
+ * on its own, in all rotations and both polarities
+ */
+static void testFillsMatchPerPixel()
+{
+    srand(1);
+    int differences = fillCases<ROTATE_0, 1>(3000) + fillCases<ROTATE_0, 0>(2000)
+                      + fillCases<ROTATE_90, 1>(2000) + fillCases<ROTATE_90, 0>(1000)
+                      + fillCases<ROTATE_180, 1>(2000) + fillCases<ROTATE_180, 0>(1000)
+                      + fillCases<ROTATE_270, 1>(2000) + fillCases<ROTATE_270, 0>(1000);
+    CHECK(0 == differences, "%d fills differ from the per-pixel rendering", differences);
+    printf("paint: 14000 fills match the per-pixel rendering\n");
+}
+
+
+/**
+ * The qrcode as the widget drew it before DrawScaledBitmap, a filled rectangle
+ * per module. overlap 1 is the old widget, which drew every module one pixel
+ * larger, overlap 0 the exact squares of scale pixels that DrawScaledBitmap draws
+ */
+template <typename Painter>
+static void drawModulesByRectangles(Painter &paint, int x, int y, const unsigned char *bitmap, int width,
+                                    int height, int line_bits, int scale, int colored, int overlap)
+{
+    for (int j = 0; j < height; j++) {
+        for (int i = 0; i < width; i++) {
+            int bit = j * line_bits + i;
+            int set = bitmap[bit / 8] & (0x80 >> (bit % 8));
+            paint.DrawFilledRectangle(x + i * scale, y + j * scale,
+                                      x + i * scale + scale - 1 + overlap, y + j * scale + scale - 1 + overlap,
+                                      set ? colored : !colored);
+        }
+    }
+}
+
+template <int Rotation, int Polarity>
+static int scaledBitmapCases(int count)
+{
+    BasicPaint<Rotation, Polarity> paint(image, kWidth, kHeight);
+    BasicPaint<Rotation, Polarity> reference(expected, kWidth, kHeight);
+    unsigned char bitmap[8 * 40];
+    int differences = 0;
+
+    for (int k = 0; k < count; k++) {
+        int width = 1 + rand() % 40;
+        int height = 1 + rand() % 40;
+        int line_bits = width + (k % 2 ? 0 : rand() % 24);
+        int scale = 1 + rand() % 6;
+        int x = rand() % (kWidth + 60) - width * scale / 2 - 30;
+        int y = rand() % (kWidth + 60) - height * scale / 2 - 30;
+        int colored = rand() % 2;
+        int band_y = k % 3 ? 0 : rand() % kHeight;
+        int band_height = k % 3 ? kHeight : 1 + rand() % (kHeight - band_y);
+
+        /* Right and bottom borders, so the last module is cut */
+        if (k % 5 == 0) {
+            x = (Rotation == ROTATE_90 || Rotation == ROTATE_270 ? kHeight : kWidth) - rand() % (width * scale);
+        } else if (k % 5 == 1) {
+            y = (Rotation == ROTATE_90 || Rotation == ROTATE_270 ? kWidth : kHeight) - rand() % (height * scale);
+        }
+        for (size_t i = 0; i < sizeof(bitmap); i++) {
+            bitmap[i] = rand();
+        }
+        for (size_t i = 0; i < sizeof(image); i++) {
+            image[i] = expected[i] = rand();
+        }
+        paint.SetBand(band_y, band_height);
+        reference.SetBand(band_y, band_height);
+
+        paint.DrawScaledBitmap(x, y, bitmap, width, height, line_bits, scale, colored);
+        drawModulesByRectangles(reference, x, y, bitmap, width, height, line_bits, scale, colored, 0);
+
+        if (memcmp(image, expected, sizeof(image))) {
+            if (differences++ < 3) {
+                printf("FAIL bitmap %dx%d line %d scale %d at %d,%d colored %d band %d+%d "
+                       "rotate %d polarity %d differs\n", width, height, line_bits, scale, x, y, colored,
+                       band_y, band_height, Rotation, Polarity);
+            }
+        }
+    }
+    return differences;
+}
+
+/**
+ * Scaled bitmaps match a filled rectangle per bit in all rotations and both
+ * polarities, clipped at every edge, at any x and in bands of the frame
+ */
+static void testScaledBitmapsMatchRectangles()
+{
+    srand(14);
+    int differences = scaledBitmapCases<ROTATE_0, 1>(8000) + scaledBitmapCases<ROTATE_0, 0>(4000)
+                      + scaledBitmapCases<ROTATE_90, 1>(1000) + scaledBitmapCases<ROTATE_90, 0>(500)
+                      + scaledBitmapCases<ROTATE_180, 1>(1000) + scaledBitmapCases<ROTATE_180, 0>(500)
+                      + scaledBitmapCases<ROTATE_270, 1>(1000) + scaledBitmapCases<ROTATE_270, 0>(500);
+    CHECK(0 == differences, "%d scaled bitmaps differ from the rectangles", differences);
+    printf("paint: 16500 scaled bitmaps match the rectangles per bit\n");
+}
+
+
+/**
+ * First column of a character of a full font with a set pixel, -1 for a blank
+ */
+static int firstColumn(const sFONT *font, char ascii_char)
+{
+    int line_bytes = (font->Width + 7) / 8;
+    const unsigned char *ptr = &font->table[(ascii_char - ' ') * font->Height * line_bytes];
+    int first = -1;
+
+    for (int j = 0; j < font->Height; j++, ptr += line_bytes) {
+        for (int i = 0; i < font->Width; i++) {
+            if ((ptr[i / 8] & (0x80 >> (i % 8))) && (first < 0 || i < first)) {
+                first = i;
+            }
+        }
+    }
+    return first;
+}
+
+/**
+ * The characters of the packed fonts at full size draw the same pixels
+ * as the fonts they were packed from, in all rotations. The packed glyphs
+ * are proportional, they start their bearing after the pen position
+ */
+static void testPackedCharactersMatchSource()
+{
+    struct {
+        const char *name;
+        sFONT *packed;
+        sFONT *source;
+    } fonts[] = {
+        {"PackedFont24", &PackedFont24, &Font24},
+        {"PackedFont4040", &PackedFont4040, &Font4040},
+        {"PackedEuroFont9664", &PackedEuroFont9664, &EuroFont9664},
+    };
+
+    Paint paint(image, kWidth, kHeight);
+    Paint reference(expected, kWidth, kHeight);
+    srand(4);
+
+    int characters = 0;
+    for (auto &entry : fonts) {
+        for (int i = 0; i < entry.packed->count; i++) {
+            char ch = entry.packed->codes[i];
+            for (int k = 0; k < 8; k++) {
+                int rotate = k < 4 ? ROTATE_0 : k % 4;
+                int x = rand() % (kWidth + 2 * entry.source->Width) - entry.source->Width;
+                int y = rand() % (kHeight + 2 * entry.source->Height) - entry.source->Height;
+                int colored = rand() % 2;
+
+                memset(image, k % 2 ? 0xFF : 0x00, sizeof(image));
+                memset(expected, k % 2 ? 0xFF : 0x00, sizeof(expected));
+                paint.SetRotate(rotate);
+                reference.SetRotate(rotate);
+                int first = firstColumn(entry.source, ch);
+                int shift = first < 0 ? 0 : first - FindGlyph(entry.packed, ch)->X;
+                paint.DrawCharAt(x + shift, y, ch, entry.packed, colored);
+                reference.DrawCharAt(x, y, ch, entry.source, colored);
+
+                CHECK(0 == memcmp(image, expected, sizeof(image)),
+                      "%s '%c' at %d,%d rotate %d differs from its source font", entry.name, ch, x, y, rotate);
+                characters++;
+            }
+        }
+        CHECK(NULL == FindGlyph(entry.packed, '~'), "%s has a glyph of '~'", entry.name);
+    }
+    printf("paint: %d characters of %d packed fonts match their source fonts\n",
+           characters, (int)(sizeof(fonts) / sizeof(fonts[0])));
+}
+
+/**
+ * The absolute position of a pixel like BasicPaint::MapPixel,
+ * false if it is outside of the frame
+ */
+static bool mapPixel(int rotate, int *x, int *y)
+{
+    int width = rotate == ROTATE_90 || rotate == ROTATE_270 ? kHeight : kWidth;
+    int height = rotate == ROTATE_90 || rotate == ROTATE_270 ? kWidth : kHeight;
+    if (*x < 0 || *x >= width || *y < 0 || *y >= height) {
+        return false;
+    }
+    int temp = *x;
+    if (rotate == ROTATE_90) {
+        *x = kWidth - *y;
+        *y = temp;
+    } else if (rotate == ROTATE_180) {
+        *x = kWidth - *x;
+        *y = kHeight - *y;
+    } else if (rotate == ROTATE_270) {
+        *x = *y;
+        *y = kHeight - temp;
+    }
+    return *x < kWidth && *y < kHeight;
+}
+
+/**
+ * Every pixel of the region of an image drawn on its own, by the meaning of
+ * the raster operations for colored pixels, see epdpaint.h
+ */
+static void drawImagePerPixel(unsigned char *buffer, int rotate, int polarity, int band_y, int band_height,
+                              const unsigned char *image, int image_width, int src_x, int src_y,
+                              int x, int y, int width, int height, int op)
+{
+    int line_bytes = (image_width + 7) / 8;
+    for (int j = 0; j < height; j++) {
+        for (int i = 0; i < width; i++) {
+            int px = x + i;
+            int py = y + j;
+            if (!mapPixel(rotate, &px, &py) || py < band_y || py >= band_y + band_height) {
+                continue;
+            }
+            unsigned char *byte = &buffer[(py - band_y) * kWidth / 8 + px / 8];
+            unsigned char bit = 0x80 >> (px % 8);
+            int colored = ((*byte & bit) != 0) == (polarity != 0);
+            int set = (image[(src_y + j) * line_bytes + (src_x + i) / 8] >> (7 - (src_x + i) % 8)) & 1;
+
+            if (op == IMAGE_COPY) {
+                colored = set;
+            } else if (op == IMAGE_OR) {
+                colored |= set;
+            } else if (op == IMAGE_AND) {
+                colored &= set;
+            } else {
+                colored ^= set;
+            }
+            if ((colored != 0) == (polarity != 0)) {
+                *byte |= bit;
+            } else {
+                *byte &= ~bit;
+            }
+        }
+    }
+}
+
+template <int Rotation, int Polarity>
+static int drawImageCases(int count)
+{
+    BasicPaint<Rotation, Polarity> paint(image, kWidth, kHeight);
+    unsigned char source[8 * 30];
+    int differences = 0;
+
+    for (int k = 0; k < count; k++) {
+        int image_width = 1 + rand() % 60;
+        int image_height = 1 + rand() % 30;
+        for (size_t i = 0; i < sizeof(source); i++) {
+            source[i] = rand();
+        }
+        int src_x = rand() % image_width;
+        int src_y = rand() % image_height;
+        int width = 1 + rand() % (image_width - src_x);
+        int height = 1 + rand() % (image_height - src_y);
+        int x = rand() % (kWidth + 80) - 40;
+        int y = rand() % (kHeight + 60) - 30;
+        int op = rand() % 4;
+        int band_y = k % 2 ? 0 : rand() % kHeight;
+        int band_height = k % 2 ? kHeight : 1 + rand() % (kHeight - band_y);
+
+        for (size_t i = 0; i < sizeof(image); i++) {
+            image[i] = expected[i] = rand();
+        }
+        paint.SetBand(band_y, band_height);
+        paint.DrawSubImage(source, image_width, src_x, src_y, x, y, width, height, op);
+        drawImagePerPixel(expected, Rotation, Polarity, band_y, band_height,
+                          source, image_width, src_x, src_y, x, y, width, height, op);
+
+        if (memcmp(image, expected, sizeof(image))) {
+            if (differences++ < 3) {
+                printf("FAIL image %dx%d of %dx%d at %d,%d op %d rotate %d polarity %d differs\n",
+                       width, height, image_width, image_height, x, y, op, Rotation, Polarity);
+            }
+        }
+    }
+    return differences;
+}
+
+/**
+ * Sub-images drawn with all raster operations, rotations and both
+ * polarities match drawing every pixel on its own
+ */
+static void testImagesMatchPerPixel()
+{
+    srand(3);
+    int differences = drawImageCases<ROTATE_0, 1>(8000) + drawImageCases<ROTATE_0, 0>(8000)
+                      + drawImageCases<ROTATE_90, 1>(2000) + drawImageCases<ROTATE_180, 0>(2000)
+                      + drawImageCases<ROTATE_270, 1>(2000);
+    CHECK(0 == differences, "%d images differ from the per-pixel rendering", differences);
+    printf("paint: 22000 images match the per-pixel rendering\n");
+}
+
+/**
+ * The image loop DrawImage had before the blit, a DrawPixel call per pixel,
+ * with line and row the right way round
+ */
+static void drawImageByDrawPixel(Paint &paint, const unsigned char *source, int x, int y, int width, int height)
+{
+    for (int line = 0; line < height; line++) {
+        for (int row = 0; row < width; row++) {
+            int bit = width * line + row;
+            paint.DrawPixel(x + row, y + line, (source[bit / 8] & (0x80 >> (bit % 8))) != 0);
+        }
+    }
+}
+
+template <typename Function>
+static double microseconds(Function function, int count)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) {
+        function();
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+/**
+ * Fill rate of the spans against the per-pixel path in every rotation, reported only
+ */
+template <int Rotation>
+static void benchmarkFill(const char *name)
+{
+    BasicPaint<Rotation, IF_INVERT_COLOR> paint(image, kWidth, kHeight);
+    int width = Rotation == ROTATE_90 || Rotation == ROTATE_270 ? kHeight : kWidth;
+    int height = Rotation == ROTATE_90 || Rotation == ROTATE_270 ? kWidth : kHeight;
+
+    double frame_pixels = (double)kWidth * kHeight;
+    double frame_pixel = microseconds([&] { fillPerPixel(paint, 0, 0, width - 1, height - 1, 1); }, 100);
+    double frame_span = microseconds([&] { paint.DrawFilledRectangle(0, 0, width - 1, height - 1, 1); }, 20000);
+    double box_pixels = 37.0 * 23;
+    double box_pixel = microseconds([&] { fillPerPixel(paint, 43, 21, 79, 43, 1); }, 20000);
+    double box_span = microseconds([&] { paint.DrawFilledRectangle(43, 21, 79, 43, 1); }, 200000);
+
+    printf("paint: fill %-10s 400x300 %6.2f Gpixel/s per pixel, %7.2f spans, "
+           "37x23 %6.2f per pixel, %6.2f spans\n", name, frame_pixels / frame_pixel / 1000,
+           frame_pixels / frame_span / 1000, box_pixels / box_pixel / 1000, box_pixels / box_span / 1000);
+}
+
+static void benchmarkFills()
+{
+    benchmarkFill<ROTATE_0>("ROTATE_0");
+    benchmarkFill<ROTATE_90>("ROTATE_90");
+    benchmarkFill<ROTATE_180>("ROTATE_180");
+    benchmarkFill<ROTATE_270>("ROTATE_270");
+}
+
+/**
+ * Time of a version 4 qrcode at scale 5 like the welcome screen draws it, as one
+ * rectangle per module before and as scaled bitmap now, reported only
+ */
+static void benchmarkScaledBitmap()
+{
+    unsigned char modules[(33 * 33 + 7) / 8];
+    for (size_t i = 0; i < sizeof(modules); i++) {
+        modules[i] = i * 37;
+    }
+    Paint paint(image, kWidth, kHeight);
+
+    printf("paint: qrcode 33x33 scale 5   %8.2f us rectangles, %8.2f us scaled bitmap\n",
+           microseconds([&] { drawModulesByRectangles(paint, 30, 100, modules, 33, 33, 33, 5, 0, 1); }, 5000),
+           microseconds([&] { paint.DrawScaledBitmap(30, 100, modules, 33, 33, 33, 5, 0); }, 5000));
+
+    /* Every band draws the whole qrcode, clipped to its rows */
+    auto banded = [&](bool rectangles) {
+        for (int y = 0; y < kHeight; y += 16) {
+            paint.SetBand(y, 16);
+            if (rectangles) {
+                drawModulesByRectangles(paint, 30, 100, modules, 33, 33, 33, 5, 0, 1);
+            } else {
+                paint.DrawScaledBitmap(30, 100, modules, 33, 33, 33, 5, 0);
+            }
+        }
+        paint.SetBand(0, kHeight);
+    };
+    printf("paint: qrcode in 16 row bands %8.2f us rectangles, %8.2f us scaled bitmap\n",
+           microseconds([&] { banded(true); }, 2000), microseconds([&] { banded(false); }, 2000));
+}
+
+/**
+ * Time of the blit against the per-pixel path, reported only
+ */
+static void benchmarkImages()
+{
+    static unsigned char source[kWidth / 8 * kHeight];
+    for (size_t i = 0; i < sizeof(source); i++) {
+        source[i] = i * 37;
+    }
+    Paint paint(image, kWidth, kHeight);
+
+    printf("paint: icon 32x32 aligned   %8.2f us per pixel, %8.2f us blit\n",
+           microseconds([&] { drawImageByDrawPixel(paint, source, 40, 40, 32, 32); }, 5000),
+           microseconds([&] { paint.DrawImage(source, 40, 40, 32, 32); }, 5000));
+    printf("paint: icon 32x32 unaligned %8.2f us per pixel, %8.2f us blit\n",
+           microseconds([&] { drawImageByDrawPixel(paint, source, 43, 40, 32, 32); }, 5000),
+           microseconds([&] { paint.DrawImage(source, 43, 40, 32, 32); }, 5000));
+    printf("paint: frame 400x300        %8.2f us per pixel, %8.2f us blit\n",
+           microseconds([&] { drawImageByDrawPixel(paint, source, 0, 0, kWidth, kHeight); }, 100),
+           microseconds([&] { paint.DrawImage(source, 0, 0, kWidth, kHeight); }, 100));
+}
+
+
+int main()
+{
+    testFillsMatchPerPixel();
+    testCharactersMatchPerPixel();
+    testPackedCharactersMatchSource();
+    testImagesMatchPerPixel();
+    testScaledBitmapsMatchRectangles();
+    benchmarkFills();
+    benchmarkImages();
+    benchmarkScaledBitmap();
+
+    if (failures) {
+        printf("paint: %d failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,615 @@
+/*
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/**
+ * Host tests of the QR code library, see tests/Makefile. The library is
+ * included to reach its static functions
+ */
+
+#include "qrcode.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+static int failures = 0;
+
+#define CHECK(condition, ...) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            failures++; \
+        } \
+    } while (0)
+
+
+#pragma mark - Mask penalty
+
+// The penalty score as the library computed it module by module before it
+// worked on 32 modules at once
+static uint32_t getPenaltyScorePerModule(BitBucket *modules) {
+    uint32_t result = 0;
+    
+    uint8_t size = modules->bitOffsetOrWidth;
+    
+    // Adjacent modules in row having same color
+    for (uint8_t y = 0; y < size; y++) {
+        bool colorX = bb_getBit(modules, 0, y);
+        for (uint8_t x = 1, runX = 1; x < size; x++) {
+            bool cx = bb_getBit(modules, x, y);
+            if (cx != colorX) {
+                colorX = cx;
+                runX = 1;
+            } else {
+                runX++;
+                if (runX == 5) {
+                    result += PENALTY_N1;
+                } else if (runX > 5) {
+                    result++;
+                }
+            }
+        }
+    }
+    
+    // Adjacent modules in column having same color
+    for (uint8_t x = 0; x < size; x++) {
+        bool colorY = bb_getBit(modules, x, 0);
+        for (uint8_t y = 1, runY = 1; y < size; y++) {
+            bool cy = bb_getBit(modules, x, y);
+            if (cy != colorY) {
+                colorY = cy;
+                runY = 1;
+            } else {
+                runY++;
+                if (runY == 5) {
+                    result += PENALTY_N1;
+                } else if (runY > 5) {
+                    result++;
+                }
+            }
+        }
+    }
+    
+    uint16_t black = 0;
+    for (uint8_t y = 0; y < size; y++) {
+        uint16_t bitsRow = 0, bitsCol = 0;
+        for (uint8_t x = 0; x < size; x++) {
+            bool color = bb_getBit(modules, x, y);
+            
+            // 2*2 blocks of modules having same color
+            if (x > 0 && y > 0) {
+                bool colorUL = bb_getBit(modules, x - 1, y - 1);
+                bool colorUR = bb_getBit(modules, x, y - 1);
+                bool colorL = bb_getBit(modules, x - 1, y);
+                if (color == colorUL && color == colorUR && color == colorL) {
+                    result += PENALTY_N2;
+                }
+            }
+            
+            // Finder-like pattern in rows and columns
+            bitsRow = ((bitsRow << 1) & 0x7FF) | color;
+            bitsCol = ((bitsCol << 1) & 0x7FF) | bb_getBit(modules, y, x);
+            
+            // Needs 11 bits accumulated
+            if (x >= 10) {
+                if (bitsRow == 0x05D || bitsRow == 0x5D0) {
+                    result += PENALTY_N3;
+                }
+                if (bitsCol == 0x05D || bitsCol == 0x5D0) {
+                    result += PENALTY_N3;
+                }
+            }
+            
+            // Balance of black and white modules
+            if (color) { black++; }
+        }
+    }
+    
+    // Find smallest k such that (45-5k)% <= dark/total <= (55+5k)%
+    uint16_t total = size * size;
+    for (uint16_t k = 0; black * 20 < (9 - k) * total || black * 20 > (11 + k) * total; k++) {
+        result += PENALTY_N4;
+    }
+    
+    return result;
+}
+
+// Random grids of all sizes score the same as module by module
+static void testPenaltyOfRandomGrids() {
+    static uint8_t data[QRCODE_BUFFER_SIZE(40)];
+    srand(21);
+    
+    int grids = 0;
+    for (uint8_t version = 1; version <= 40; version++) {
+        uint8_t size = version * 4 + 17;
+        for (int i = 0; i < 250; i++, grids++) {
+            // Sparse, dense and even grids, so all penalty rules get to count
+            int density = rand() % 5;
+            for (uint16_t j = 0; j < sizeof(data); j++) {
+                uint8_t a = rand(), b = rand();
+                data[j] = density == 0 ? a & b : density == 1 ? a | b : density == 2 ? a : (j & 1 ? 0xFF : a);
+            }
+            BitBucket grid;
+            grid.bitOffsetOrWidth = size;
+            grid.capacityBytes = bb_getGridSizeBytes(size);
+            grid.data = data;
+            
+            uint32_t score = getPenaltyScore(&grid);
+            uint32_t expected = getPenaltyScorePerModule(&grid);
+            CHECK(score == expected, "version %d grid %d: penalty %u, expected %u", version, i, score, expected);
+        }
+    }
+    printf("qrcode: %d random grids score the same penalty\n", grids);
+}
+
+// The mask qrcode_initBytes chose is the one of the lowest penalty module by module
+static void testMaskChoiceOfRandomPayloads() {
+    static uint8_t modules[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t functionModules[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t isFunction[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t payload[400];
+    srand(22);
+    
+    int codes = 0;
+    for (int i = 0; i < 4000; i++) {
+        uint8_t version = i < 3000 ? 1 + rand() % 10 : 1 + rand() % 40;
+        uint8_t ecc = rand() % 4;
+        uint16_t capacity = getDataCapacity(version, ecc) - 3;
+        if (capacity > sizeof(payload)) { capacity = sizeof(payload); }
+        uint16_t length = rand() % capacity;
+        for (uint16_t j = 0; j < length; j++) {
+            payload[j] = i % 3 == 0 ? '0' + rand() % 10 : rand();
+        }
+        
+        QRCode qrcode;
+        if (0 != qrcode_initBytes(&qrcode, modules, version, ecc, payload, length)) {
+            continue;
+        }
+        codes++;
+        
+        uint8_t size = qrcode.size;
+        uint8_t eccFormatBits = (ECC_FORMAT_BITS >> (2 * ecc)) & 0x03;
+        BitBucket modulesGrid, functionGrid, isFunctionGrid;
+        bb_initGrid(&functionGrid, functionModules, size);
+        bb_initGrid(&isFunctionGrid, isFunction, size);
+        drawFunctionPatterns(&functionGrid, &isFunctionGrid, version, eccFormatBits);
+        
+        modulesGrid.bitOffsetOrWidth = size;
+        modulesGrid.capacityBytes = bb_getGridSizeBytes(size);
+        modulesGrid.data = modules;
+        applyMask(&modulesGrid, &isFunctionGrid, qrcode.mask);
+        
+        uint8_t mask = 0;
+        uint32_t minPenalty = UINT32_MAX;
+        for (uint8_t m = 0; m < 8; m++) {
+            drawFormatBits(&modulesGrid, &isFunctionGrid, eccFormatBits, m);
+            applyMask(&modulesGrid, &isFunctionGrid, m);
+            uint32_t penalty = getPenaltyScorePerModule(&modulesGrid);
+            if (penalty < minPenalty) {
+                mask = m;
+                minPenalty = penalty;
+            }
+            applyMask(&modulesGrid, &isFunctionGrid, m);
+        }
+        CHECK(mask == qrcode.mask, "version %d ecc %d length %d: mask %d, expected %d",
+              version, ecc, length, qrcode.mask, mask);
+    }
+    printf("qrcode: %d codes chose the mask of the lowest penalty\n", codes);
+}
+
+
+#pragma mark - Reed-Solomon
+
+// Multiplies in GF(2^8/0x11D) bit by bit, like the library without RS_LOOKUP_TABLES
+static uint8_t gfMultiply(uint8_t x, uint8_t y) {
+    uint8_t z = 0;
+    while (y) {
+        if (y & 1) { z ^= x; }
+        x = (x << 1) ^ ((x >> 7) * 0x1D);
+        y >>= 1;
+    }
+    return z;
+}
+
+// The error correction codewords of a block, the remainder of the data times x^degree divided
+// by the generator (x - 2^0) * ... * (x - 2^(degree-1))
+static void getBlockEcc(const uint8_t *data, uint8_t length, uint8_t degree, uint8_t *ecc) {
+    uint8_t generator[256] = { 1 };     // descending powers, generator[0] is x^degree
+    uint8_t root = 1;
+    for (uint8_t i = 0; i < degree; i++) {
+        for (uint8_t j = i + 1; j > 0; j--) {
+            generator[j] ^= gfMultiply(generator[j - 1], root);
+        }
+        root = gfMultiply(root, 2);
+    }
+    
+    uint8_t remainder[256 + 256] = { 0 };
+    memcpy(remainder, data, length);
+    for (uint8_t i = 0; i < length; i++) {
+        uint8_t factor = remainder[i];
+        for (uint8_t j = 1; j <= degree; j++) {
+            remainder[i + j] ^= gfMultiply(generator[j], factor);
+        }
+    }
+    memcpy(ecc, &remainder[length], degree);
+}
+
+// The codewords of the blocks interleaved as in ISO/IEC 18004 8.6, the short blocks come first
+static void interleaveBlocks(uint8_t version, uint8_t ecc, const uint8_t *data, uint8_t *result) {
+    uint8_t numBlocks = NUM_ERROR_CORRECTION_BLOCKS[ecc][version - 1];
+    uint16_t totalCodewords = NUM_RAW_DATA_MODULES[version - 1] / 8;
+    uint8_t blockEccLen = NUM_ERROR_CORRECTION_CODEWORDS[ecc][version - 1] / numBlocks;
+    uint8_t numShortBlocks = numBlocks - totalCodewords % numBlocks;
+    uint8_t shortDataLen = totalCodewords / numBlocks - blockEccLen;
+    
+    uint8_t blockEcc[81][30];
+    uint16_t blockStart[81];
+    uint16_t start = 0;
+    for (uint8_t b = 0; b < numBlocks; b++) {
+        uint8_t length = shortDataLen + (b >= numShortBlocks);
+        blockStart[b] = start;
+        getBlockEcc(&data[start], length, blockEccLen, blockEcc[b]);
+        start += length;
+    }
+    
+    uint16_t offset = 0;
+    for (uint8_t i = 0; i <= shortDataLen; i++) {
+        for (uint8_t b = 0; b < numBlocks; b++) {
+            if (i < shortDataLen + (b >= numShortBlocks)) { result[offset++] = data[blockStart[b] + i]; }
+        }
+    }
+    for (uint8_t i = 0; i < blockEccLen; i++) {
+        for (uint8_t b = 0; b < numBlocks; b++) { result[offset++] = blockEcc[b][i]; }
+    }
+}
+
+// The error correction of the build, with or without RS_LOOKUP_TABLES, matches the reference
+// for random data of every version and level. Both builds are checked, see tests/Makefile
+static void testErrorCorrectionOfRandomData() {
+    static uint8_t data[4096], input[4096], result[4096], expected[4096];
+    srand(22);
+    
+    int blocks = 0;
+    for (uint8_t version = 1; version <= 40; version++) {
+        for (uint8_t ecc = 0; ecc < 4; ecc++) {
+            for (int k = 0; k < 20; k++) {
+                BitBucket codewords;
+                bb_initBuffer(&codewords, data, bb_getBufferSizeBytes(getModuleCount(version)));
+                for (uint16_t i = 0; i < codewords.capacityBytes; i++) {
+                    data[i] = k == 0 ? 0xFF * (i % 2) : rand();
+                }
+                memcpy(input, data, codewords.capacityBytes);
+                
+                // The codewords are replaced by the result
+                uint8_t eccFormatBits = (ECC_FORMAT_BITS >> (2 * ecc)) & 0x03;
+                performErrorCorrection(version, eccFormatBits, &codewords, result);
+                interleaveBlocks(version, eccFormatBits, input, expected);
+                CHECK(0 == memcmp(result, expected, getModuleCount(version) / 8),
+                      "version %d ecc %d: error correction differs", version, ecc);
+                blocks += NUM_ERROR_CORRECTION_BLOCKS[eccFormatBits][version - 1];
+            }
+        }
+    }
+    printf("qrcode: RS_LOOKUP_TABLES=%d corrects %d blocks like the reference\n", RS_LOOKUP_TABLES, blocks);
+}
+
+static double microseconds(struct timespec start, int count) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3) / count;
+}
+
+// Time of the encoding of a payload that fills the version, and of its error correction alone,
+// per version and level, reported only. Compare the output of both builds
+static void benchmarkEncoding() {
+    static const uint8_t VERSIONS[] = { 1, 2, 4, 7, 10, 20, 40 };
+    static uint8_t modules[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t payload[3000], data[4096], result[4096];
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = 'a' + i % 26;
+        data[i] = i * 37;
+    }
+    
+    printf("qrcode: RS_LOOKUP_TABLES=%d, us per call  encode L/M/Q/H            error correction L/M/Q/H\n",
+           RS_LOOKUP_TABLES);
+    for (size_t v = 0; v < sizeof(VERSIONS); v++) {
+        uint8_t version = VERSIONS[v];
+        double encode[4], correct[4];
+        for (uint8_t ecc = 0; ecc < 4; ecc++) {
+            int count = 8000 / version / version + 20;
+            uint16_t length = getDataCapacity(version, ecc) - 3;
+            QRCode qrcode;
+            struct timespec start;
+            
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (int i = 0; i < count; i++) {
+                qrcode_initBytes(&qrcode, modules, version, ecc, payload, length);
+            }
+            encode[ecc] = microseconds(start, count);
+            
+            BitBucket codewords;
+            bb_initBuffer(&codewords, data, bb_getBufferSizeBytes(getModuleCount(version)));
+            uint8_t eccFormatBits = (ECC_FORMAT_BITS >> (2 * ecc)) & 0x03;
+            count *= 10;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (int i = 0; i < count; i++) {
+                performErrorCorrection(version, eccFormatBits, &codewords, result);
+            }
+            correct[ecc] = microseconds(start, count);
+        }
+        printf("qrcode:   version %2d  %7.1f %7.1f %7.1f %7.1f   %7.1f %7.1f %7.1f %7.1f\n", version,
+               encode[0], encode[1], encode[2], encode[3], correct[0], correct[1], correct[2], correct[3]);
+    }
+}
+
+
+#pragma mark - Segmentation and version
+
+enum { NUMERIC_PAYLOAD, ALPHANUMERIC_PAYLOAD, BYTE_PAYLOAD, MIXED_PAYLOAD, PAYLOAD_TYPES };
+
+static const char *PAYLOAD_NAMES[PAYLOAD_TYPES] = { "numeric", "alphanumeric", "byte", "mixed" };
+
+// Fills the payload with characters of the type. Alphanumeric payloads take only letters and byte
+// payloads only lowercase letters, so that their cheapest segments are a single one of that mode
+static void fillPayload(uint8_t *payload, uint16_t length, int type) {
+    static const char MIXED[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:abcdefghijklmnopqrstuvwxyz";
+    for (uint16_t i = 0; i < length; i++) {
+        switch (type) {
+            case NUMERIC_PAYLOAD:       payload[i] = '0' + rand() % 10;  break;
+            case ALPHANUMERIC_PAYLOAD:  payload[i] = 'A' + rand() % 26;  break;
+            case BYTE_PAYLOAD:          payload[i] = 'a' + rand() % 26;  break;
+            default:
+                // Runs of one class, so that switching segments pays off
+                if (i == 0 || rand() % 8 == 0) {
+                    int run = rand() % 3;
+                    payload[i] = run == 0 ? '0' + rand() % 10 : run == 1 ? 'A' + rand() % 26 : rand();
+                } else if (payload[i - 1] >= '0' && payload[i - 1] <= '9') {
+                    payload[i] = '0' + rand() % 10;
+                } else if (getAlphanumeric(payload[i - 1]) != -1) {
+                    payload[i] = MIXED[10 + rand() % 35];
+                } else {
+                    payload[i] = rand();
+                }
+                break;
+        }
+    }
+}
+
+// Returns the fewest bits of any segments of the text, trying every segment
+static uint32_t getFewestSegmentBits(const uint8_t *text, uint16_t length, uint8_t version) {
+    static uint32_t fewest[256];
+    fewest[0] = 0;
+    for (uint16_t end = 1; end <= length; end++) {
+        fewest[end] = UINT32_MAX;
+        bool numeric = true, alphanumeric = true;
+        for (uint16_t start = end; start-- > 0; ) {
+            numeric = numeric && text[start] >= '0' && text[start] <= '9';
+            alphanumeric = alphanumeric && getAlphanumeric(text[start]) != -1;
+            for (uint8_t m = 0; m < 3; m++) {
+                if ((m == MODE_NUMERIC && !numeric) || (m == MODE_ALPHANUMERIC && !alphanumeric)) {
+                    continue;
+                }
+                uint32_t bits = fewest[start] + getSegmentBits(version, m, end - start);
+                if (bits < fewest[end]) { fewest[end] = bits; }
+            }
+        }
+    }
+    return fewest[length];
+}
+
+// The segments take the fewest bits of all segments and encode every character in their mode
+static void testSegmentsOfRandomPayloads() {
+    static const uint8_t VERSIONS[] = { 1, 10, 27 };
+    uint8_t payload[255];
+    uint8_t modes[255];
+    srand(24);
+    
+    int payloads = 0;
+    for (int i = 0; i < 6000; i++) {
+        int type = i % PAYLOAD_TYPES;
+        uint8_t version = VERSIONS[rand() % 3];
+        uint16_t length = rand() % (i < 3000 ? 40 : sizeof(payload));
+        fillPayload(payload, length, type);
+        
+        uint32_t bits = segmentModes(payload, length, version, modes);
+        uint32_t fewest = getFewestSegmentBits(payload, length, version);
+        CHECK(bits == fewest, "%s payload of %d in version %d: %u bits, expected %u",
+              PAYLOAD_NAMES[type], length, version, bits, fewest);
+        
+        for (uint16_t j = 0; j < length; j++) {
+            CHECK(modes[j] >= getMode(payload + j, 1), "%s payload of %d: character %d in mode %d",
+                  PAYLOAD_NAMES[type], length, j, modes[j]);
+        }
+        payloads++;
+    }
+    printf("qrcode: %d payloads take the fewest segment bits\n", payloads);
+}
+
+// qrcode_initBytesAuto chooses the smallest version which fits the payload and raises the error
+// correction as far as it still fits. Non-empty single mode payloads encode like qrcode_initBytes
+static void testVersionOfRandomPayloads() {
+    static uint8_t modules[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t fixedModules[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t payload[3000];
+    srand(124);
+    
+    int codes = 0;
+    for (int i = 0; i < 2000; i++) {
+        int type = i % PAYLOAD_TYPES;
+        uint8_t ecc = rand() % 4;
+        uint16_t length = rand() % (i < 1500 ? 300 : sizeof(payload));
+        fillPayload(payload, length, type);
+        
+        QRCode qrcode, fixed;
+        if (0 != qrcode_initBytesAuto(&qrcode, modules, 40, ecc, payload, length)) {
+            CHECK(0 != qrcode_initBytes(&fixed, fixedModules, 40, ecc, payload, length),
+                  "%s payload of %d ecc %d: fits a single segment only", PAYLOAD_NAMES[type], length, ecc);
+            continue;
+        }
+        codes++;
+        
+        uint8_t version = qrcode.version;
+        CHECK(qrcode.ecc >= ecc, "%s payload of %d: ecc %d lowered to %d",
+              PAYLOAD_NAMES[type], length, ecc, qrcode.ecc);
+        if (version > 1) {
+            CHECK(0 != qrcode_initBytesAuto(&fixed, fixedModules, version - 1, ecc, payload, length),
+                  "%s payload of %d ecc %d: fits version %d, chose %d",
+                  PAYLOAD_NAMES[type], length, ecc, version - 1, version);
+        }
+        if (qrcode.ecc < ECC_HIGH) {
+            CHECK(0 != qrcode_initBytesAuto(&fixed, fixedModules, version, qrcode.ecc + 1, payload, length),
+                  "%s payload of %d version %d: fits ecc %d, chose %d",
+                  PAYLOAD_NAMES[type], length, version, qrcode.ecc + 1, qrcode.ecc);
+        }
+        
+        if (type != MIXED_PAYLOAD && length > 0) {
+            CHECK(0 == qrcode_initBytes(&fixed, fixedModules, version, qrcode.ecc, payload, length) &&
+                  fixed.mode == qrcode.mode &&
+                  0 == memcmp(modules, fixedModules, qrcode_getBufferSize(version)),
+                  "%s payload of %d version %d ecc %d: other modules than a single segment",
+                  PAYLOAD_NAMES[type], length, version, qrcode.ecc);
+        }
+    }
+    printf("qrcode: %d codes chose the smallest version and the highest ecc\n", codes);
+}
+
+// The payloads one character over the capacity of version 40 do not fit
+static void testOverflow() {
+    static const struct { int type; uint16_t capacity; } CAPACITIES[] = {
+        { NUMERIC_PAYLOAD, 7089 }, { ALPHANUMERIC_PAYLOAD, 4296 }, { BYTE_PAYLOAD, 2953 },
+    };
+    static uint8_t modules[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t workspaceBuffer[QRCODE_WORKSPACE_SIZE(40, 100)];
+    static uint8_t payload[7090];
+    srand(40);
+    
+    for (int i = 0; i < 3; i++) {
+        int type = CAPACITIES[i].type;
+        uint16_t capacity = CAPACITIES[i].capacity;
+        fillPayload(payload, capacity + 1, type);
+        
+        QRCode qrcode;
+        CHECK(0 == qrcode_initBytesAuto(&qrcode, modules, 40, ECC_LOW, payload, capacity) &&
+              qrcode.version == 40 && qrcode.ecc == ECC_LOW,
+              "%s payload of %d: does not fit version 40", PAYLOAD_NAMES[type], capacity);
+        CHECK(0 == qrcode_initBytes(&qrcode, modules, 40, ECC_LOW, payload, capacity),
+              "%s payload of %d: does not fit version 40", PAYLOAD_NAMES[type], capacity);
+        CHECK(-1 == qrcode_initBytesAuto(&qrcode, modules, 40, ECC_LOW, payload, capacity + 1),
+              "%s payload of %d: fits version 40", PAYLOAD_NAMES[type], capacity + 1);
+        CHECK(-1 == qrcode_initBytes(&qrcode, modules, 40, ECC_LOW, payload, capacity + 1),
+              "%s payload of %d: fits version 40", PAYLOAD_NAMES[type], capacity + 1);
+        CHECK(-1 == qrcode_initBytesAuto(&qrcode, modules, 1, ECC_LOW, payload, 42),
+              "%s payload of 42: fits version 1", PAYLOAD_NAMES[type]);
+    }
+    
+    QRCodeWorkspace workspace;
+    QRCode qrcode;
+    qrcode_initWorkspace(&workspace, workspaceBuffer, 40, 100);
+    fillPayload(payload, 101, BYTE_PAYLOAD);
+    CHECK(0 == qrcode_initBytesWorkspace(&workspace, &qrcode, modules, ECC_LOW, payload, 100),
+          "workspace payload of 100: does not fit");
+    CHECK(-1 == qrcode_initBytesWorkspace(&workspace, &qrcode, modules, ECC_LOW, payload, 101),
+          "workspace payload of 101: fits a workspace of 100");
+    printf("qrcode: payloads over the capacity do not fit\n");
+}
+
+// qrcode_initBytesWorkspace encodes like qrcode_initBytesAuto. One workspace of each size is reused
+// for all payloads, so its function patterns are kept across versions and levels
+static void testWorkspaceOfRandomPayloads() {
+    static const uint8_t MAX_VERSIONS[] = { 40, 10, 4 };
+    static uint8_t modules[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t autoModules[QRCODE_BUFFER_SIZE(40)];
+    static uint8_t buffers[3][QRCODE_WORKSPACE_SIZE(40, 1000)];
+    static uint8_t payload[1000];
+    QRCodeWorkspace workspaces[3];
+    for (int w = 0; w < 3; w++) {
+        qrcode_initWorkspace(&workspaces[w], buffers[w], MAX_VERSIONS[w], sizeof(payload));
+    }
+    srand(25);
+    
+    int codes = 0;
+    uint16_t maxLength = 0;
+    for (int i = 0; i < 6000; i++) {
+        // Runs of similar payloads keep the version while the level changes
+        if (i % 6 == 0) { maxLength = 1 + (rand() % 8 ? rand() % 120 : rand() % sizeof(payload)); }
+        int w = rand() % 3;
+        int type = rand() % PAYLOAD_TYPES;
+        uint8_t ecc = rand() % 4;
+        uint16_t length = maxLength - rand() % (maxLength / 8 + 1);
+        fillPayload(payload, length, type);
+        
+        QRCode qrcode, expected;
+        int8_t result = qrcode_initBytesWorkspace(&workspaces[w], &qrcode, modules, ecc, payload, length);
+        int8_t expectedResult = qrcode_initBytesAuto(&expected, autoModules, MAX_VERSIONS[w], ecc, payload, length);
+        CHECK(result == expectedResult, "%s payload of %d ecc %d up to version %d: %d, expected %d",
+              PAYLOAD_NAMES[type], length, ecc, MAX_VERSIONS[w], result, expectedResult);
+        if (result != 0 || expectedResult != 0) {
+            continue;
+        }
+        codes++;
+        
+        CHECK(qrcode.version == expected.version && qrcode.ecc == expected.ecc &&
+              qrcode.mode == expected.mode && qrcode.mask == expected.mask &&
+              0 == memcmp(modules, autoModules, qrcode_getBufferSize(expected.version)),
+              "%s payload of %d ecc %d: workspace encoded version %d ecc %d mask %d, "
+              "expected version %d ecc %d mask %d", PAYLOAD_NAMES[type], length, ecc,
+              qrcode.version, qrcode.ecc, qrcode.mask, expected.version, expected.ecc, expected.mask);
+    }
+    printf("qrcode: %d codes of reused workspaces match qrcode_initBytesAuto\n", codes);
+}
+
+// An empty payload takes no segment in auto mode, qrcode_initBytes encodes an empty numeric segment
+static void testEmptyPayload() {
+    static uint8_t modules[QRCODE_BUFFER_SIZE(1)];
+    static uint8_t fixedModules[QRCODE_BUFFER_SIZE(1)];
+    uint8_t payload[1] = { 0 };
+    uint8_t modes[1];
+    
+    CHECK(0 == segmentModes(payload, 0, 1, modes), "empty payload takes segment bits");
+    CHECK(14 == getSegmentBits(1, MODE_NUMERIC, 0), "empty numeric segment takes %u bits",
+          getSegmentBits(1, MODE_NUMERIC, 0));
+    
+    QRCode qrcode, fixed;
+    CHECK(0 == qrcode_initBytesAuto(&qrcode, modules, 1, ECC_LOW, payload, 0) &&
+          qrcode.version == 1 && qrcode.ecc == ECC_HIGH && qrcode.mode == MODE_NUMERIC,
+          "empty payload: version %d ecc %d mode %d", qrcode.version, qrcode.ecc, qrcode.mode);
+    CHECK(0 == qrcode_initBytes(&fixed, fixedModules, 1, ECC_HIGH, payload, 0) &&
+          fixed.mode == MODE_NUMERIC, "empty payload: mode %d", fixed.mode);
+    CHECK(0 != memcmp(modules, fixedModules, sizeof(modules)),
+          "empty payload: auto mode encodes the empty numeric segment");
+    printf("qrcode: empty payload takes no segment in auto mode\n");
+}
+
+
+int main() {
+    testPenaltyOfRandomGrids();
+    testMaskChoiceOfRandomPayloads();
+    testSegmentsOfRandomPayloads();
+    testVersionOfRandomPayloads();
+    testOverflow();
+    testEmptyPayload();
+    testWorkspaceOfRandomPayloads();
+    testErrorCorrectionOfRandomData();
+    benchmarkEncoding();
+    
+    if (failures) {
+        printf("qrcode: %d failures\n", failures);
+        return 1;
+    }
+    return 0;
+}
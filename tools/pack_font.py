@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+#
+#  Licensed under the Apache License, Version 2.0 (the "License"); you may
+#  not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+#  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+
+"""
+Pack one of the fonts in EPD_4R2/Fonts with only the characters a screen needs.
+
+Every glyph is cropped to the bounding box of its pixels and its rows are
+stored padded to whole bytes, so Paint draws them row by row like the full
+tables. Glyphs with the same pixels are stored once, all blank characters
+share one empty glyph. The characters are kept in a sorted map to their
+glyph, characters not in the map are drawn blank.
+
+The glyphs are proportional: every glyph starts --bearing pixels after the
+pen position and advances the pen by its width and twice the bearing, blank
+characters advance it by --space pixels. See app/TextLayout.h.
+
+With --scale the glyphs are scaled down first, a pixel is set if at least
+half of its area is covered by set pixels of the font.
+
+The output is a C file with the sFONT of the packed font, see fonts.h.
+
+Usage:
+    pack_font.py <font.c> <name> --chars <characters> [--bearing <pixels>]
+                 [--space <pixels>] [--scale <num>/<den>] > app/<file>.c
+
+The packed fonts of the parking sign:
+    pack_font.py EPD_4R2/Fonts/font24.c PackedFont24 --chars " -.:0123456789Chimn"
+    pack_font.py EPD_4R2/Fonts/Font4040.c PackedFont4040 --chars " .0123456789:"
+    pack_font.py EPD_4R2/Fonts/EuroFont9664.c PackedEuroFont9664 \\
+        --chars " !-:0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ" --bearing 1 --space 16
+    pack_font.py EPD_4R2/Fonts/EuroFont9664.c PackedEuroFont7248 \\
+        --chars " -:0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ" --bearing 1 --space 12 --scale 3/4
+    pack_font.py EPD_4R2/Fonts/EuroFont9664.c PackedEuroFont4832 \\
+        --chars " -:0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ" --bearing 1 --space 8 --scale 1/2
+    pack_font.py EPD_4R2/Fonts/EuroFont9664.c PackedEuroFont2416 \\
+        --chars "ABCDEFGHIJKLMNOPQRSTUVWXYZ" --bearing 1 --space 4 --scale 1/4
+"""
+
+import argparse
+import re
+import sys
+
+
+def read_font(path):
+    with open(path) as f:
+        text = f.read()
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    table = re.search(r'_Table\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;', text, re.S)
+    font = re.search(r'sFONT\s+\w+\s*=\s*\{\s*\w+\s*,\s*(\d+)\s*,\s*(\d+)', text)
+    if table is None or font is None:
+        sys.exit('%s: no font table found' % path)
+    data = bytes(int(value, 0) for value in re.findall(r'0[xX][0-9a-fA-F]+|\b\d+\b', table.group(1)))
+    return int(font.group(1)), int(font.group(2)), data
+
+
+def scale(pixels, width, height, num, den):
+    """Scale by num / den, the pixels covered at least half are set"""
+    scaled_width = (width * num + den - 1) // den
+    scaled_height = (height * num + den - 1) // den
+
+    def spans(t, size):
+        # Source pixels overlapped by the target pixel t, in 1 / num / den units
+        first, last = t * den, (t + 1) * den
+        for i in range(first // num, min(size, (last + num - 1) // num)):
+            yield i, min(last, (i + 1) * num) - max(first, i * num)
+
+    scaled = []
+    for ty in range(scaled_height):
+        row = []
+        for tx in range(scaled_width):
+            covered = sum(wy * wx for y, wy in spans(ty, height) for x, wx in spans(tx, width)
+                          if pixels[y][x])
+            row.append(2 * covered >= den * den)
+        scaled.append(row)
+    return scaled
+
+
+def crop(pixels, width, height, bearing, space):
+    """Bounding box of the set pixels, the advance and the rows padded to whole bytes"""
+    xs = [x for y in range(height) for x in range(width) if pixels[y][x]]
+    ys = [y for y in range(height) if any(pixels[y])]
+    if not xs:
+        return 0, 0, 0, 0, space, b''
+    x0, x1, y0, y1 = min(xs), max(xs), min(ys), max(ys)
+    rows = bytearray()
+    for y in range(y0, y1 + 1):
+        row = bytearray((x1 - x0 + 8) // 8)
+        for x in range(x0, x1 + 1):
+            if pixels[y][x]:
+                row[(x - x0) // 8] |= 0x80 >> ((x - x0) % 8)
+        rows += row
+    return bearing, y0, x1 - x0 + 1, y1 - y0 + 1, x1 - x0 + 1 + 2 * bearing, bytes(rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('input', help='font file of EPD_4R2/Fonts')
+    parser.add_argument('name', help='name of the sFONT in C')
+    parser.add_argument('--chars', required=True, help='characters to keep')
+    parser.add_argument('--bearing', type=int, help='pixels left and right of every glyph, '
+                        'default 1/20 of the font width')
+    parser.add_argument('--space', type=int, help='advance of blank characters, '
+                        'default 1/4 of the font width')
+    parser.add_argument('--scale', default='1/1', help='scale of the glyphs, e.g. 1/2')
+    args = parser.parse_args()
+
+    font_width, font_height, table = read_font(args.input)
+    num, den = (int(value) for value in args.scale.split('/'))
+    if not 0 < num <= den:
+        sys.exit('%s: fonts can only be scaled down' % args.input)
+    width = (font_width * num + den - 1) // den
+    height = (font_height * num + den - 1) // den
+    bearing = args.bearing if args.bearing is not None else max(1, width // 20)
+    space = args.space if args.space is not None else width // 4
+    line_bytes = (font_width + 7) // 8
+    glyph_bytes = line_bytes * font_height
+    codes = sorted(set(args.chars))
+    if any(not ' ' <= c <= '~' for c in codes):
+        sys.exit('%s: only printable ascii characters are supported' % args.input)
+
+    # Glyph 0 is the empty glyph of all blank characters
+    glyphs = [(0, 0, 0, 0, space, b'')]
+    index = []
+    data = bytearray()
+    offsets = [0]
+    for c in codes:
+        start = (ord(c) - ord(' ')) * glyph_bytes
+        raw = table[start:start + glyph_bytes]
+        if len(raw) < glyph_bytes:
+            sys.exit('%s: no glyph for %r' % (args.input, c))
+        pixels = [[raw[y * line_bytes + x // 8] & (0x80 >> (x % 8)) for x in range(font_width)]
+                  for y in range(font_height)]
+        if num != den:
+            pixels = scale(pixels, font_width, font_height, num, den)
+        glyph = crop(pixels, width, height, bearing, space)
+        if glyph not in glyphs:
+            glyphs.append(glyph)
+            offsets.append(len(data))
+            data += glyph[5]
+        index.append(glyphs.index(glyph))
+    if len(data) > 0xFFFF or len(glyphs) > 0xFF:
+        sys.exit('%s: too many glyphs for 16 bit offsets and 8 bit indices' % args.input)
+    if any(glyph[4] > 0xFF for glyph in glyphs):
+        sys.exit('%s: advance too large for 8 bits' % args.input)
+
+    name = args.name
+    print('#include "fonts.h"')
+    print('')
+    print('// Font %dx%d, %d characters "%s", %d glyphs in %d bytes, %d bytes unpacked'
+          % (width, height, len(codes), ''.join(codes).replace('\\', '\\\\'), len(glyphs),
+             len(data), len(table)))
+    print('// Generated with tools/pack_font.py from %s, do not edit' % args.input)
+    print('static const uint8_t %s_Table[] = {' % name)
+    for (x, y, w, h, advance, rows), offset in zip(glyphs[1:], offsets[1:]):
+        step = (w + 7) // 8
+        for i in range(0, len(rows), step):
+            print(','.join('0x%02X' % b for b in rows[i:i + step]) + ',')
+    if not data:
+        print('0x00')
+    print('};')
+    print('')
+    print('static const sGLYPH %s_Glyphs[] = {' % name)
+    for (x, y, w, h, advance, rows), offset in zip(glyphs, offsets):
+        print('    {%d, %d, %d, %d, %d, %d},' % (offset, x, y, w, h, advance))
+    print('};')
+    print('')
+    print('static const uint8_t %s_Codes[] = {' % name)
+    print('    ' + ', '.join("'%s'" % ('\\' + c if c in '\\\'' else c) for c in codes))
+    print('};')
+    print('')
+    print('static const uint8_t %s_Index[] = {' % name)
+    print('    ' + ', '.join('%d' % i for i in index))
+    print('};')
+    print('')
+    print('sFONT %s = {' % name)
+    print(' %s_Table,' % name)
+    print(' %d, // width ' % width)
+    print(' %d, // Height' % height)
+    print(' %s_Glyphs,' % name)
+    print(' %s_Codes,' % name)
+    print(' %s_Index,' % name)
+    print(' %d  // characters' % len(codes))
+    print('};')
+    sys.stderr.write('%s: %d bytes -> %d bytes + %d bytes glyphs and map\n'
+                     % (name, len(table), len(data), 8 * len(glyphs) + 2 * len(codes)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+#  Licensed under the Apache License, Version 2.0 (the "License"); you may
+#  not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+#  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+
+"""
+Convert a 1bpp background image into a PackedImage for the parking sign.
+
+The image is inverted to the polarity of the display buffer and every row
+is compressed on its own with PackBits, so any row can be decoded without
+the rows above it. The output is a C file with the coded rows, the offset
+of every row and the PackedImage descriptor, see app/PackedImage.h.
+
+Input is either a binary PBM (P4) file or a C file with a uint8_t array
+of width / 8 bytes per row, as the images were stored before.
+
+Usage:
+    pack_image.py <input> <name> [--width 400] [--height 300] > app/<name>.c
+"""
+
+import argparse
+import re
+import sys
+
+
+def read_pbm(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    tokens = []
+    pos = 0
+    # Header: magic, width and height, separated by whitespace and comments
+    while len(tokens) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos) + 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+    if tokens[0] != b'P4':
+        sys.exit('%s: only binary PBM (P4) images are supported' % path)
+    width, height = int(tokens[1]), int(tokens[2])
+    pos += 1
+    # PBM: 1 is black, the same as the stored C arrays
+    return width, height, data[pos:pos + (width + 7) // 8 * height]
+
+
+def read_c_array(path, width, height):
+    with open(path) as f:
+        text = f.read()
+    body = text[text.index('{') + 1:text.rindex('}')]
+    data = bytes(int(value, 0) for value in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body))
+    return width, height, data[:(width + 7) // 8 * height]
+
+
+def packbits(row):
+    """PackBits: n >= 0 copies n + 1 bytes, n < 0 repeats the next byte 1 - n times"""
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and run < 128 and row[i + run] == row[i]:
+            run += 1
+        if run >= 2:
+            if literal:
+                out.append(len(literal) - 1)
+                out += literal
+                literal = bytearray()
+            out.append(257 - run)
+            out.append(row[i])
+            i += run
+        else:
+            literal.append(row[i])
+            if len(literal) == 128:
+                out.append(127)
+                out += literal
+                literal = bytearray()
+            i += 1
+    if literal:
+        out.append(len(literal) - 1)
+        out += literal
+    return out
+
+
+def unpackbits(data, length):
+    out = bytearray()
+    i = 0
+    while len(out) < length:
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('input', help='PBM image or C array file')
+    parser.add_argument('name', help='name of the PackedImage in C')
+    parser.add_argument('--width', type=int, default=400, help='width of a C array image')
+    parser.add_argument('--height', type=int, default=300, help='height of a C array image')
+    args = parser.parse_args()
+
+    if args.input.endswith('.c'):
+        width, height, image = read_c_array(args.input, args.width, args.height)
+    else:
+        width, height, image = read_pbm(args.input)
+
+    line_bytes = (width + 7) // 8
+    if len(image) != line_bytes * height:
+        sys.exit('%s: %d bytes, expected %d' % (args.input, len(image), line_bytes * height))
+
+    data = bytearray()
+    rows = []
+    for y in range(height):
+        # The display buffer has 1 for white pixels
+        row = bytes(~b & 0xFF for b in image[y * line_bytes:(y + 1) * line_bytes])
+        coded = packbits(row)
+        assert unpackbits(coded, line_bytes) == row
+        rows.append(len(data))
+        data += coded
+    if len(data) > 0xFFFF:
+        sys.exit('%s: %d bytes coded, the row offsets are 16 bit' % (args.input, len(data)))
+
+    name = args.name
+    print('#include "PackedImage.h"')
+    print('')
+    print('// Image %dx%d, %d bytes PackBits coded, %d bytes uncompressed'
+          % (width, height, len(data), len(image)))
+    print('// Generated with tools/pack_image.py, do not edit')
+    print('static const uint8_t %s_data[] = {' % name)
+    for y in range(height):
+        coded = data[rows[y]:rows[y + 1] if y + 1 < height else len(data)]
+        for i in range(0, len(coded), 21):
+            print(','.join('0x%02X' % b for b in coded[i:i + 21]) + ',')
+    print('};')
+    print('')
+    print('static const uint16_t %s_rows[] = {' % name)
+    for i in range(0, height, 12):
+        print(','.join('%d' % offset for offset in rows[i:i + 12]) + ',')
+    print('};')
+    print('')
+    print('extern const PackedImage %s = {' % name)
+    print('    %d, %d, %s_rows, %s_data' % (width, height, name, name))
+    print('};')
+    sys.stderr.write('%s: %d bytes -> %d bytes + %d bytes row index\n'
+                     % (name, len(image), len(data), 2 * height))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,444 @@
+#!/usr/bin/env python3
+#
+#  Licensed under the Apache License, Version 2.0 (the "License"); you may
+#  not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+#  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+
+"""
+Encode the QR code of a fixed payload from a header into a constant QRCode.
+
+The payload is a string macro of a header, e.g. QRCODE_APP_ID of
+app/boardmap.h. It is encoded the same way as qrcode_initText() of
+QRCode/src/qrcode.c does on the device: a single mode for the whole payload,
+the given version and error correction level and the mask of the lowest
+penalty, so the modules are the same bits. The output is a C++ file with the
+modules and the QRCode in flash. It checks at compile time that the macro
+still has the encoded payload, a changed payload fails the build until the
+file is generated again.
+
+Usage:
+    pack_qrcode.py <header> <macro> <name> [--version 4] [--ecc low] > app/<name>.cpp
+"""
+
+import argparse
+import re
+import sys
+
+
+MODE_NUMERIC = 0
+MODE_ALPHANUMERIC = 1
+MODE_BYTE = 2
+
+ECC_LEVELS = {'low': 0, 'medium': 1, 'quartile': 2, 'high': 3}
+ECC_NAMES = ['ECC_LOW', 'ECC_MEDIUM', 'ECC_QUARTILE', 'ECC_HIGH']
+MODE_NAMES = ['MODE_NUMERIC', 'MODE_ALPHANUMERIC', 'MODE_BYTE']
+
+# The tables of qrcode.c, indexed by the format bits of the level: medium, low, high, quartile
+NUM_ERROR_CORRECTION_CODEWORDS = [
+    [10, 16, 26, 36, 48, 64, 72, 88, 110, 130, 150, 176, 198, 216, 240, 280, 308, 338, 364, 416,
+     442, 476, 504, 560, 588, 644, 700, 728, 784, 812, 868, 924, 980, 1036, 1064, 1120, 1204, 1260,
+     1316, 1372],
+    [7, 10, 15, 20, 26, 36, 40, 48, 60, 72, 80, 96, 104, 120, 132, 144, 168, 180, 196, 224,
+     224, 252, 270, 300, 312, 336, 360, 390, 420, 450, 480, 510, 540, 570, 570, 600, 630, 660,
+     720, 750],
+    [17, 28, 44, 64, 88, 112, 130, 156, 192, 224, 264, 308, 352, 384, 432, 480, 532, 588, 650, 700,
+     750, 816, 900, 960, 1050, 1110, 1200, 1260, 1350, 1440, 1530, 1620, 1710, 1800, 1890, 1980,
+     2100, 2220, 2310, 2430],
+    [13, 22, 36, 52, 72, 96, 108, 132, 160, 192, 224, 260, 288, 320, 360, 408, 448, 504, 546, 600,
+     644, 690, 750, 810, 870, 952, 1020, 1050, 1140, 1200, 1290, 1350, 1440, 1530, 1590, 1680, 1770,
+     1860, 1950, 2040],
+]
+
+NUM_ERROR_CORRECTION_BLOCKS = [
+    [1, 1, 1, 2, 2, 4, 4, 4, 5, 5, 5, 8, 9, 9, 10, 10, 11, 13, 14, 16, 17, 17, 18, 20, 21, 23, 25,
+     26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49],
+    [1, 1, 1, 1, 1, 2, 2, 2, 2, 4, 4, 4, 4, 4, 6, 6, 6, 6, 7, 8, 8, 9, 9, 10, 12, 12, 12, 13, 14,
+     15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25],
+    [1, 1, 2, 4, 4, 4, 5, 6, 8, 8, 11, 11, 16, 16, 18, 16, 19, 21, 25, 25, 25, 34, 30, 32, 35, 37,
+     40, 42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81],
+    [1, 1, 2, 2, 4, 4, 6, 6, 8, 8, 8, 10, 12, 16, 12, 17, 16, 18, 21, 20, 23, 23, 25, 27, 29, 34,
+     34, 35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68],
+]
+
+NUM_RAW_DATA_MODULES = [
+    208, 359, 567, 807, 1079, 1383, 1568, 1936, 2336, 2768, 3232, 3728, 4256, 4651, 5243, 5867,
+    6523, 7211, 7931, 8683, 9252, 10068, 10916, 11796, 12708, 13652, 14628, 15371, 16411, 17483,
+    18587, 19723, 20891, 22091, 23008, 24272, 25568, 26896, 28256, 29648,
+]
+
+ALPHANUMERIC = '0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:'
+
+
+def read_macro(path, macro):
+    with open(path) as f:
+        text = f.read()
+    match = re.search(r'^\s*#define\s+%s\s+"((?:[^"\\]|\\.)*)"' % re.escape(macro), text, re.M)
+    if match is None:
+        sys.exit('%s: no string macro %s' % (path, macro))
+    return match.group(1).encode('latin-1').decode('unicode_escape').encode('latin-1')
+
+
+class BitBuffer:
+    def __init__(self):
+        self.bits = []
+
+    def append(self, value, length):
+        self.bits += [(value >> i) & 1 for i in range(length - 1, -1, -1)]
+
+
+def mode_bits(version, mode):
+    index = 0 if version <= 9 else 1 if version <= 26 else 2
+    return [[10, 12, 14], [9, 11, 13], [8, 16, 16]][mode][index]
+
+
+def encode_data(data, version):
+    """The data codewords of qrcode.c: one mode for the whole payload"""
+    buffer = BitBuffer()
+    text = data.decode('latin-1')
+    if all('0' <= c <= '9' for c in text):
+        mode = MODE_NUMERIC
+        buffer.append(1 << mode, 4)
+        buffer.append(len(data), mode_bits(version, mode))
+        for i in range(0, len(text), 3):
+            group = text[i:i + 3]
+            buffer.append(int(group), len(group) * 3 + 1)
+    elif all(c in ALPHANUMERIC for c in text):
+        mode = MODE_ALPHANUMERIC
+        buffer.append(1 << mode, 4)
+        buffer.append(len(data), mode_bits(version, mode))
+        for i in range(0, len(text), 2):
+            group = text[i:i + 2]
+            if len(group) == 2:
+                buffer.append(ALPHANUMERIC.index(group[0]) * 45 + ALPHANUMERIC.index(group[1]), 11)
+            else:
+                buffer.append(ALPHANUMERIC.index(group[0]), 6)
+    else:
+        mode = MODE_BYTE
+        buffer.append(1 << mode, 4)
+        buffer.append(len(data), mode_bits(version, mode))
+        for byte in data:
+            buffer.append(byte, 8)
+    return mode, buffer
+
+
+def rs_multiply(x, y):
+    z = 0
+    for i in range(7, -1, -1):
+        z = ((z << 1) ^ ((z >> 7) * 0x11D)) & 0x1FF
+        z ^= ((y >> i) & 1) * x
+    return z & 0xFF
+
+
+def rs_generator(degree):
+    coeff = [0] * (degree - 1) + [1]
+    root = 1
+    for _ in range(degree):
+        for j in range(degree):
+            coeff[j] = rs_multiply(coeff[j], root)
+            if j + 1 < degree:
+                coeff[j] ^= coeff[j + 1]
+        root = (root << 1) ^ ((root >> 7) * 0x11D)
+    return coeff
+
+
+def rs_remainder(data, coeff):
+    result = [0] * len(coeff)
+    for byte in data:
+        factor = byte ^ result[0]
+        result = result[1:] + [0]
+        for j, c in enumerate(coeff):
+            result[j] ^= rs_multiply(c, factor)
+    return result
+
+
+def add_error_correction(codewords, version, ecc_bits):
+    """Split the data codewords into blocks and interleave them with their error correction"""
+    num_blocks = NUM_ERROR_CORRECTION_BLOCKS[ecc_bits][version - 1]
+    block_ecc_len = NUM_ERROR_CORRECTION_CODEWORDS[ecc_bits][version - 1] // num_blocks
+    raw_codewords = NUM_RAW_DATA_MODULES[version - 1] // 8
+    num_short_blocks = num_blocks - raw_codewords % num_blocks
+    short_data_len = raw_codewords // num_blocks - block_ecc_len
+
+    blocks = []
+    offset = 0
+    for i in range(num_blocks):
+        length = short_data_len + (0 if i < num_short_blocks else 1)
+        blocks.append(codewords[offset:offset + length])
+        offset += length
+    coeff = rs_generator(block_ecc_len)
+    eccs = [rs_remainder(block, coeff) for block in blocks]
+
+    result = []
+    for i in range(short_data_len + 1):
+        result += [block[i] for block in blocks if i < len(block)]
+    for i in range(block_ecc_len):
+        result += [ecc[i] for ecc in eccs]
+    return result
+
+
+class Grid:
+    def __init__(self, version):
+        self.size = version * 4 + 17
+        self.modules = [[False] * self.size for _ in range(self.size)]
+        self.function = [[False] * self.size for _ in range(self.size)]
+
+    def set_function(self, x, y, on):
+        self.modules[y][x] = on
+        self.function[y][x] = True
+
+
+def draw_format_bits(grid, ecc_bits, mask):
+    size = grid.size
+    data = ecc_bits << 3 | mask
+    rem = data
+    for _ in range(10):
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537)
+    data = (data << 10 | rem) ^ 0x5412
+    bit = lambda i: ((data >> i) & 1) != 0
+
+    for i in range(6):
+        grid.set_function(8, i, bit(i))
+    grid.set_function(8, 7, bit(6))
+    grid.set_function(8, 8, bit(7))
+    grid.set_function(7, 8, bit(8))
+    for i in range(9, 15):
+        grid.set_function(14 - i, 8, bit(i))
+    for i in range(8):
+        grid.set_function(size - 1 - i, 8, bit(i))
+    for i in range(8, 15):
+        grid.set_function(8, size - 15 + i, bit(i))
+    grid.set_function(8, size - 8, True)
+
+
+def draw_function_patterns(grid, version, ecc_bits):
+    size = grid.size
+    for i in range(size):
+        grid.set_function(6, i, i % 2 == 0)
+        grid.set_function(i, 6, i % 2 == 0)
+
+    for cx, cy in ((3, 3), (size - 4, 3), (3, size - 4)):
+        for i in range(-4, 5):
+            for j in range(-4, 5):
+                x, y = cx + j, cy + i
+                if 0 <= x < size and 0 <= y < size:
+                    dist = max(abs(i), abs(j))
+                    grid.set_function(x, y, dist != 2 and dist != 4)
+
+    if version > 1:
+        count = version // 7 + 2
+        step = 26 if version == 32 else (version * 4 + count * 2 + 1) // (2 * count - 2) * 2
+        positions = [6] + [size - 7 - i * step for i in range(count - 2, -1, -1)]
+        for i in range(count):
+            for j in range(count):
+                if (i, j) in ((0, 0), (0, count - 1), (count - 1, 0)):
+                    continue
+                for dy in range(-2, 3):
+                    for dx in range(-2, 3):
+                        grid.set_function(positions[i] + dx, positions[j] + dy,
+                                          max(abs(dx), abs(dy)) != 1)
+
+    draw_format_bits(grid, ecc_bits, 0)
+
+    if version >= 7:
+        rem = version
+        for _ in range(12):
+            rem = (rem << 1) ^ ((rem >> 11) * 0x1F25)
+        data = version << 12 | rem
+        for i in range(18):
+            bit = ((data >> i) & 1) != 0
+            a, b = size - 11 + i % 3, i // 3
+            grid.set_function(a, b, bit)
+            grid.set_function(b, a, bit)
+
+
+def draw_codewords(grid, bits):
+    size = grid.size
+    i = 0
+    right = size - 1
+    while right >= 1:
+        if right == 6:
+            right = 5
+        for vert in range(size):
+            for j in range(2):
+                x = right - j
+                upwards = ((right & 2) == 0) ^ (x < 6)
+                y = size - 1 - vert if upwards else vert
+                if not grid.function[y][x] and i < len(bits):
+                    grid.modules[y][x] = bits[i] != 0
+                    i += 1
+        right -= 2
+
+
+MASKS = [
+    lambda x, y: (x + y) % 2 == 0,
+    lambda x, y: y % 2 == 0,
+    lambda x, y: x % 3 == 0,
+    lambda x, y: (x + y) % 3 == 0,
+    lambda x, y: (x // 3 + y // 2) % 2 == 0,
+    lambda x, y: x * y % 2 + x * y % 3 == 0,
+    lambda x, y: (x * y % 2 + x * y % 3) % 2 == 0,
+    lambda x, y: ((x + y) % 2 + x * y % 3) % 2 == 0,
+]
+
+
+def apply_mask(grid, mask):
+    for y in range(grid.size):
+        for x in range(grid.size):
+            if not grid.function[y][x] and MASKS[mask](x, y):
+                grid.modules[y][x] = not grid.modules[y][x]
+
+
+def line_penalty(line):
+    result = 0
+    run = 1
+    for i in range(1, len(line)):
+        if line[i] != line[i - 1]:
+            run = 1
+        else:
+            run += 1
+            if run == 5:
+                result += 3
+            elif run > 5:
+                result += 1
+    bits = ''.join('1' if module else '0' for module in line)
+    for i in range(len(bits) - 10):
+        if bits[i:i + 11] in ('00001011101', '10111010000'):
+            result += 40
+    return result
+
+
+def penalty_score(grid):
+    size = grid.size
+    modules = grid.modules
+    result = sum(line_penalty(row) for row in modules)
+    result += sum(line_penalty([modules[y][x] for y in range(size)]) for x in range(size))
+    for y in range(1, size):
+        for x in range(1, size):
+            color = modules[y][x]
+            if color == modules[y - 1][x - 1] == modules[y - 1][x] == modules[y][x - 1]:
+                result += 3
+    black = sum(sum(row) for row in modules)
+    total = size * size
+    k = 0
+    while black * 20 < (9 - k) * total or black * 20 > (11 + k) * total:
+        result += 10
+        k += 1
+    return result
+
+
+def encode(data, version, ecc):
+    """Return the mode, the mask and the grid of the QR code like qrcode_initBytes()"""
+    ecc_bits = [1, 0, 3, 2][ecc]
+    capacity = NUM_RAW_DATA_MODULES[version - 1] // 8 - NUM_ERROR_CORRECTION_CODEWORDS[ecc_bits][version - 1]
+
+    mode, buffer = encode_data(data, version)
+    if len(buffer.bits) > capacity * 8:
+        return None
+    buffer.append(0, min(4, capacity * 8 - len(buffer.bits)))
+    buffer.append(0, (8 - len(buffer.bits) % 8) % 8)
+    pad = 0xEC
+    while len(buffer.bits) < capacity * 8:
+        buffer.append(pad, 8)
+        pad ^= 0xEC ^ 0x11
+
+    codewords = [int(''.join(map(str, buffer.bits[i:i + 8])), 2) for i in range(0, len(buffer.bits), 8)]
+    codewords = add_error_correction(codewords, version, ecc_bits)
+    bits = []
+    for codeword in codewords:
+        bits += [(codeword >> i) & 1 for i in range(7, -1, -1)]
+
+    grid = Grid(version)
+    draw_function_patterns(grid, version, ecc_bits)
+    draw_codewords(grid, bits)
+
+    mask = 0
+    min_penalty = None
+    for i in range(8):
+        draw_format_bits(grid, ecc_bits, i)
+        apply_mask(grid, i)
+        penalty = penalty_score(grid)
+        if min_penalty is None or penalty < min_penalty:
+            mask, min_penalty = i, penalty
+        apply_mask(grid, i)
+    draw_format_bits(grid, ecc_bits, mask)
+    apply_mask(grid, mask)
+    return mode, mask, grid
+
+
+def pack_modules(grid):
+    """The modules bit by bit from the top left, the first one in the most significant bit"""
+    data = bytearray((grid.size * grid.size + 7) // 8)
+    for y in range(grid.size):
+        for x in range(grid.size):
+            if grid.modules[y][x]:
+                offset = y * grid.size + x
+                data[offset >> 3] |= 0x80 >> (offset & 7)
+    return data
+
+
+def c_string(data):
+    return '"%s"' % ''.join(chr(b) if 32 <= b < 127 and chr(b) not in '"\\?' else '\\%03o' % b
+                            for b in data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('header', help='header with the payload, e.g. app/boardmap.h')
+    parser.add_argument('macro', help='string macro of the payload, e.g. QRCODE_APP_ID')
+    parser.add_argument('name', help='name of the QRCode in C++')
+    parser.add_argument('--version', type=int, default=4, help='QR code version 1 to 40')
+    parser.add_argument('--ecc', choices=list(ECC_LEVELS), default='low', help='error correction level')
+    args = parser.parse_args()
+
+    if not 1 <= args.version <= 40:
+        sys.exit('version %d: must be 1 to 40' % args.version)
+    data = read_macro(args.header, args.macro)
+    ecc = ECC_LEVELS[args.ecc]
+    encoded = encode(data, args.version, ecc)
+    if encoded is None:
+        sys.exit('%s: %d bytes do not fit version %d with %s error correction'
+                 % (args.macro, len(data), args.version, args.ecc))
+    mode, mask, grid = encoded
+    modules = pack_modules(grid)
+
+    name = args.name
+    header = args.header[4:] if args.header.startswith('app/') else args.header
+    print('#include "QRCode/src/qrcode.h"')
+    print('#include "%s"' % header)
+    print('')
+    print('// QR code of %s, version %d, %d x %d modules, %s, %s, mask %d'
+          % (args.macro, args.version, grid.size, grid.size, ECC_NAMES[ecc], MODE_NAMES[mode], mask))
+    print('// Generated with tools/pack_qrcode.py, do not edit')
+    print('static constexpr char %s_payload[] = %s;' % (name, c_string(data)))
+    print('')
+    print('static constexpr bool %s_equals(const char *a, const char *b)' % name)
+    print('{')
+    print('    return *a == *b && (*a == \'\\0\' || %s_equals(a + 1, b + 1));' % name)
+    print('}')
+    print('')
+    print('static_assert(%s_equals(%s_payload, %s),' % (name, name, args.macro))
+    print('              "%s has changed, generate %s again with tools/pack_qrcode.py");' % (args.macro, name))
+    print('')
+    print('static const uint8_t %s_modules[] = {' % name)
+    for i in range(0, len(modules), 16):
+        print(','.join('0x%02X' % b for b in modules[i:i + 16]) + ',')
+    print('};')
+    print('')
+    print('extern const QRCode %s = {' % name)
+    print('    %d, %d, %s, %s, %d, const_cast<uint8_t *>(%s_modules)'
+          % (args.version, grid.size, ECC_NAMES[ecc], MODE_NAMES[mode], mask, name))
+    print('};')
+    sys.stderr.write('%s: %d bytes payload -> %d bytes of modules\n' % (name, len(data), len(modules)))
+
+
+if __name__ == '__main__':
+    main()